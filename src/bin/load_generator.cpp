@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "operators/predicate.hpp"
+#include "server/client.hpp"
+#include "server/wire_protocol.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Sends queries to a running hyriseServer from several concurrent clients, each waiting for the answer of its query
+// before sending the next one, and reports the throughput and the latency percentiles. The server has to hold the
+// TPC-H tables of the given scale factor. Two workloads are measured one after another:
+//
+// - point: Looks up a random order by its key, which mostly misses the ResultCache.
+// - filter: Fetches up to 1,000 line items with a random quantity. There are only 50 quantities, so after a warm-up,
+//           the results come from the ResultCache, as for a dashboard that is refreshed repeatedly.
+//
+// Usage: hyriseLoadGenerator [-s socket_path] [-c clients] [-n queries_per_client] [-f scale_factor]
+
+namespace {
+
+struct LoadConfig {
+  std::string socket_path = "/tmp/hyrise.sock";
+  size_t client_count = 8;
+  size_t queries_per_client = 1'000;
+  float scale_factor = 0.1f;
+};
+
+LoadConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = LoadConfig{};
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[++argument_index]};
+
+    if (argument == "-s") {
+      config.socket_path = value;
+    } else if (argument == "-c") {
+      config.client_count = std::stoul(value);
+    } else if (argument == "-n") {
+      config.queries_per_client = std::stoul(value);
+    } else if (argument == "-f") {
+      config.scale_factor = std::stof(value);
+    } else {
+      Fail("Unknown argument " + argument + ". Usage: " + argv[0] +
+           " [-s socket_path] [-c clients] [-n queries_per_client] [-f scale_factor]");
+    }
+  }
+  Assert(config.client_count > 0, "At least one client is required");
+  Assert(config.queries_per_client > 0, "At least one query per client is required");
+  return config;
+}
+
+// Returns the ID of the column in the result of the server, which is sent even if the result has no rows
+ColumnID column_id_by_name(Client& client, const std::string& table_name, const std::string& column_name) {
+  return client.query(QueryRequest{table_name, nullptr, 0})->column_id_by_name(column_name);
+}
+
+using QueryGenerator = std::function<QueryRequest(std::mt19937&)>;
+
+void run(const LoadConfig& config, const std::string& name, const QueryGenerator& generate_query) {
+  auto latencies = std::vector<std::vector<std::chrono::nanoseconds>>(config.client_count);
+  auto row_counts = std::vector<uint64_t>(config.client_count);
+
+  auto timer = Timer{};
+  auto threads = std::vector<std::thread>{};
+  for (auto client_index = size_t{0}; client_index < config.client_count; ++client_index) {
+    threads.emplace_back([&, client_index]() {
+      auto client = Client{config.socket_path};
+      auto generator = std::mt19937{static_cast<uint32_t>(client_index)};
+      for (auto query_index = size_t{0}; query_index < config.queries_per_client; ++query_index) {
+        const auto request = generate_query(generator);
+        auto query_timer = Timer{};
+        client.query(request,
+                     [&](const Table& /*schema*/, Chunk&& chunk) { row_counts[client_index] += chunk.size(); });
+        latencies[client_index].emplace_back(query_timer.lap());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto duration = std::chrono::duration<double>(timer.lap()).count();
+
+  auto all_latencies = std::vector<std::chrono::nanoseconds>{};
+  for (const auto& client_latencies : latencies) {
+    all_latencies.insert(all_latencies.end(), client_latencies.begin(), client_latencies.end());
+  }
+  std::sort(all_latencies.begin(), all_latencies.end());
+  const auto percentile = [&](const double fraction) {
+    const auto index = std::min(all_latencies.size() - 1, static_cast<size_t>(fraction * all_latencies.size()));
+    return std::chrono::duration<double, std::micro>(all_latencies[index]).count();
+  };
+  auto row_count = uint64_t{0};
+  for (const auto client_row_count : row_counts) {
+    row_count += client_row_count;
+  }
+
+  std::cout << "- " << name << ": " << static_cast<size_t>(static_cast<double>(all_latencies.size()) / duration)
+            << " queries/s, " << static_cast<size_t>(static_cast<double>(row_count) / duration)
+            << " rows/s, latency p50 " << percentile(0.5) << " us, p99 " << percentile(0.99) << " us, max "
+            << percentile(1.0) << " us" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+  std::cout << "- Sending " << config.queries_per_client << " queries from each of " << config.client_count
+            << " clients to " << config.socket_path << std::endl;
+
+  auto schema_client = Client{config.socket_path};
+  const auto order_key_column_id = column_id_by_name(schema_client, "orders", "o_orderkey");
+  const auto quantity_column_id = column_id_by_name(schema_client, "lineitem", "l_quantity");
+
+  // As generated by TpchTableGenerator, only eight out of every 32 order keys are used.
+  const auto order_count = static_cast<uint32_t>(config.scale_factor * 1'500'000);
+  Assert(order_count > 0, "The scale factor is too small");
+  run(config, "point", [&](std::mt19937& generator) {
+    const auto order_index = std::uniform_int_distribution<uint32_t>{0, order_count - 1}(generator);
+    const auto order_key = static_cast<int32_t>((order_index / 8) * 32 + order_index % 8 + 1);
+    return QueryRequest{"orders", Predicate::comparison(order_key_column_id, ScanType::OpEquals, order_key),
+                        std::nullopt};
+  });
+
+  run(config, "filter", [&](std::mt19937& generator) {
+    const auto quantity = static_cast<float>(std::uniform_int_distribution<int32_t>{1, 50}(generator));
+    return QueryRequest{"lineitem", Predicate::comparison(quantity_column_id, ScanType::OpEquals, quantity),
+                        uint64_t{1'000}};
+  });
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include <pthread.h>
+#include <signal.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "operators/result_cache.hpp"
+#include "server/server.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Keeps the TPC-H tables resident in the StorageManager and answers queries of other processes on them via a Unix
+// domain socket (see Server), until it receives SIGINT or SIGTERM. hyriseLoadGenerator sends queries to it.
+//
+// Usage: hyriseServer [-s socket_path] [-t worker_threads] [-f scale_factor] [-o trace.json]
+//
+// With a scale factor of 0, no tables are generated. With -o, the queries are traced and the timeline of the workers
+// is written in Chrome's trace format when the server stops (see Tracer).
+
+namespace {
+
+struct ServerConfig {
+  std::string socket_path = "/tmp/hyrise.sock";
+  size_t worker_count = std::thread::hardware_concurrency();
+  float scale_factor = 0.1f;
+  std::string trace_file_path;
+};
+
+ServerConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = ServerConfig{};
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[++argument_index]};
+
+    if (argument == "-s") {
+      config.socket_path = value;
+    } else if (argument == "-t") {
+      config.worker_count = std::stoul(value);
+    } else if (argument == "-f") {
+      config.scale_factor = std::stof(value);
+    } else if (argument == "-o") {
+      config.trace_file_path = value;
+    } else {
+      Fail("Unknown argument " + argument + ". Usage: " + argv[0] +
+           " [-s socket_path] [-t worker_threads] [-f scale_factor] [-o trace.json]");
+    }
+  }
+  Assert(config.worker_count > 0, "At least one worker thread is required");
+  return config;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+
+  // The signals are blocked before any thread is started, so that all threads inherit the mask and only sigwait
+  // receives them.
+  auto signals = sigset_t{};
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  if (config.scale_factor > 0.0f) {
+    std::cout << "- Generating TPC-H tables with scale factor " << config.scale_factor << std::endl;
+    auto timer = Timer{};
+    TpchTableGenerator{config.scale_factor}.generate_and_store();
+    std::cout << "- Generated in " << std::chrono::duration<double>(timer.lap()).count() << " s" << std::endl;
+  }
+
+  if (!config.trace_file_path.empty()) Tracer::enable(true);
+  auto server = Server{config.socket_path, config.worker_count};
+  server.start();
+  std::cout << "- Listening on " << config.socket_path << " with " << config.worker_count << " workers" << std::endl;
+
+  auto signal = 0;
+  sigwait(&signals, &signal);
+
+  server.stop();
+  std::cout << "- Stopped after " << server.query_count() << " queries on " << server.connection_count()
+            << " connections" << std::endl;
+  ResultCache::get().print();
+
+  if (!config.trace_file_path.empty()) {
+    auto trace_file = std::ofstream{config.trace_file_path};
+    Tracer::get().write_chrome_trace(trace_file);
+    std::cout << "- Wrote trace to " << config.trace_file_path << std::endl;
+  }
+  return 0;
+}
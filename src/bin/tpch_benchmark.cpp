@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/predicate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Generates the TPC-H tables in-process and measures the latency of the TPC-H queries that can be expressed on top of
+// the storage layer. As there are no join, aggregate, or sort operators yet, filters use the TableScan and everything
+// else is implemented as typed loops over the chunks of the lineitem table. Queries that require joins are not part
+// of the benchmark.
+//
+// Usage: hyriseBenchmarkTPCH [-s scale_factor] [-c chunk_size] [-r runs] [-m memory_budget_mb] [-o result.json]
+//
+// With -m, the BufferManager keeps the finalized chunks within the given memory budget, evicting them to files.
+
+namespace {
+
+struct BenchmarkConfig {
+  float scale_factor = 0.1f;
+  ChunkOffset chunk_size = TpchTableGenerator::DEFAULT_CHUNK_SIZE;
+  size_t runs = 20;
+  size_t memory_budget = BufferManager::UNLIMITED;
+  std::string output_file_path;
+};
+
+struct QueryResult {
+  std::string name;
+  std::vector<std::chrono::nanoseconds> durations;
+  std::shared_ptr<Table> result_table;
+};
+
+// The returned segment has to be held while its values are read, so that the BufferManager does not evict it.
+template <typename T>
+std::shared_ptr<const ValueSegment<T>> value_segment(const Table& table, const ChunkID chunk_id,
+                                                     const std::string& column_name) {
+  const auto segment = table.get_chunk(chunk_id).get_segment(table.column_id_by_name(column_name));
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+  Assert(value_segment, "Column " + column_name + " is not stored in a ValueSegment of the expected type");
+  return value_segment;
+}
+
+// TPC-H Query 1: Pricing Summary Report
+std::shared_ptr<Table> run_query_1() {
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+
+  struct Aggregates {
+    double sum_quantity = 0.0;
+    double sum_base_price = 0.0;
+    double sum_discounted_price = 0.0;
+    double sum_charge = 0.0;
+    double sum_discount = 0.0;
+    int64_t count = 0;
+  };
+
+  // std::map keeps the groups ordered by return flag and line status, as required by the ORDER BY clause. The keys
+  // are copied, as the segments might be evicted once the query moved on to the next chunk.
+  auto groups = std::map<std::pair<std::string, std::string>, Aggregates>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < lineitem->chunk_count(); ++chunk_id) {
+    if (lineitem->get_chunk(chunk_id).size() == 0) continue;
+
+    const auto ship_date_segment = value_segment<std::string>(*lineitem, chunk_id, "l_shipdate");
+    const auto return_flag_segment = value_segment<std::string>(*lineitem, chunk_id, "l_returnflag");
+    const auto line_status_segment = value_segment<std::string>(*lineitem, chunk_id, "l_linestatus");
+    const auto quantity_segment = value_segment<float>(*lineitem, chunk_id, "l_quantity");
+    const auto extended_price_segment = value_segment<float>(*lineitem, chunk_id, "l_extendedprice");
+    const auto discount_segment = value_segment<float>(*lineitem, chunk_id, "l_discount");
+    const auto tax_segment = value_segment<float>(*lineitem, chunk_id, "l_tax");
+
+    const auto& ship_dates = ship_date_segment->values();
+    const auto& return_flags = return_flag_segment->values();
+    const auto& line_statuses = line_status_segment->values();
+    const auto& quantities = quantity_segment->values();
+    const auto& extended_prices = extended_price_segment->values();
+    const auto& discounts = discount_segment->values();
+    const auto& taxes = tax_segment->values();
+
+    for (auto chunk_offset = ChunkOffset{0}, size = static_cast<ChunkOffset>(ship_dates.size()); chunk_offset < size;
+         ++chunk_offset) {
+      if (ship_dates[chunk_offset] > "1998-09-02") continue;
+
+      auto& aggregates = groups[{return_flags[chunk_offset], line_statuses[chunk_offset]}];
+      const auto discounted_price = extended_prices[chunk_offset] * (1.0 - discounts[chunk_offset]);
+      aggregates.sum_quantity += quantities[chunk_offset];
+      aggregates.sum_base_price += extended_prices[chunk_offset];
+      aggregates.sum_discounted_price += discounted_price;
+      aggregates.sum_charge += discounted_price * (1.0 + taxes[chunk_offset]);
+      aggregates.sum_discount += discounts[chunk_offset];
+      ++aggregates.count;
+    }
+  }
+
+  auto result = std::make_shared<Table>();
+  for (const auto& [name, data_type] : std::vector<std::pair<std::string, DataType>>{
+           {"l_returnflag", DataType::String},
+           {"l_linestatus", DataType::String},
+           {"sum_qty", DataType::Double},
+           {"sum_base_price", DataType::Double},
+           {"sum_disc_price", DataType::Double},
+           {"sum_charge", DataType::Double},
+           {"avg_qty", DataType::Double},
+           {"avg_price", DataType::Double},
+           {"avg_disc", DataType::Double},
+           {"count_order", DataType::Long}}) {
+    result->add_column(name, data_type);
+  }
+  for (const auto& [group, aggregates] : groups) {
+    const auto count = static_cast<double>(aggregates.count);
+    result->append({group.first, group.second, aggregates.sum_quantity,
+                    aggregates.sum_base_price, aggregates.sum_discounted_price, aggregates.sum_charge,
+                    aggregates.sum_quantity / count, aggregates.sum_base_price / count,
+                    aggregates.sum_discount / count, aggregates.count});
+  }
+  return result;
+}
+
+// TPC-H Query 6: Forecasting Revenue Change Query
+std::shared_ptr<Table> run_query_6() {
+  const auto lineitem = StorageManager::get().get_table("lineitem");
+  const auto column_id = [&](const std::string& column_name) { return lineitem->column_id_by_name(column_name); };
+
+  // Floats are not exact, so the BETWEEN 0.05 AND 0.07 bounds are widened by half a cent.
+  const auto predicate = Predicate::conjunction(
+      {Predicate::comparison(column_id("l_shipdate"), ScanType::OpGreaterThanEquals, "1994-01-01"),
+       Predicate::comparison(column_id("l_shipdate"), ScanType::OpLessThan, "1995-01-01"),
+       Predicate::between(column_id("l_discount"), 0.045f, 0.075f),
+       Predicate::comparison(column_id("l_quantity"), ScanType::OpLessThan, 24.0f)});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(lineitem);
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+  table_scan->execute();
+  const auto scan_output = table_scan->get_output();
+
+  auto revenue = 0.0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < scan_output->chunk_count(); ++chunk_id) {
+    const auto& chunk = scan_output->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    const auto segment = std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+    const auto& pos_list = *segment->pos_list();
+
+    // The scan emits one output chunk per input chunk, so all rows of a chunk reference the same lineitem chunk.
+    const auto referenced_chunk_id = pos_list[0].chunk_id;
+    const auto extended_price_segment = value_segment<float>(*lineitem, referenced_chunk_id, "l_extendedprice");
+    const auto discount_segment = value_segment<float>(*lineitem, referenced_chunk_id, "l_discount");
+    const auto& extended_prices = extended_price_segment->values();
+    const auto& discounts = discount_segment->values();
+    pos_list.for_each([&](const RowID& row_id) {
+      revenue += extended_prices[row_id.chunk_offset] * discounts[row_id.chunk_offset];
+    });
+  }
+
+  auto result = std::make_shared<Table>();
+  result->add_column("revenue", DataType::Double);
+  result->append({revenue});
+  return result;
+}
+
+// Nearest-rank percentile of sorted durations.
+std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds>& sorted_durations,
+                                    const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted_durations.size())));
+  return sorted_durations[std::max(rank, size_t{1}) - 1];
+}
+
+void write_json(const BenchmarkConfig& config, const std::chrono::nanoseconds generation_duration,
+                const std::vector<QueryResult>& results) {
+  auto output = std::ofstream{config.output_file_path};
+  Assert(output.is_open(), "Could not open " + config.output_file_path);
+
+  output << "{\n";
+  output << "  \"context\": {\"benchmark\": \"TPC-H\", \"scale_factor\": " << config.scale_factor
+         << ", \"chunk_size\": " << config.chunk_size << ", \"runs\": " << config.runs
+         << ", \"generation_duration_ns\": " << generation_duration.count() << "},\n";
+  output << "  \"benchmarks\": [\n";
+  for (auto result_index = size_t{0}; result_index < results.size(); ++result_index) {
+    const auto& result = results[result_index];
+    auto sorted_durations = result.durations;
+    std::sort(sorted_durations.begin(), sorted_durations.end());
+    const auto total = std::accumulate(sorted_durations.begin(), sorted_durations.end(), std::chrono::nanoseconds{0});
+
+    output << "    {\"name\": \"" << result.name << "\", \"iterations\": " << sorted_durations.size()
+           << ", \"avg_ns\": " << total.count() / static_cast<int64_t>(sorted_durations.size())
+           << ", \"min_ns\": " << sorted_durations.front().count()
+           << ", \"p50_ns\": " << percentile(sorted_durations, 50).count()
+           << ", \"p90_ns\": " << percentile(sorted_durations, 90).count()
+           << ", \"p99_ns\": " << percentile(sorted_durations, 99).count()
+           << ", \"max_ns\": " << sorted_durations.back().count() << ", \"durations_ns\": [";
+    for (auto run = size_t{0}; run < result.durations.size(); ++run) {
+      output << (run > 0 ? ", " : "") << result.durations[run].count();
+    }
+    output << "]}" << (result_index + 1 < results.size() ? "," : "") << "\n";
+  }
+  output << "  ]\n}\n";
+}
+
+BenchmarkConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = BenchmarkConfig{};
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[++argument_index]};
+
+    if (argument == "-s") {
+      config.scale_factor = std::stof(value);
+    } else if (argument == "-c") {
+      config.chunk_size = static_cast<ChunkOffset>(std::stoul(value));
+    } else if (argument == "-r") {
+      config.runs = std::stoul(value);
+    } else if (argument == "-m") {
+      config.memory_budget = std::stoul(value) * 1024 * 1024;
+    } else if (argument == "-o") {
+      config.output_file_path = value;
+    } else {
+      Fail("Unknown argument " + argument + ". Usage: " + argv[0] +
+           " [-s scale_factor] [-c chunk_size] [-r runs] [-m memory_budget_mb] [-o result.json]");
+    }
+  }
+  Assert(config.runs > 0, "At least one run is required");
+  return config;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+  BufferManager::get().set_memory_budget(config.memory_budget);
+
+  std::cout << "- Generating TPC-H tables with scale factor " << config.scale_factor << " and chunk size "
+            << config.chunk_size << std::endl;
+  auto timer = Timer{};
+  TpchTableGenerator{config.scale_factor, config.chunk_size}.generate_and_store();
+  const auto generation_duration = timer.lap();
+  const auto generation_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(generation_duration);
+  std::cout << "- Generation took " << generation_milliseconds.count() << " ms" << std::endl;
+  StorageManager::get().print();
+  if (BufferManager::get().is_enabled()) BufferManager::get().print();
+
+  const auto queries = std::vector<std::pair<std::string, std::function<std::shared_ptr<Table>()>>>{
+      {"TPC-H 01", run_query_1}, {"TPC-H 06", run_query_6}};
+
+  auto results = std::vector<QueryResult>{};
+  for (const auto& [name, query] : queries) {
+    auto result = QueryResult{name, {}, nullptr};
+    result.durations.reserve(config.runs);
+
+    // One warm-up run that is not measured.
+    query();
+    for (auto run = size_t{0}; run < config.runs; ++run) {
+      timer.lap();
+      result.result_table = query();
+      result.durations.emplace_back(timer.lap());
+    }
+
+    auto sorted_durations = result.durations;
+    std::sort(sorted_durations.begin(), sorted_durations.end());
+    const auto to_milliseconds = [](const std::chrono::nanoseconds duration) {
+      return static_cast<double>(duration.count()) / 1'000'000.0;
+    };
+    std::cout << "- " << name << ": p50 " << to_milliseconds(percentile(sorted_durations, 50)) << " ms, p90 "
+              << to_milliseconds(percentile(sorted_durations, 90)) << " ms, p99 "
+              << to_milliseconds(percentile(sorted_durations, 99)) << " ms (" << result.result_table->row_count()
+              << " result rows)" << std::endl;
+    results.emplace_back(std::move(result));
+  }
+  if (BufferManager::get().is_enabled()) BufferManager::get().print();
+
+  if (!config.output_file_path.empty()) {
+    write_json(config, generation_duration, results);
+    std::cout << "- Results written to " << config.output_file_path << std::endl;
+  }
+
+  return 0;
+}
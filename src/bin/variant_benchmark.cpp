@@ -0,0 +1,129 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Measures the paths through which values enter tables as AllTypeVariants. Each row has one column of every data type.
+//
+// - append: Table::append with values of the column types
+// - append from strings: Table::append with strings that have to be converted to the column types
+// - load_table: Loads a table file with the same rows
+//
+// Usage: hyriseBenchmarkVariant [-n rows] [-r repetitions]
+
+namespace {
+
+struct BenchmarkConfig {
+  size_t row_count = 200'000;
+  size_t repetition_count = 5;
+};
+
+BenchmarkConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = BenchmarkConfig{};
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[++argument_index]};
+
+    if (argument == "-n") {
+      config.row_count = std::stoul(value);
+    } else if (argument == "-r") {
+      config.repetition_count = std::stoul(value);
+    } else {
+      Fail("Unknown argument " + argument + ". Usage: " + argv[0] + " [-n rows] [-r repetitions]");
+    }
+  }
+  Assert(config.repetition_count > 0, "At least one repetition is required");
+  return config;
+}
+
+std::shared_ptr<Table> make_table() {
+  auto table = std::make_shared<Table>(ChunkOffset{100'000});
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Long);
+  table->add_column("c", DataType::Float);
+  table->add_column("d", DataType::Double);
+  table->add_column("e", DataType::String);
+  return table;
+}
+
+std::vector<AllTypeVariant> make_row(const size_t row) {
+  return {static_cast<int32_t>(row), static_cast<int64_t>(row) * 1'000'003, static_cast<float>(row % 1'000) / 8.0f,
+          static_cast<double>(row) / 3.0, "comment " + std::to_string(row)};
+}
+
+// Runs the benchmark repeatedly and reports the best throughput, which is the least disturbed by other processes
+void run(const BenchmarkConfig& config, const std::string& name, const std::function<void()>& benchmark) {
+  auto best_duration = std::chrono::duration<double>::max();
+  for (auto repetition = size_t{0}; repetition < config.repetition_count; ++repetition) {
+    auto timer = Timer{};
+    benchmark();
+    best_duration = std::min(best_duration, std::chrono::duration<double>(timer.lap()));
+  }
+  const auto rows_per_second = static_cast<double>(config.row_count) / best_duration.count();
+  std::cout << "- " << name << ": " << static_cast<size_t>(rows_per_second) << " rows/s" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+  std::cout << "- Best of " << config.repetition_count << " runs with " << config.row_count << " rows" << std::endl;
+
+  // The rows are prepared up front, so that only appending them is measured.
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  auto string_rows = std::vector<std::vector<AllTypeVariant>>{};
+  const auto file_path = std::filesystem::temp_directory_path() /
+                         ("hyrise_variant_benchmark_" + std::to_string(::getpid()) + ".tbl");
+  auto file = std::ofstream{file_path};
+  file << "a|b|c|d|e\nint|long|float|double|string\n";
+  for (auto row = size_t{0}; row < config.row_count; ++row) {
+    rows.emplace_back(make_row(row));
+
+    const auto a = std::to_string(row);
+    const auto b = std::to_string(static_cast<int64_t>(row) * 1'000'003);
+    const auto c = std::to_string(static_cast<float>(row % 1'000) / 8.0f);
+    const auto d = std::to_string(static_cast<double>(row) / 3.0);
+    const auto e = "comment " + std::to_string(row);
+    string_rows.push_back({a, b, c, d, e});
+    file << a << "|" << b << "|" << c << "|" << d << "|" << e << "\n";
+  }
+  file.close();
+
+  run(config, "append", [&]() {
+    const auto table = make_table();
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+  });
+
+  run(config, "append from strings", [&]() {
+    const auto table = make_table();
+    for (const auto& row : string_rows) {
+      table->append(row);
+    }
+  });
+
+  run(config, "load_table", [&]() {
+    const auto table = load_table(file_path, 100'000);
+    Assert(table->row_count() == config.row_count, "Rows are missing");
+  });
+
+  std::filesystem::remove(file_path);
+  return 0;
+}
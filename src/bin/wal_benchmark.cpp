@@ -0,0 +1,115 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "logging/write_ahead_log.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;  // NOLINT
+
+// Measures the ingest throughput of Table::append with and without the WriteAheadLog. Several threads append rows to
+// the same table. Each configuration starts from an empty table and an empty log directory.
+//
+// Usage: hyriseBenchmarkWAL [-t threads] [-n rows_per_thread] [-d log_directory]
+
+namespace {
+
+struct BenchmarkConfig {
+  size_t thread_count = 8;
+  size_t rows_per_thread = 20'000;
+  std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / ("hyrise_wal_benchmark_" + std::to_string(::getpid()));
+};
+
+BenchmarkConfig parse_arguments(const int argc, char* argv[]) {
+  auto config = BenchmarkConfig{};
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    Assert(argument_index + 1 < argc, "Missing value for " + argument);
+    const auto value = std::string{argv[++argument_index]};
+
+    if (argument == "-t") {
+      config.thread_count = std::stoul(value);
+    } else if (argument == "-n") {
+      config.rows_per_thread = std::stoul(value);
+    } else if (argument == "-d") {
+      config.directory = value;
+    } else {
+      Fail("Unknown argument " + argument + ". Usage: " + argv[0] +
+           " [-t threads] [-n rows_per_thread] [-d log_directory]");
+    }
+  }
+  Assert(config.thread_count > 0, "At least one thread is required");
+  return config;
+}
+
+// Returns the number of rows appended per second
+double run(const BenchmarkConfig& config, const std::optional<Durability> durability) {
+  StorageManager::get().reset();
+  WriteAheadLog::get().reset();
+  std::filesystem::remove_all(config.directory);
+  if (durability) WriteAheadLog::get().open(config.directory, *durability);
+
+  auto table = std::make_shared<Table>(ChunkOffset{100'000});
+  table->add_column("id", DataType::Long);
+  table->add_column("price", DataType::Float);
+  table->add_column("comment", DataType::String);
+  StorageManager::get().add_table("ingest", table);
+
+  auto timer = Timer{};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < config.thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto row = size_t{0}; row < config.rows_per_thread; ++row) {
+        const auto id = static_cast<int64_t>(thread_index * config.rows_per_thread + row);
+        table->append({id, static_cast<float>(row % 1000) / 10.0f, "comment " + std::to_string(id)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto duration = std::chrono::duration<double>(timer.lap());
+
+  if (durability) {
+    WriteAheadLog::get().print();
+    WriteAheadLog::get().close();
+  }
+  Assert(table->row_count() == config.thread_count * config.rows_per_thread, "Rows are missing");
+  return static_cast<double>(table->row_count()) / duration.count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto config = parse_arguments(argc, argv);
+  std::cout << "- Appending " << config.rows_per_thread << " rows in each of " << config.thread_count
+            << " threads, logging to " << config.directory << std::endl;
+
+  const auto baseline_throughput = run(config, std::nullopt);
+  std::cout << "- No logging: " << static_cast<size_t>(baseline_throughput) << " rows/s" << std::endl;
+
+  const auto durabilities = std::vector<std::pair<std::string, Durability>>{
+      {"async", Durability::Async}, {"group", Durability::Group}, {"sync", Durability::Sync}};
+  for (const auto& [name, durability] : durabilities) {
+    const auto throughput = run(config, durability);
+    std::cout << "- " << name << " durability: " << static_cast<size_t>(throughput) << " rows/s ("
+              << 100.0 * (1.0 - throughput / baseline_throughput) << "% slower than no logging)" << std::endl;
+  }
+
+  StorageManager::get().reset();
+  std::filesystem::remove_all(config.directory);
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include "all_type_variant.hpp"
+
+#include <array>
+#include <string>
+
+#include <boost/hana/unpack.hpp>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+const auto data_type_names = hana::unpack(detail::type_strings, [](const auto... type_strings) {
+  return std::array<std::string, sizeof...(type_strings)>{type_strings...};
+});
+
+}  // namespace
+
+const std::string& data_type_to_string(const DataType data_type) {
+  return data_type_names.at(static_cast<size_t>(data_type));
+}
+
+DataType data_type_from_string(const std::string& type_string) {
+  for (auto index = size_t{0}; index < data_type_names.size(); ++index) {
+    if (data_type_names[index] == type_string) return static_cast<DataType>(index);
+  }
+  Fail("Unknown data type " + type_string);
+}
+
+std::ostream& operator<<(std::ostream& stream, const DataType data_type) {
+  return stream << data_type_to_string(data_type);
+}
+
+std::ostream& operator<<(std::ostream& stream, const AllTypeVariant& value) {
+  std::visit([&](const auto& typed_value) { stream << typed_value; }, value);
+  return stream;
+}
+
+}  // namespace opossum
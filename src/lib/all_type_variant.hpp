@@ -1,21 +1,26 @@
 #pragma once
 
 #include <cstdint>
+#include <iostream>
 #include <string>
+#include <variant>
 #include <vector>
 
-#include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/contains.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/not_equal.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
+#include <boost/hana/take_while.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
-#include <boost/mpl/push_front.hpp>
-#include <boost/variant.hpp>
 
 #include <boost/preprocessor/seq/enum.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/seq/size.hpp>
 #include <boost/preprocessor/seq/transform.hpp>
 
 #include "types.hpp"
@@ -33,6 +38,14 @@ namespace detail {
 static constexpr auto type_strings = hana::make_tuple("int",    "long",   "float", "double", "string"     );  // NOLINT
 // clang-format on
 
+}  // namespace detail
+
+// Identifies the data type of a column without string comparisons. The enum values are the positions of the types in
+// data_types_macro, which resolve_data_type relies on. This is checked below for each enum value.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
+namespace detail {
+
 // Extends to hana::make_tuple(hana::type_c<int32_t>, hana::type_c<int64_t>, ...);
 static constexpr auto types =
     hana::make_tuple(BOOST_PP_SEQ_ENUM(BOOST_PP_SEQ_TRANSFORM(EXPAND_TO_HANA_TYPE, _, data_types_macro)));
@@ -57,11 +70,16 @@ struct to_pair {
 // Converts the tuples into pairs
 static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair{});  // NOLINT
 
-// Converts tuple to mpl vector
-using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
+// Holds a value of any of the data types. The index of the held type is its DataType. Unlike boost::variant,
+// std::variant never allocates backup storage when it is assigned to.
+using AllTypeVariant = std::variant<BOOST_PP_SEQ_ENUM(data_types_macro)>;
 
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Returns the index of type T in an Iterable
+template <typename Sequence, typename T>
+constexpr auto index_of(Sequence const& sequence, T const& element) {
+  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
+  return decltype(size)::value;
+}
 
 }  // namespace detail
 
@@ -70,6 +88,32 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// Returns the DataType of a C++ type, e.g., DataType::Int for int32_t
+template <typename T>
+constexpr DataType data_type_from_type() {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  return static_cast<DataType>(detail::index_of(types, hana::type_c<T>));
+}
+
+static_assert(static_cast<size_t>(DataType::String) + 1 == BOOST_PP_SEQ_SIZE(data_types_macro),
+              "DataType has to list exactly the types of data_types_macro");
+static_assert(data_type_from_type<int32_t>() == DataType::Int, "DataType::Int does not match data_types_macro");
+static_assert(data_type_from_type<int64_t>() == DataType::Long, "DataType::Long does not match data_types_macro");
+static_assert(data_type_from_type<float>() == DataType::Float, "DataType::Float does not match data_types_macro");
+static_assert(data_type_from_type<double>() == DataType::Double, "DataType::Double does not match data_types_macro");
+static_assert(data_type_from_type<std::string>() == DataType::String,
+              "DataType::String does not match data_types_macro");
+
+// Converts between DataType and the type names used in table files, e.g., "int". Parsing names is only meant for the
+// boundaries of the system, such as load_table; everything else passes DataTypes around.
+const std::string& data_type_to_string(DataType data_type);
+DataType data_type_from_string(const std::string& type_string);
+
+std::ostream& operator<<(std::ostream& stream, DataType data_type);
+
+// Prints the value that the variant holds, e.g., for descriptions of predicates
+std::ostream& operator<<(std::ostream& stream, const AllTypeVariant& value);
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
@@ -0,0 +1,55 @@
+#include "transaction_context.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id(transaction_id), _snapshot_commit_id(snapshot_commit_id) {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase == TransactionPhase::Active) rollback();
+  TransactionManager::get()._deregister_transaction(_snapshot_commit_id);
+}
+
+TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
+
+CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+
+CommitID TransactionContext::commit_id() const {
+  Assert(_phase == TransactionPhase::Committed, "Only committed transactions have a commit ID");
+  return _commit_id;
+}
+
+TransactionPhase TransactionContext::phase() const { return _phase; }
+
+void TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "Only active transactions can be committed");
+  TransactionManager::get()._commit(*this);
+  _phase = TransactionPhase::Committed;
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active, "Only active transactions can be rolled back");
+  for (const auto& read_write_operator : _read_write_operators) {
+    read_write_operator->rollback_records();
+  }
+  _phase = TransactionPhase::RolledBack;
+}
+
+void TransactionContext::register_read_write_operator(
+    std::shared_ptr<AbstractReadWriteOperator> read_write_operator) {
+  Assert(_phase == TransactionPhase::Active, "Cannot add operators to a transaction that is not active");
+  _read_write_operators.push_back(read_write_operator);
+}
+
+const std::vector<std::shared_ptr<AbstractReadWriteOperator>>& TransactionContext::read_write_operators() const {
+  return _read_write_operators;
+}
+
+}  // namespace opossum
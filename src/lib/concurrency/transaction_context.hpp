@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractReadWriteOperator;
+
+enum class TransactionPhase { Active, Committed, RolledBack };
+
+// A TransactionContext is created by the TransactionManager and passed to all operators of a transaction via
+// AbstractOperator::set_transaction_context. It holds the snapshot that readers validate against and the
+// read-write operators whose changes are committed or rolled back together.
+//
+// Transactions that are neither committed nor rolled back are rolled back when their context is destroyed.
+class TransactionContext : private Noncopyable {
+ public:
+  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id);
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+
+  // Returns the commit ID of the last transaction that is visible to this transaction.
+  CommitID snapshot_commit_id() const;
+
+  // Returns the commit ID assigned by commit(). Must only be called on committed transactions.
+  CommitID commit_id() const;
+
+  TransactionPhase phase() const;
+
+  // Makes the changes of all registered read-write operators visible to transactions started afterwards. Must not be
+  // called if one of them failed, see AbstractReadWriteOperator::execute_failed().
+  void commit();
+
+  // Reverts the changes of all registered read-write operators.
+  void rollback();
+
+  // Called by read-write operators when they are executed as part of this transaction.
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> read_write_operator);
+
+  const std::vector<std::shared_ptr<AbstractReadWriteOperator>>& read_write_operators() const;
+
+ protected:
+  friend class TransactionManager;
+
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  CommitID _commit_id{MAX_COMMIT_ID};
+  TransactionPhase _phase{TransactionPhase::Active};
+  std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
+};
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include "transaction_manager.hpp"
+
+#include <memory>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static TransactionManager instance;
+  return instance;
+}
+
+void TransactionManager::reset() {
+  const auto commit_lock = std::lock_guard{_commit_mutex};
+  _next_transaction_id = 1;
+  _last_commit_id = 0;
+
+  const auto active_snapshots_lock = std::lock_guard{_active_snapshots_mutex};
+  _active_snapshot_commit_ids.clear();
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  const auto active_snapshots_lock = std::lock_guard{_active_snapshots_mutex};
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+}
+
+CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
+
+std::optional<CommitID> TransactionManager::lowest_active_snapshot_commit_id() const {
+  const auto active_snapshots_lock = std::lock_guard{_active_snapshots_mutex};
+  if (_active_snapshot_commit_ids.empty()) return std::nullopt;
+  return *_active_snapshot_commit_ids.begin();
+}
+
+void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
+  const auto active_snapshots_lock = std::lock_guard{_active_snapshots_mutex};
+  // The snapshot might be unknown if the TransactionManager was reset while the context was alive.
+  const auto iter = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (iter != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(iter);
+}
+
+void TransactionManager::_commit(TransactionContext& context) {
+  const auto commit_lock = std::lock_guard{_commit_mutex};
+  const auto commit_id = CommitID{_last_commit_id + 1};
+  Assert(commit_id != MAX_COMMIT_ID, "Ran out of commit IDs");
+
+  for (const auto& read_write_operator : context.read_write_operators()) {
+    Assert(!read_write_operator->execute_failed(),
+           read_write_operator->description() + " failed, the transaction has to be rolled back");
+    read_write_operator->commit_records(commit_id);
+  }
+
+  context._commit_id = commit_id;
+  _last_commit_id = commit_id;
+}
+
+}  // namespace opossum
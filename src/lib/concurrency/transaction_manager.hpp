@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that hands out transaction IDs and snapshot commit IDs and orders commits.
+//
+// A transaction sees all rows that were committed with a commit ID not greater than its snapshot commit ID, which is
+// the last commit ID at the time the transaction started. Commit IDs are assigned while holding a mutex, and the new
+// commit ID is only published after the commit IDs of all touched rows were written. Thus, a snapshot never contains
+// partially committed transactions. Readers never take the mutex, so long-running reads do not block writers.
+class TransactionManager : private Noncopyable {
+ public:
+  static TransactionManager& get();
+
+  // deletes the entire TransactionManager and creates a new one, used especially in tests
+  void reset();
+
+  // Starts a new transaction whose snapshot contains all transactions committed so far.
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // returns the commit ID of the last committed transaction
+  CommitID last_commit_id() const;
+
+  // Returns the smallest snapshot commit ID of all transactions whose context is still alive, or nullopt if there
+  // are none. Data that is invisible to this snapshot is invisible to all running and future transactions.
+  std::optional<CommitID> lowest_active_snapshot_commit_id() const;
+
+  TransactionManager(TransactionManager&&) = delete;
+
+ protected:
+  friend class TransactionContext;
+
+  TransactionManager() = default;
+
+  // Assigns the next commit ID to the transaction, commits its records, and publishes the commit ID.
+  void _commit(TransactionContext& context);
+
+  // Called when a TransactionContext is destroyed.
+  void _deregister_transaction(CommitID snapshot_commit_id);
+
+  std::atomic<TransactionID> _next_transaction_id{1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+
+  // Taking the snapshot and registering it happens under the same lock, so that a transaction cannot start with a
+  // snapshot older than what lowest_active_snapshot_commit_id() just returned.
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshots_mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,356 @@
+#include "arrow.hpp"
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The memory behind an exported array, see ArrowArray::private_data. The structs of the children and the dictionary
+// belong to their parent, as the specification requires.
+struct ExportedArray {
+  // Keep the exported values alive, e.g., the segment they belong to
+  std::vector<std::shared_ptr<const void>> owners;
+  std::vector<const void*> buffers;
+  std::vector<ArrowArray> child_arrays;
+  std::vector<ArrowArray*> children;
+  ArrowArray dictionary{};
+};
+
+struct ExportedSchema {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> child_schemas;
+  std::vector<ArrowSchema*> children;
+  ArrowSchema dictionary{};
+};
+
+// Strings are not stored contiguously by ValueSegments, so they are converted when they are exported.
+template <typename OffsetType>
+struct StringBuffers {
+  std::vector<OffsetType> offsets;
+  std::string data;
+};
+
+void release_array(ArrowArray* array) {
+  auto* exported_array = static_cast<ExportedArray*>(array->private_data);
+  // Consumers may move children out of the array, which marks them as released.
+  for (auto* child : exported_array->children) {
+    if (child->release) child->release(child);
+  }
+  if (array->dictionary && array->dictionary->release) array->dictionary->release(array->dictionary);
+  delete exported_array;
+  array->release = nullptr;
+}
+
+void release_schema(ArrowSchema* schema) {
+  auto* exported_schema = static_cast<ExportedSchema*>(schema->private_data);
+  for (auto* child : exported_schema->children) {
+    if (child->release) child->release(child);
+  }
+  if (schema->dictionary && schema->dictionary->release) schema->dictionary->release(schema->dictionary);
+  delete exported_schema;
+  schema->release = nullptr;
+}
+
+ExportedArray& initialize_array(ArrowArray* array, const int64_t length, const size_t buffer_count,
+                                const size_t child_count) {
+  auto* exported_array = new ExportedArray{};
+  exported_array->buffers.resize(buffer_count, nullptr);
+  exported_array->child_arrays.resize(child_count);
+  for (auto& child_array : exported_array->child_arrays) {
+    exported_array->children.emplace_back(&child_array);
+  }
+
+  *array = ArrowArray{length,
+                      0,
+                      0,
+                      static_cast<int64_t>(buffer_count),
+                      static_cast<int64_t>(child_count),
+                      exported_array->buffers.data(),
+                      child_count > 0 ? exported_array->children.data() : nullptr,
+                      nullptr,
+                      release_array,
+                      exported_array};
+  return *exported_array;
+}
+
+ExportedSchema& initialize_schema(ArrowSchema* schema, const std::string& format, const std::string& name,
+                                  const size_t child_count) {
+  auto* exported_schema = new ExportedSchema{format, name, {}, {}, {}};
+  exported_schema->child_schemas.resize(child_count);
+  for (auto& child_schema : exported_schema->child_schemas) {
+    exported_schema->children.emplace_back(&child_schema);
+  }
+
+  *schema = ArrowSchema{exported_schema->format.c_str(),
+                        exported_schema->name.c_str(),
+                        nullptr,
+                        0,
+                        static_cast<int64_t>(child_count),
+                        child_count > 0 ? exported_schema->children.data() : nullptr,
+                        nullptr,
+                        release_schema,
+                        exported_schema};
+  return *exported_schema;
+}
+
+template <typename T>
+std::string arrow_format() {
+  if constexpr (std::is_same_v<T, int32_t>) {
+    return "i";
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return "l";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "f";
+  } else if constexpr (std::is_same_v<T, double>) {
+    return "g";
+  } else {
+    return "u";
+  }
+}
+
+template <typename OffsetType>
+void export_strings(ArrowArray* array, ArrowSchema* schema, const std::vector<std::string>& values,
+                    const size_t data_size, const std::string& name) {
+  auto string_buffers = std::make_shared<StringBuffers<OffsetType>>();
+  string_buffers->offsets.reserve(values.size() + 1);
+  string_buffers->data.reserve(data_size);
+  string_buffers->offsets.emplace_back(0);
+  for (const auto& value : values) {
+    string_buffers->data += value;
+    string_buffers->offsets.emplace_back(static_cast<OffsetType>(string_buffers->data.size()));
+  }
+
+  auto& exported_array = initialize_array(array, static_cast<int64_t>(values.size()), 3, 0);
+  exported_array.buffers[1] = string_buffers->offsets.data();
+  exported_array.buffers[2] = string_buffers->data.data();
+  exported_array.owners.emplace_back(std::move(string_buffers));
+  initialize_schema(schema, std::is_same_v<OffsetType, int32_t> ? "u" : "U", name, 0);
+}
+
+// Exports values that the owner keeps alive. Fixed-width values are not copied.
+template <typename T>
+void export_values(ArrowArray* array, ArrowSchema* schema, const std::vector<T>& values,
+                   std::shared_ptr<const void> owner, const std::string& name) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto data_size = size_t{0};
+    for (const auto& value : values) {
+      data_size += value.size();
+    }
+    // Large strings ("U") have 64 bit offsets, which are only needed if the data does not fit 32 bit offsets.
+    if (data_size <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+      export_strings<int32_t>(array, schema, values, data_size, name);
+    } else {
+      export_strings<int64_t>(array, schema, values, data_size, name);
+    }
+  } else {
+    auto& exported_array = initialize_array(array, static_cast<int64_t>(values.size()), 2, 0);
+    exported_array.buffers[1] = values.data();
+    exported_array.owners.emplace_back(std::move(owner));
+    initialize_schema(schema, arrow_format<T>(), name, 0);
+  }
+}
+
+template <typename uintX_t>
+void export_value_ids(ArrowArray* array, ArrowSchema* schema,
+                      const std::shared_ptr<const BaseAttributeVector>& attribute_vector, const std::string& format,
+                      const std::string& name) {
+  const auto& value_ids = static_cast<const FixedSizeAttributeVector<uintX_t>&>(*attribute_vector).values();
+  auto& exported_array = initialize_array(array, static_cast<int64_t>(value_ids.size()), 2, 0);
+  exported_array.buffers[1] = value_ids.data();
+  exported_array.owners.emplace_back(attribute_vector);
+  initialize_schema(schema, format, name, 0);
+}
+
+// Exports the ValueIDs as indices into the dictionary. As the dictionary is sorted, the order of the indices is the
+// order of the values.
+template <typename T>
+void export_dictionary_segment(ArrowArray* array, ArrowSchema* schema, const DictionarySegment<T>& segment,
+                               const std::string& name) {
+  const auto attribute_vector = segment.attribute_vector();
+  switch (attribute_vector->width()) {
+    case 1:
+      export_value_ids<uint8_t>(array, schema, attribute_vector, "C", name);
+      break;
+    case 2:
+      export_value_ids<uint16_t>(array, schema, attribute_vector, "S", name);
+      break;
+    case 4:
+      export_value_ids<uint32_t>(array, schema, attribute_vector, "I", name);
+      break;
+    default:
+      Fail("Unsupported attribute vector width");
+  }
+  schema->flags |= ARROW_FLAG_DICTIONARY_ORDERED;
+
+  auto& exported_array = *static_cast<ExportedArray*>(array->private_data);
+  auto& exported_schema = *static_cast<ExportedSchema*>(schema->private_data);
+  const auto dictionary = segment.dictionary();
+  export_values(&exported_array.dictionary, &exported_schema.dictionary, *dictionary, dictionary, "");
+  array->dictionary = &exported_array.dictionary;
+  schema->dictionary = &exported_schema.dictionary;
+}
+
+template <typename T>
+void export_segment(ArrowArray* array, ArrowSchema* schema, const std::shared_ptr<const BaseSegment>& segment,
+                    const std::string& name) {
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    export_values(array, schema, value_segment->values(), value_segment, name);
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    export_dictionary_segment(array, schema, *dictionary_segment, name);
+  } else if (const auto lz4_segment = std::dynamic_pointer_cast<const LZ4Segment<T>>(segment)) {
+    const auto decompressed_segment = lz4_segment->decompress();
+    export_values(array, schema, decompressed_segment->values(), decompressed_segment, name);
+  } else {
+    const auto values = std::make_shared<const std::vector<T>>(materialize_values<T>(*segment));
+    export_values(array, schema, *values, values, name);
+  }
+}
+
+DataType data_type_from_arrow_format(const std::string& format) {
+  if (format == "i") return DataType::Int;
+  if (format == "l") return DataType::Long;
+  if (format == "f") return DataType::Float;
+  if (format == "g") return DataType::Double;
+  if (format == "u" || format == "U") return DataType::String;
+  Fail("Unsupported Arrow format " + format);
+}
+
+DataType data_type_from_arrow_schema(const ArrowSchema& schema) {
+  // The type of a dictionary-encoded column is the type of its dictionary.
+  return data_type_from_arrow_format(schema.dictionary ? schema.dictionary->format : schema.format);
+}
+
+template <typename OffsetType>
+std::vector<std::string> import_strings(const ArrowArray& array, const int64_t offset, const int64_t length) {
+  const auto* offsets = static_cast<const OffsetType*>(array.buffers[1]) + offset;
+  const auto* data = static_cast<const char*>(array.buffers[2]);
+  auto values = std::vector<std::string>{};
+  values.reserve(length);
+  for (auto index = int64_t{0}; index < length; ++index) {
+    values.emplace_back(data + offsets[index], data + offsets[index + 1]);
+  }
+  return values;
+}
+
+template <typename T>
+std::vector<T> import_values(const ArrowArray& array, const ArrowSchema& schema, int64_t offset, int64_t length);
+
+template <typename T, typename IndexType>
+std::vector<T> import_dictionary_encoded_values(const ArrowArray& array, const ArrowSchema& schema,
+                                                const int64_t offset, const int64_t length) {
+  const auto dictionary = import_values<T>(*array.dictionary, *schema.dictionary, array.dictionary->offset,
+                                           array.dictionary->length);
+  const auto* indices = static_cast<const IndexType*>(array.buffers[1]) + offset;
+  auto values = std::vector<T>{};
+  values.reserve(length);
+  for (auto index = int64_t{0}; index < length; ++index) {
+    values.emplace_back(dictionary.at(static_cast<size_t>(indices[index])));
+  }
+  return values;
+}
+
+// Imports the values of the array from the given position on, which includes the offset of the array itself.
+template <typename T>
+std::vector<T> import_values(const ArrowArray& array, const ArrowSchema& schema, const int64_t offset,
+                             const int64_t length) {
+  // A producer might not have counted the NULLs (-1), but then, there is no validity buffer if there are none.
+  Assert(array.null_count == 0 || (array.null_count == -1 && !array.buffers[0]), "NULL values are not supported");
+  const auto format = std::string{schema.format};
+
+  if (schema.dictionary) {
+    if (format == "c") return import_dictionary_encoded_values<T, int8_t>(array, schema, offset, length);
+    if (format == "C") return import_dictionary_encoded_values<T, uint8_t>(array, schema, offset, length);
+    if (format == "s") return import_dictionary_encoded_values<T, int16_t>(array, schema, offset, length);
+    if (format == "S") return import_dictionary_encoded_values<T, uint16_t>(array, schema, offset, length);
+    if (format == "i") return import_dictionary_encoded_values<T, int32_t>(array, schema, offset, length);
+    if (format == "I") return import_dictionary_encoded_values<T, uint32_t>(array, schema, offset, length);
+    if (format == "l") return import_dictionary_encoded_values<T, int64_t>(array, schema, offset, length);
+    if (format == "L") return import_dictionary_encoded_values<T, uint64_t>(array, schema, offset, length);
+    Fail("Unsupported dictionary index format " + format);
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (format == "U") return import_strings<int64_t>(array, offset, length);
+    Assert(format == "u", "Unexpected Arrow format " + format);
+    return import_strings<int32_t>(array, offset, length);
+  } else {
+    Assert(format == arrow_format<T>(), "Unexpected Arrow format " + format);
+    const auto* values = static_cast<const T*>(array.buffers[1]) + offset;
+    return std::vector<T>(values, values + length);
+  }
+}
+
+}  // namespace
+
+void export_chunk_to_arrow(const Table& table, const ChunkID chunk_id, ArrowArray* out_array,
+                           ArrowSchema* out_schema) {
+  // Appending to an open chunk might reallocate its values while the exported array still refers to them, so open
+  // chunks are copied. Rows appended from now on are not exported.
+  const auto chunk = table.get_chunk_snapshot(chunk_id);
+  const auto row_count = chunk->size();
+  const auto column_count = static_cast<size_t>(table.column_count());
+  auto& exported_array = initialize_array(out_array, row_count, 1, column_count);
+  auto& exported_schema = initialize_schema(out_schema, "+s", "", column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      export_segment<ColumnDataType>(exported_array.children[column_id], exported_schema.children[column_id],
+                                     chunk->get_segment(column_id), table.column_name(column_id));
+    });
+  }
+}
+
+std::shared_ptr<Table> create_table_from_arrow_schema(const ArrowSchema& schema, const ChunkOffset target_chunk_size) {
+  Assert(std::string{schema.format} == "+s", "A record batch has to be a struct array");
+  auto table = std::make_shared<Table>(target_chunk_size);
+  for (auto column_index = int64_t{0}; column_index < schema.n_children; ++column_index) {
+    const auto& column_schema = *schema.children[column_index];
+    table->add_column(column_schema.name ? column_schema.name : "", data_type_from_arrow_schema(column_schema));
+  }
+  return table;
+}
+
+void import_arrow_record_batch(Table& table, ArrowArray* array, ArrowSchema* schema) {
+  Assert(std::string{schema->format} == "+s", "A record batch has to be a struct array");
+  Assert(schema->n_children == table.column_count() && array->n_children == table.column_count(),
+         "Record batch has wrong column count. Should be " + std::to_string(table.column_count()));
+
+  auto chunk = Chunk{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto& column_array = *array->children[column_id];
+    const auto& column_schema = *schema->children[column_id];
+    Assert(data_type_from_arrow_schema(column_schema) == table.column_type(column_id),
+           "Column " + table.column_name(column_id) + " has the wrong type");
+
+    // The offset of the struct array applies to its children, too.
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto values = import_values<ColumnDataType>(column_array, column_schema, array->offset + column_array.offset,
+                                                  array->length);
+      chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+    });
+  }
+  table.emplace_chunk(std::move(chunk));
+
+  array->release(array);
+  schema->release(schema);
+}
+
+}  // namespace opossum
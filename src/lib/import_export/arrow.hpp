@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "types.hpp"
+
+// The structs of the Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html). They are
+// defined by the specification, so any Arrow implementation, e.g., pyarrow, can consume them without Hyrise
+// depending on an Arrow library.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace opossum {
+
+class Table;
+
+// Exports a chunk as an Arrow record batch, i.e., a struct array ("+s") with one child per column, and its schema.
+// The caller owns both structs and has to call their release callbacks once it is done with them.
+//
+// The values of fixed-width ValueSegments of finalized chunks are shared without copying: The exported array keeps the
+// segment alive until it is released, even if the chunk is removed or its segments are replaced in the meantime. Open
+// chunks are copied while appends are blocked (see Table::get_chunk_snapshot), as appending to them may reallocate
+// their values. Rows appended afterwards are not included. DictionarySegments are exported as dictionary-encoded
+// arrays that share the attribute vector and, for fixed-width types, the dictionary. LZ4Segments share their
+// decompressed values. Strings are converted to offsets and data, and other segments, e.g., ReferenceSegments, are
+// materialized.
+// MVCC is not taken into account, so rows that were deleted or whose insert is not committed yet are exported as well.
+void export_chunk_to_arrow(const Table& table, ChunkID chunk_id, ArrowArray* out_array, ArrowSchema* out_schema);
+
+// Creates an empty table with the columns of a record batch schema, e.g., to import record batches into
+std::shared_ptr<Table> create_table_from_arrow_schema(
+    const ArrowSchema& schema, ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+
+// Appends a record batch to the table as a new chunk (see Table::emplace_chunk). Once the batch was imported, it and
+// its schema are released. The values are copied into ValueSegments. Dictionary-encoded arrays are decoded. As Hyrise
+// does not support NULL values, arrays that contain NULLs are rejected.
+void import_arrow_record_batch(Table& table, ArrowArray* array, ArrowSchema* schema);
+
+}  // namespace opossum
@@ -0,0 +1,551 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto SNAPSHOT_MAGIC = uint32_t{0x50414E53};  // "SNAP"
+
+const auto LOG_FILE_NAME = std::string{"wal.log"};
+// The log written before a checkpoint, which is kept until the snapshot is complete
+const auto PREVIOUS_LOG_FILE_NAME = std::string{"wal.log.old"};
+const auto SNAPSHOT_FILE_NAME = std::string{"snapshot.bin"};
+
+// Each record is framed as [payload size][sequence number][record type][payload][checksum], where the checksum covers
+// everything but the payload size.
+constexpr auto RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(LogSequenceNumber) + sizeof(uint8_t);
+constexpr auto RECORD_TRAILER_SIZE = sizeof(uint32_t);
+
+// FNV-1a, which is good enough to detect records that were only partially written
+uint32_t checksum(const char* data, const size_t size) {
+  auto hash = uint32_t{2166136261};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash = (hash ^ static_cast<uint8_t>(data[index])) * 16777619;
+  }
+  return hash;
+}
+
+void fsync_path(const std::filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string());
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "fsync of " + path.string() + " failed");
+}
+
+void write_table_definition(std::ostream& stream, const Table& table) {
+  write_value(stream, table.target_chunk_size());
+  write_value(stream, static_cast<uint8_t>(table.uses_mvcc() == UseMvcc::Yes));
+  write_value(stream, static_cast<ColumnID::base_type>(table.column_count()));
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    write_value(stream, table.column_name(column_id));
+    write_value(stream, table.column_type(column_id));
+  }
+}
+
+std::shared_ptr<Table> read_table_definition(std::istream& stream) {
+  const auto target_chunk_size = read_value<ChunkOffset>(stream);
+  const auto use_mvcc = read_value<uint8_t>(stream) ? UseMvcc::Yes : UseMvcc::No;
+  auto table = std::make_shared<Table>(target_chunk_size, use_mvcc);
+  const auto column_count = read_value<ColumnID::base_type>(stream);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_name = read_value<std::string>(stream);
+    table->add_column(column_name, read_value<DataType>(stream));
+  }
+  return table;
+}
+
+// Recovered rows are visible to all transactions, see Table::emplace_chunk. Thus, only the rows of chunks with MVCC
+// data that were committed and not deleted are written. Rows of running or rolled back inserts and deleted rows would
+// come back as visible otherwise.
+std::vector<ChunkOffset> rows_to_write(const Chunk& chunk) {
+  const auto mvcc_data = chunk.mvcc_data();
+  const auto row_count = mvcc_data ? std::min(chunk.size(), mvcc_data->size()) : chunk.size();
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (mvcc_data && (mvcc_data->begin_cids[chunk_offset] == MAX_COMMIT_ID ||
+                      mvcc_data->end_cids[chunk_offset] != MAX_COMMIT_ID)) {
+      continue;
+    }
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+  return chunk_offsets;
+}
+
+void write_chunk(std::ostream& stream, const Table& table, const Chunk& chunk,
+                 const std::vector<ChunkOffset>& chunk_offsets) {
+  write_value(stream, static_cast<ChunkOffset>(chunk_offsets.size()));
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto values = materialize_values<ColumnDataType>(*chunk.get_segment(column_id));
+      if (values.size() != chunk_offsets.size()) {
+        auto written_values = std::vector<ColumnDataType>{};
+        written_values.reserve(chunk_offsets.size());
+        for (const auto chunk_offset : chunk_offsets) {
+          written_values.emplace_back(std::move(values[chunk_offset]));
+        }
+        values = std::move(written_values);
+      }
+      write_values(stream, values);
+    });
+  }
+}
+
+Chunk read_chunk(std::istream& stream, const Table& table) {
+  const auto row_count = read_value<ChunkOffset>(stream);
+  auto chunk = Chunk{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(read_values<ColumnDataType>(stream, row_count)));
+    });
+  }
+  return chunk;
+}
+
+// Writes the rows of all chunks of the table. The append lock of the table has to be held, so that the chunks do not
+// change meanwhile.
+void write_chunks(std::ostream& stream, const Table& table) {
+  auto chunk_rows = std::vector<std::pair<const Chunk*, std::vector<ChunkOffset>>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    auto chunk_offsets = rows_to_write(chunk);
+    if (!chunk_offsets.empty()) chunk_rows.emplace_back(&chunk, std::move(chunk_offsets));
+  }
+  write_value(stream, static_cast<ChunkID::base_type>(chunk_rows.size()));
+  for (const auto& [chunk, chunk_offsets] : chunk_rows) {
+    write_chunk(stream, table, *chunk, chunk_offsets);
+  }
+}
+
+void read_chunks(std::istream& stream, Table& table) {
+  const auto chunk_count = read_value<ChunkID::base_type>(stream);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table.emplace_chunk(read_chunk(stream, table));
+  }
+}
+
+}  // namespace
+
+WriteAheadLog& WriteAheadLog::get() {
+  static WriteAheadLog instance;
+  return instance;
+}
+
+void WriteAheadLog::open(const std::filesystem::path& directory, const Durability durability,
+                         const std::chrono::milliseconds async_flush_interval) {
+  Assert(!is_open(), "WriteAheadLog is already open");
+  _directory = directory;
+  _durability = durability;
+  _async_flush_interval = async_flush_interval;
+  std::filesystem::create_directories(_directory);
+
+  _recover();
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    const auto table = storage_manager.get_table(table_name);
+    table->_log_name = table_name;
+    table->_last_log_sequence_number = std::max(table->_last_log_sequence_number, _last_log_sequence_number);
+  }
+  _durable_log_sequence_number = _last_log_sequence_number;
+
+  // The recovered state becomes the new snapshot, so the log can start over.
+  _write_snapshot();
+  std::filesystem::remove(_directory / PREVIOUS_LOG_FILE_NAME);
+  std::filesystem::remove(_directory / LOG_FILE_NAME);
+  _open_log_file();
+
+  _stop_flush_thread = false;
+  if (_durability != Durability::Sync) _flush_thread = std::thread{&WriteAheadLog::_flush_thread_loop, this};
+  _is_open = true;
+}
+
+void WriteAheadLog::close() {
+  if (!is_open()) return;
+
+  if (_flush_thread.joinable()) {
+    {
+      const auto lock = std::lock_guard{_mutex};
+      _stop_flush_thread = true;
+    }
+    _buffer_filled.notify_all();
+    _flush_thread.join();
+  }
+  _flush();
+
+  {
+    const auto file_lock = std::lock_guard{_file_mutex};
+    ::close(_file_descriptor);
+    _file_descriptor = -1;
+  }
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    storage_manager.get_table(table_name)->_log_name.clear();
+  }
+  _is_open = false;
+}
+
+bool WriteAheadLog::is_open() const { return _is_open; }
+
+Durability WriteAheadLog::durability() const { return _durability; }
+
+void WriteAheadLog::checkpoint() {
+  Assert(is_open(), "WriteAheadLog is not open");
+  const auto checkpoint_lock = std::lock_guard{_checkpoint_mutex};
+
+  // Records appended from now on go to a new log file. The snapshot contains all rows of the previous one, because
+  // tables are written while holding their append lock, and a row is logged before that lock is released.
+  {
+    const auto file_lock = std::lock_guard{_file_mutex};
+    _flush_buffer();
+    ::close(_file_descriptor);
+    std::filesystem::rename(_directory / LOG_FILE_NAME, _directory / PREVIOUS_LOG_FILE_NAME);
+    _open_log_file();
+  }
+
+  _write_snapshot();
+  std::filesystem::remove(_directory / PREVIOUS_LOG_FILE_NAME);
+}
+
+void WriteAheadLog::flush() {
+  Assert(is_open(), "WriteAheadLog is not open");
+  _flush();
+}
+
+void WriteAheadLog::log_create_table(const std::string& table_name, Table& table) {
+  Assert(!table.partition_schema(), "Partitioned tables cannot be logged, as the log does not record the partitioning");
+  auto log_sequence_number = LogSequenceNumber{0};
+  {
+    // The rows that the table holds already, e.g., if it was cloned, are part of the same record, so that a crash
+    // cannot leave the table without some of them.
+    const auto append_lock = std::lock_guard{table._append_mutex};
+    auto payload = std::ostringstream{};
+    write_value(payload, table_name);
+    write_table_definition(payload, table);
+    write_chunks(payload, table);
+
+    log_sequence_number = _append_record(RecordType::CreateTable, payload.str());
+    table._log_name = table_name;
+    table._last_log_sequence_number = log_sequence_number;
+  }
+  wait_until_durable(log_sequence_number);
+}
+
+void WriteAheadLog::log_drop_table(Table& table) {
+  if (table._log_name.empty()) return;
+
+  auto payload = std::ostringstream{};
+  write_value(payload, table._log_name);
+  table._log_name.clear();
+  wait_until_durable(_append_record(RecordType::DropTable, payload.str()));
+}
+
+LogSequenceNumber WriteAheadLog::log_row(Table& table, const std::vector<AllTypeVariant>& values) {
+  auto payload = std::ostringstream{};
+  write_value(payload, table._log_name);
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      write_value(payload, type_cast<ColumnDataType>(values[column_id]));
+    });
+  }
+
+  table._last_log_sequence_number = _append_record(RecordType::AppendRow, payload.str());
+  return table._last_log_sequence_number;
+}
+
+LogSequenceNumber WriteAheadLog::log_chunk(Table& table, const Chunk& chunk) {
+  auto payload = std::ostringstream{};
+  write_value(payload, table._log_name);
+  write_chunk(payload, table, chunk, rows_to_write(chunk));
+
+  table._last_log_sequence_number = _append_record(RecordType::AppendChunk, payload.str());
+  return table._last_log_sequence_number;
+}
+
+LogSequenceNumber WriteAheadLog::_append_record(const RecordType record_type, const std::string& payload) {
+  auto lock = std::unique_lock{_mutex};
+  const auto log_sequence_number = ++_last_log_sequence_number;
+  ++_record_count;
+
+  const auto record_begin = _buffer.size();
+  const auto payload_size = static_cast<uint32_t>(payload.size());
+  _buffer.append(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+  _buffer.append(reinterpret_cast<const char*>(&log_sequence_number), sizeof(log_sequence_number));
+  _buffer.push_back(static_cast<char>(record_type));
+  _buffer.append(payload);
+  const auto checksummed_begin = record_begin + sizeof(payload_size);
+  const auto record_checksum = checksum(_buffer.data() + checksummed_begin, _buffer.size() - checksummed_begin);
+  _buffer.append(reinterpret_cast<const char*>(&record_checksum), sizeof(record_checksum));
+
+  if (_durability == Durability::Group) {
+    lock.unlock();
+    _buffer_filled.notify_one();
+  }
+  return log_sequence_number;
+}
+
+void WriteAheadLog::wait_until_durable(const LogSequenceNumber log_sequence_number) {
+  switch (_durability) {
+    case Durability::Sync: {
+      {
+        const auto lock = std::lock_guard{_mutex};
+        if (_durable_log_sequence_number >= log_sequence_number) return;
+      }
+      // Another writer that flushes concurrently might have written this record already. Then, this flush is cheap.
+      _flush();
+      return;
+    }
+    case Durability::Group: {
+      auto lock = std::unique_lock{_mutex};
+      _durable.wait(lock, [&]() { return _durable_log_sequence_number >= log_sequence_number; });
+      return;
+    }
+    case Durability::Async:
+      return;
+  }
+}
+
+void WriteAheadLog::_flush() {
+  const auto file_lock = std::lock_guard{_file_mutex};
+  _flush_buffer();
+}
+
+void WriteAheadLog::_flush_buffer() {
+  auto buffer = std::string{};
+  auto last_log_sequence_number = LogSequenceNumber{0};
+  {
+    const auto lock = std::lock_guard{_mutex};
+    buffer.swap(_buffer);
+    last_log_sequence_number = _last_log_sequence_number;
+  }
+  if (buffer.empty()) return;
+
+  // As the log is the only copy of the appended rows, failing to write it is fatal, even in the flush thread.
+  Assert(::write(_file_descriptor, buffer.data(), buffer.size()) == static_cast<ssize_t>(buffer.size()),
+         "Writing the log failed");
+  Assert(::fdatasync(_file_descriptor) == 0, "fsync of the log failed");
+
+  {
+    const auto lock = std::lock_guard{_mutex};
+    _durable_log_sequence_number = std::max(_durable_log_sequence_number, last_log_sequence_number);
+    ++_flush_count;
+  }
+  _durable.notify_all();
+}
+
+void WriteAheadLog::_flush_thread_loop() {
+  while (true) {
+    {
+      auto lock = std::unique_lock{_mutex};
+      if (_durability == Durability::Group) {
+        // Records that are appended while the previous flush is running are written by the next one together.
+        _buffer_filled.wait(lock, [&]() { return _stop_flush_thread || !_buffer.empty(); });
+      } else {
+        _buffer_filled.wait_for(lock, _async_flush_interval, [&]() { return _stop_flush_thread; });
+      }
+      if (_stop_flush_thread) return;
+    }
+    _flush();
+  }
+}
+
+void WriteAheadLog::_open_log_file() {
+  const auto log_path = _directory / LOG_FILE_NAME;
+  _file_descriptor = ::open(log_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open " + log_path.string());
+  fsync_path(_directory);
+}
+
+void WriteAheadLog::_recover() {
+  const auto snapshot_path = _directory / SNAPSHOT_FILE_NAME;
+  if (std::filesystem::exists(snapshot_path)) _load_snapshot(snapshot_path);
+
+  // If a checkpoint did not complete, the log before it was not discarded yet.
+  for (const auto& log_file_name : {PREVIOUS_LOG_FILE_NAME, LOG_FILE_NAME}) {
+    const auto log_path = _directory / log_file_name;
+    if (std::filesystem::exists(log_path)) _replay_log(log_path);
+  }
+}
+
+void WriteAheadLog::_load_snapshot(const std::filesystem::path& snapshot_path) {
+  auto stream = std::ifstream{snapshot_path, std::ios::binary};
+  Assert(stream.is_open(), "Cannot open " + snapshot_path.string());
+  Assert(read_value<uint32_t>(stream) == SNAPSHOT_MAGIC, snapshot_path.string() + " is not a snapshot");
+
+  auto& storage_manager = StorageManager::get();
+  const auto table_count = read_value<uint32_t>(stream);
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    const auto table_name = read_value<std::string>(stream);
+    const auto last_log_sequence_number = read_value<LogSequenceNumber>(stream);
+    const auto table = read_table_definition(stream);
+    read_chunks(stream, *table);
+    Assert(stream.good(), "Reading " + snapshot_path.string() + " failed");
+
+    table->_last_log_sequence_number = last_log_sequence_number;
+    _last_log_sequence_number = std::max(_last_log_sequence_number, last_log_sequence_number);
+    storage_manager.add_table(table_name, table);
+  }
+}
+
+void WriteAheadLog::_replay_log(const std::filesystem::path& log_path) {
+  auto file = std::ifstream{log_path, std::ios::binary};
+  Assert(file.is_open(), "Cannot open " + log_path.string());
+  const auto log = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+  auto& storage_manager = StorageManager::get();
+  auto offset = size_t{0};
+  while (offset + RECORD_HEADER_SIZE + RECORD_TRAILER_SIZE <= log.size()) {
+    auto payload_size = uint32_t{};
+    std::memcpy(&payload_size, log.data() + offset, sizeof(payload_size));
+    const auto record_size = RECORD_HEADER_SIZE + payload_size + RECORD_TRAILER_SIZE;
+    if (offset + record_size > log.size()) break;
+
+    auto record_checksum = uint32_t{};
+    std::memcpy(&record_checksum, log.data() + offset + record_size - RECORD_TRAILER_SIZE, sizeof(record_checksum));
+    const auto* checksummed_data = log.data() + offset + sizeof(payload_size);
+    if (checksum(checksummed_data, record_size - sizeof(payload_size) - RECORD_TRAILER_SIZE) != record_checksum) break;
+
+    auto log_sequence_number = LogSequenceNumber{};
+    std::memcpy(&log_sequence_number, checksummed_data, sizeof(log_sequence_number));
+    const auto record_type = static_cast<RecordType>(log[offset + RECORD_HEADER_SIZE - 1]);
+    auto payload = std::istringstream{log.substr(offset + RECORD_HEADER_SIZE, payload_size)};
+    offset += record_size;
+    _last_log_sequence_number = std::max(_last_log_sequence_number, log_sequence_number);
+
+    // Records that are already contained in the snapshot of their table are skipped.
+    const auto table_name = read_value<std::string>(payload);
+    const auto table = storage_manager.has_table(table_name) ? storage_manager.get_table(table_name) : nullptr;
+    if (record_type == RecordType::CreateTable) {
+      if (table) continue;
+      const auto created_table = read_table_definition(payload);
+      read_chunks(payload, *created_table);
+      created_table->_last_log_sequence_number = log_sequence_number;
+      storage_manager.add_table(table_name, created_table);
+      ++_replayed_record_count;
+      continue;
+    }
+    if (!table || log_sequence_number <= table->_last_log_sequence_number) continue;
+
+    switch (record_type) {
+      case RecordType::DropTable:
+        storage_manager.drop_table(table_name);
+        break;
+      case RecordType::AppendRow: {
+        auto values = std::vector<AllTypeVariant>{};
+        for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+          resolve_data_type(table->column_type(column_id), [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+            values.emplace_back(read_value<ColumnDataType>(payload));
+          });
+        }
+        table->append(values);
+        break;
+      }
+      case RecordType::AppendChunk:
+        table->emplace_chunk(read_chunk(payload, *table));
+        break;
+      case RecordType::CreateTable:
+        Fail("Unreachable");
+    }
+    table->_last_log_sequence_number = log_sequence_number;
+    ++_replayed_record_count;
+  }
+}
+
+void WriteAheadLog::_write_snapshot() {
+  const auto snapshot_path = _directory / SNAPSHOT_FILE_NAME;
+  auto temporary_path = snapshot_path;
+  temporary_path += ".tmp";
+
+  {
+    auto stream = std::ofstream{temporary_path, std::ios::binary | std::ios::trunc};
+    Assert(stream.is_open(), "Cannot open " + temporary_path.string());
+
+    auto& storage_manager = StorageManager::get();
+    const auto table_names = storage_manager.table_names();
+    write_value(stream, SNAPSHOT_MAGIC);
+    write_value(stream, static_cast<uint32_t>(table_names.size()));
+    for (const auto& table_name : table_names) {
+      const auto table = storage_manager.get_table(table_name);
+
+      // Writers of the table wait until it is written, so that it matches its last log sequence number.
+      const auto append_lock = std::lock_guard{table->_append_mutex};
+      write_value(stream, table_name);
+      write_value(stream, table->_last_log_sequence_number);
+      write_table_definition(stream, *table);
+
+      write_chunks(stream, *table);
+    }
+    Assert(stream.good(), "Writing " + temporary_path.string() + " failed");
+  }
+
+  // Replacing the snapshot with rename is atomic, so a crash leaves either the previous or the new snapshot.
+  fsync_path(temporary_path);
+  std::filesystem::rename(temporary_path, snapshot_path);
+  fsync_path(_directory);
+}
+
+uint64_t WriteAheadLog::record_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _record_count;
+}
+
+uint64_t WriteAheadLog::flush_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _flush_count;
+}
+
+uint64_t WriteAheadLog::replayed_record_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _replayed_record_count;
+}
+
+void WriteAheadLog::print(std::ostream& out) const {
+  const auto lock = std::lock_guard{_mutex};
+  static const auto durability_names = std::vector<std::string>{"sync", "group", "async"};
+  out << "WriteAheadLog (" << durability_names[static_cast<size_t>(_durability)] << " durability): " << _record_count
+      << " records, " << _flush_count << " flushes";
+  if (_flush_count > 0) out << " (" << static_cast<double>(_record_count) / _flush_count << " records per flush)";
+  out << ", " << _replayed_record_count << " records replayed" << std::endl;
+}
+
+void WriteAheadLog::reset() {
+  close();
+  const auto lock = std::lock_guard{_mutex};
+  _buffer.clear();
+  _last_log_sequence_number = 0;
+  _durable_log_sequence_number = 0;
+  _record_count = 0;
+  _flush_count = 0;
+  _replayed_record_count = 0;
+}
+
+}  // namespace opossum
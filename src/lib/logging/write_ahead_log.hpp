@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Numbers the records of the log, starting at 1. 0 precedes all records.
+using LogSequenceNumber = uint64_t;
+
+// Determines when a writer that appended to a logged table returns
+enum class Durability {
+  Sync,   // The writer writes and fsyncs the log itself before it returns.
+  Group,  // A flush thread writes the records of all waiting writers and fsyncs them together, then wakes them up.
+  Async   // The writer returns right away. The flush thread fsyncs the log periodically, so a crash loses the rows
+          // appended since the last flush.
+};
+
+// The WriteAheadLog is a singleton that makes rows appended via Table::append and chunks added via
+// Table::emplace_chunk durable. It logs the tables of the StorageManager: Adding and dropping a table as well as each
+// append write a record to the log, which is stored in a directory together with a binary snapshot of all tables.
+//
+// Records are first collected in a buffer. With group commit, a flush thread writes the buffer and calls fsync once
+// for all writers that are waiting, which amortizes the fsync across concurrent writers. Writers append to the log
+// while holding the append lock of their table, so the order of records matches the order of rows in the table, but
+// wait for the flush after releasing the lock.
+//
+// checkpoint() writes a new snapshot and discards the log written before it. open() recovers the tables found in the
+// directory by loading the snapshot and replaying the log over it. Records at the end of the log that were only
+// partially written before a crash are detected by their checksum and ignored.
+//
+// Only non-transactional appends are logged. Rows inserted, updated, or deleted via transactions (see Insert and
+// Delete) are not, and neither are changes to the schema of a table after it was added to the StorageManager. As
+// recovered rows are visible to all transactions, snapshots only contain the rows that were committed and not deleted
+// when they were written, so transactional changes are made durable by a checkpoint.
+class WriteAheadLog : private Noncopyable {
+ public:
+  static WriteAheadLog& get();
+
+  // Recovers the tables stored in the directory (creating it if necessary) into the StorageManager, starts logging all
+  // tables of the StorageManager, and writes a checkpoint.
+  void open(const std::filesystem::path& directory, Durability durability = Durability::Group,
+            std::chrono::milliseconds async_flush_interval = std::chrono::milliseconds{10});
+
+  // Flushes the log and stops logging
+  void close();
+
+  bool is_open() const;
+  Durability durability() const;
+
+  // Writes a snapshot of all logged tables and discards the log that precedes it. Appends can continue while the
+  // snapshot is written, but tables must not be added or dropped, as the StorageManager is not thread-safe.
+  void checkpoint();
+
+  // Writes and fsyncs all records appended so far
+  void flush();
+
+  // Called by the StorageManager. The record of an added table includes the rows that it holds already.
+  void log_create_table(const std::string& table_name, Table& table);
+  void log_drop_table(Table& table);
+
+  // Called by the Table while holding its append lock. Returns the sequence number that has to be passed to
+  // wait_until_durable after the lock was released.
+  LogSequenceNumber log_row(Table& table, const std::vector<AllTypeVariant>& values);
+  LogSequenceNumber log_chunk(Table& table, const Chunk& chunk);
+
+  // Blocks until the record is durable, as required by the durability level
+  void wait_until_durable(LogSequenceNumber log_sequence_number);
+
+  uint64_t record_count() const;
+  uint64_t flush_count() const;
+  uint64_t replayed_record_count() const;
+
+  // prints the durability level and the counters
+  void print(std::ostream& out = std::cout) const;
+
+  // closes the log and resets the counters, used especially in tests
+  void reset();
+
+  WriteAheadLog(WriteAheadLog&&) = delete;
+
+ protected:
+  WriteAheadLog() = default;
+
+  enum class RecordType : uint8_t { CreateTable, DropTable, AppendRow, AppendChunk };
+
+  // Adds a record to the buffer and returns its sequence number
+  LogSequenceNumber _append_record(RecordType record_type, const std::string& payload);
+
+  // Write the buffer to the log file and fsync it. _flush_buffer requires _file_mutex to be held.
+  void _flush();
+  void _flush_buffer();
+  void _flush_thread_loop();
+
+  void _open_log_file();
+  void _recover();
+  void _load_snapshot(const std::filesystem::path& snapshot_path);
+  void _replay_log(const std::filesystem::path& log_path);
+  void _write_snapshot();
+
+  std::filesystem::path _directory;
+  Durability _durability = Durability::Group;
+  std::chrono::milliseconds _async_flush_interval{10};
+  std::atomic_bool _is_open{false};
+
+  // Guards the buffer, the sequence numbers, and the counters
+  mutable std::mutex _mutex;
+  std::string _buffer;
+  LogSequenceNumber _last_log_sequence_number = 0;
+  LogSequenceNumber _durable_log_sequence_number = 0;
+  uint64_t _record_count = 0;
+  uint64_t _flush_count = 0;
+  uint64_t _replayed_record_count = 0;
+  std::condition_variable _buffer_filled;
+  std::condition_variable _durable;
+
+  // Guards the log file, so that flushes are written in order
+  std::mutex _file_mutex;
+  int _file_descriptor = -1;
+
+  std::thread _flush_thread;
+  bool _stop_flush_thread = false;
+
+  // Serializes checkpoints
+  std::mutex _checkpoint_mutex;
+};
+
+}  // namespace opossum
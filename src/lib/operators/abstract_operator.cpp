@@ -0,0 +1,93 @@
+#include "abstract_operator.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic_bool hardware_counters_enabled_flag{false};
+
+}  // namespace
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
+                                   const std::shared_ptr<const AbstractOperator> right)
+    : _left_input(left), _right_input(right) {}
+
+void AbstractOperator::execute() {
+  Assert(!_performance_data.executed, "Operators must only be executed once");
+
+  auto performance_counters = std::optional<PerformanceCounters>{};
+  if (hardware_counters_enabled()) {
+    performance_counters.emplace();
+    performance_counters->start();
+  }
+
+  auto timer = Timer{};
+  {
+    const auto trace_scope = TraceScope{name().c_str(), TraceCategory::Operator};
+    _output = _on_execute();
+  }
+  _performance_data.walltime = timer.lap();
+
+  if (performance_counters) {
+    _performance_data.hardware_counters = performance_counters->stop();
+  }
+
+  _performance_data.executed = true;
+  if (_left_input) _performance_data.left_input_row_count = _left_input_table()->row_count();
+  if (_right_input) _performance_data.right_input_row_count = _right_input_table()->row_count();
+  if (_output) _performance_data.output_row_count = _output->row_count();
+}
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const { return _output; }
+
+std::string AbstractOperator::description() const { return name(); }
+
+std::optional<std::string> AbstractOperator::fingerprint() const { return description(); }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const { return _left_input; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const { return _right_input; }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+void AbstractOperator::set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  _transaction_context = transaction_context;
+}
+
+std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const {
+  return _transaction_context.lock();
+}
+
+void AbstractOperator::print_plan(std::ostream& stream) const { _print_plan(stream, 0); }
+
+void AbstractOperator::enable_hardware_counters(const bool enabled) { hardware_counters_enabled_flag = enabled; }
+
+bool AbstractOperator::hardware_counters_enabled() { return hardware_counters_enabled_flag; }
+
+std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
+  DebugAssert(_left_input, "Operator has no left input");
+  return _left_input->get_output();
+}
+
+std::shared_ptr<const Table> AbstractOperator::_right_input_table() const {
+  DebugAssert(_right_input, "Operator has no right input");
+  return _right_input->get_output();
+}
+
+void AbstractOperator::_print_plan(std::ostream& stream, const size_t depth) const {
+  stream << std::string(depth * 2, ' ') << "[" << description() << "] " << _performance_data << std::endl;
+  if (_left_input) _left_input->_print_plan(stream, depth + 1);
+  if (_right_input) _right_input->_print_plan(stream, depth + 1);
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+// AbstractOperator is the abstract super class for all operators.
+// All operators have up to two input operators and one output table.
+// Operators are executed exactly once. Afterwards, their output table and performance data can be retrieved.
+//
+// Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
+class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
+ public:
+  explicit AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                            const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  AbstractOperator(AbstractOperator&&) = default;
+  AbstractOperator& operator=(AbstractOperator&&) = default;
+
+  // Runs the operator and records its performance data. Must only be called once, after the inputs were executed.
+  void execute();
+
+  // returns the result of the operator
+  std::shared_ptr<const Table> get_output() const;
+
+  // returns the name of the operator, e.g., "GetTable"
+  virtual const std::string& name() const = 0;
+
+  // returns a human-readable description including the parameters of the operator, e.g., "GetTable (lineitem)"
+  virtual std::string description() const;
+
+  // Identifies the operator and all parameters its result depends on, but not its inputs. The ResultCache combines
+  // the fingerprints of all operators of a plan to recognize plans it has executed before. Defaults to the
+  // description, which includes the parameters. std::nullopt if the result must not be cached, e.g., because it
+  // depends on a transaction or on a table that is not stored in the StorageManager.
+  virtual std::optional<std::string> fingerprint() const;
+
+  std::shared_ptr<const AbstractOperator> left_input() const;
+  std::shared_ptr<const AbstractOperator> right_input() const;
+
+  const OperatorPerformanceData& performance_data() const;
+
+  // Operators that read MVCC tables (Validate) or modify them (AbstractReadWriteOperator) need the context of the
+  // transaction they are executed in. The context owns the read-write operators, so operators only hold a weak_ptr.
+  void set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context);
+  std::shared_ptr<TransactionContext> transaction_context() const;
+
+  // Prints the operator tree rooted at this operator, annotating every operator with its performance data.
+  void print_plan(std::ostream& stream = std::cout) const;
+
+  // Hardware counters are only collected if enabled, as opening them costs a few system calls per operator. If they
+  // are not available on the current machine, OperatorPerformanceData::hardware_counters stays empty.
+  static void enable_hardware_counters(bool enabled);
+  static bool hardware_counters_enabled();
+
+ protected:
+  // abstract method to actually execute the operator
+  // execute and get_output are split into two methods to allow for easier
+  // asynchronous execution
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // Get the input tables. Must only be called after the respective input operator was executed.
+  std::shared_ptr<const Table> _left_input_table() const;
+  std::shared_ptr<const Table> _right_input_table() const;
+
+  void _print_plan(std::ostream& stream, size_t depth) const;
+
+  // Shared pointers to input operators, can be nullptr.
+  std::shared_ptr<const AbstractOperator> _left_input;
+  std::shared_ptr<const AbstractOperator> _right_input;
+
+  // Is nullptr until the operator is executed
+  std::shared_ptr<const Table> _output;
+
+  std::weak_ptr<TransactionContext> _transaction_context;
+
+  // Operators add phase durations and skipped chunks during _on_execute(), the rest is filled by execute().
+  OperatorPerformanceData _performance_data;
+};
+
+}  // namespace opossum
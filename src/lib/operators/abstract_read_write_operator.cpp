@@ -0,0 +1,36 @@
+#include "abstract_read_write_operator.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractReadWriteOperator::AbstractReadWriteOperator(const std::shared_ptr<const AbstractOperator> left,
+                                                     const std::shared_ptr<const AbstractOperator> right)
+    : AbstractOperator(left, right) {}
+
+void AbstractReadWriteOperator::commit_records(const CommitID commit_id) { _on_commit_records(commit_id); }
+
+void AbstractReadWriteOperator::rollback_records() { _on_rollback_records(); }
+
+bool AbstractReadWriteOperator::execute_failed() const { return _execute_failed; }
+
+std::optional<std::string> AbstractReadWriteOperator::fingerprint() const { return std::nullopt; }
+
+void AbstractReadWriteOperator::_mark_as_failed() { _execute_failed = true; }
+
+std::shared_ptr<const Table> AbstractReadWriteOperator::_on_execute() {
+  const auto context = transaction_context();
+  Assert(context, description() + " must be executed within a transaction");
+  Assert(context->phase() == TransactionPhase::Active, description() + " requires an active transaction");
+
+  // Register before executing, so that partial changes are rolled back if the operator fails.
+  context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+  return _on_execute(context);
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// AbstractReadWriteOperator is the super class of all operators that modify tables, e.g., Insert.
+//
+// Such operators must be executed within a transaction. They lock the rows they touch with their transaction ID, and
+// the changes become visible to other transactions only once TransactionContext::commit() calls commit_records with
+// the commit ID of the transaction. On rollback, rollback_records() reverts them.
+class AbstractReadWriteOperator : public AbstractOperator {
+ public:
+  explicit AbstractReadWriteOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                                     const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  // Sets the commit IDs of the touched rows and releases their locks. Called by the TransactionManager while no other
+  // transaction commits.
+  void commit_records(CommitID commit_id);
+
+  // Reverts the changes of the operator and releases the locks of the touched rows.
+  void rollback_records();
+
+  // Returns whether the operator could not complete because it conflicted with another transaction, e.g., when
+  // deleting a row that another transaction deleted concurrently. The transaction then has to be rolled back.
+  bool execute_failed() const;
+
+  // Modifications must not be skipped, so their results are not cached.
+  std::optional<std::string> fingerprint() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() final;
+
+  // Executes the operator within the given transaction.
+  virtual std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) = 0;
+
+  virtual void _on_commit_records(CommitID commit_id) = 0;
+  virtual void _on_rollback_records() = 0;
+
+  void _mark_as_failed();
+
+ private:
+  bool _execute_failed = false;
+};
+
+}  // namespace opossum
@@ -0,0 +1,300 @@
+#include "approximate_aggregate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/hyper_log_log.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns z such that a standard normal variable lies within [-z, z] with the given probability.
+double normal_quantile(const double confidence_level) {
+  auto low = 0.0;
+  auto high = 40.0;
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    const auto middle = (low + high) / 2.0;
+    if (std::erf(middle / std::sqrt(2.0)) < confidence_level) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return (low + high) / 2.0;
+}
+
+// The rows of one chunk and the sum of the values sampled from it
+struct ChunkSample {
+  double row_count = 0.0;
+  double sampled_row_count = 0.0;
+  double sum = 0.0;
+  double squared_sum = 0.0;
+
+  double estimated_sum() const { return row_count * sum / sampled_row_count; }
+
+  // The variance of the sampled values, or infinity if it cannot be estimated
+  double variance() const {
+    if (sampled_row_count == row_count) return 0.0;
+    if (sampled_row_count < 2.0) return std::numeric_limits<double>::infinity();
+    return std::max(0.0, (squared_sum - sum * sum / sampled_row_count) / (sampled_row_count - 1.0));
+  }
+};
+
+template <typename T>
+ChunkSample sample_chunk(const BaseSegment& segment, const double row_sampling_rate, std::mt19937& generator) {
+  auto materialized_values = std::vector<T>{};
+  const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+  if (!value_segment) materialized_values = materialize_values<T>(segment);
+  const auto& values = value_segment ? value_segment->values() : materialized_values;
+
+  auto sample = ChunkSample{};
+  sample.row_count = static_cast<double>(values.size());
+  const auto add_value = [&](const T& value) {
+    const auto converted_value = static_cast<double>(value);
+    sample.sum += converted_value;
+    sample.squared_sum += converted_value * converted_value;
+    ++sample.sampled_row_count;
+  };
+
+  if (row_sampling_rate >= 1.0) {
+    std::for_each(values.begin(), values.end(), add_value);
+    return sample;
+  }
+
+  // Systematic sampling: every step-th row, starting at a random offset within the first step
+  const auto step = 1.0 / row_sampling_rate;
+  for (auto position = std::uniform_real_distribution<double>{0.0, step}(generator); position < sample.row_count;
+       position += step) {
+    add_value(values[static_cast<size_t>(position)]);
+  }
+  if (sample.sampled_row_count == 0.0) {
+    add_value(values[std::uniform_int_distribution<size_t>{0, values.size() - 1}(generator)]);
+  }
+  return sample;
+}
+
+}  // namespace
+
+ApproximateAggregate::ApproximateAggregate(const std::shared_ptr<const AbstractOperator>& input,
+                                           const ApproximateAggregateFunction aggregate_function,
+                                           const ColumnID column_id, const SamplingOptions& sampling_options)
+    : AbstractOperator(input),
+      _aggregate_function(aggregate_function),
+      _column_id(column_id),
+      _sampling_options(sampling_options) {
+  Assert(sampling_options.chunk_sampling_rate > 0.0 && sampling_options.chunk_sampling_rate <= 1.0,
+         "Chunk sampling rate must be in (0, 1]");
+  Assert(sampling_options.row_sampling_rate > 0.0 && sampling_options.row_sampling_rate <= 1.0,
+         "Row sampling rate must be in (0, 1]");
+  Assert(sampling_options.confidence_level > 0.0 && sampling_options.confidence_level < 1.0,
+         "Confidence level must be in (0, 1)");
+}
+
+const std::string& ApproximateAggregate::name() const {
+  static const auto name = std::string{"ApproximateAggregate"};
+  return name;
+}
+
+std::string ApproximateAggregate::description() const {
+  auto stream = std::stringstream{};
+  switch (_aggregate_function) {
+    case ApproximateAggregateFunction::Count:
+      stream << "COUNT";
+      break;
+    case ApproximateAggregateFunction::Sum:
+      stream << "SUM";
+      break;
+    case ApproximateAggregateFunction::Avg:
+      stream << "AVG";
+      break;
+    case ApproximateAggregateFunction::CountDistinct:
+      stream << "COUNT DISTINCT";
+      break;
+  }
+  stream << "(#" << _column_id << ")";
+  if (_aggregate_function == ApproximateAggregateFunction::Sum ||
+      _aggregate_function == ApproximateAggregateFunction::Avg) {
+    stream << ", " << _sampling_options.chunk_sampling_rate * 100 << "% of chunks, "
+           << _sampling_options.row_sampling_rate * 100 << "% of rows";
+  }
+  return name() + " (" + stream.str() + ")";
+}
+
+std::optional<std::string> ApproximateAggregate::fingerprint() const {
+  if (!_sampling_options.seed) return std::nullopt;
+  auto stream = std::stringstream{};
+  stream << description() << ", confidence " << _sampling_options.confidence_level << ", seed "
+         << *_sampling_options.seed;
+  return stream.str();
+}
+
+const ApproximateAggregateResult& ApproximateAggregate::result() const {
+  Assert(_performance_data.executed, "ApproximateAggregate was not executed yet");
+  return _result;
+}
+
+std::shared_ptr<const Table> ApproximateAggregate::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(_column_id < input_table->column_count(),
+         "ApproximateAggregate references non-existing column " + std::to_string(_column_id));
+
+  switch (_aggregate_function) {
+    case ApproximateAggregateFunction::Count:
+      _estimate_count(*input_table);
+      break;
+    case ApproximateAggregateFunction::Sum:
+    case ApproximateAggregateFunction::Avg:
+      Assert(input_table->column_type(_column_id) != DataType::String, "Cannot sum up strings");
+      _estimate_sum_or_avg(*input_table);
+      break;
+    case ApproximateAggregateFunction::CountDistinct:
+      _estimate_distinct_count(*input_table);
+      break;
+  }
+
+  auto output = std::make_shared<Table>();
+  output->add_column("estimate", DataType::Double);
+  output->add_column("lower_bound", DataType::Double);
+  output->add_column("upper_bound", DataType::Double);
+  output->append({_result.estimate, _result.lower_bound, _result.upper_bound});
+  return output;
+}
+
+void ApproximateAggregate::_estimate_count(const Table& table) {
+  _result.estimate = static_cast<double>(table.row_count());
+  _result.lower_bound = _result.estimate;
+  _result.upper_bound = _result.estimate;
+  _performance_data.chunks_total = table.chunk_count();
+  _performance_data.chunks_skipped = table.chunk_count();
+}
+
+void ApproximateAggregate::_estimate_sum_or_avg(const Table& table) {
+  auto population = std::vector<ChunkID>{};
+  auto total_row_count = 0.0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0 || chunk.column_count() == 0) continue;
+    population.emplace_back(chunk_id);
+    total_row_count += chunk.size();
+  }
+  _performance_data.chunks_total = table.chunk_count();
+  _performance_data.chunks_skipped = table.chunk_count();
+  if (population.empty()) return;
+
+  // Choose the chunks by a partial Fisher-Yates shuffle and read them in the order of the table.
+  auto generator = std::mt19937{_sampling_options.seed ? *_sampling_options.seed : std::random_device{}()};
+  const auto population_size = population.size();
+  const auto sample_size = std::clamp(
+      static_cast<size_t>(std::round(_sampling_options.chunk_sampling_rate * population_size)), size_t{1},
+      population_size);
+  for (auto index = size_t{0}; index < sample_size; ++index) {
+    std::swap(population[index],
+              population[std::uniform_int_distribution<size_t>{index, population_size - 1}(generator)]);
+  }
+  population.resize(sample_size);
+  std::sort(population.begin(), population.end());
+
+  auto samples = std::vector<ChunkSample>{};
+  resolve_data_type(table.column_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      for (const auto chunk_id : population) {
+        const auto segment = table.get_chunk(chunk_id).get_segment(_column_id);
+        samples.emplace_back(sample_chunk<ColumnDataType>(*segment, _sampling_options.row_sampling_rate, generator));
+      }
+    }
+  });
+
+  // The estimate extrapolates from the sampled chunks to all chunks. Its variance consists of the variance between
+  // the chunks and, if rows were sampled, the variance within the chunks.
+  const auto chunk_count = static_cast<double>(population_size);
+  const auto sampled_chunk_count = static_cast<double>(sample_size);
+  const auto expansion = chunk_count / sampled_chunk_count;
+  auto estimated_sum = 0.0;
+  auto sampled_chunk_row_count = 0.0;
+  auto within_chunk_variance = 0.0;
+  for (const auto& sample : samples) {
+    estimated_sum += sample.estimated_sum();
+    sampled_chunk_row_count += sample.row_count;
+    within_chunk_variance += sample.row_count * sample.row_count * (1.0 - sample.sampled_row_count / sample.row_count) *
+                             sample.variance() / sample.sampled_row_count;
+    _result.sampled_row_count += static_cast<uint64_t>(sample.sampled_row_count);
+  }
+  const auto ratio = estimated_sum / sampled_chunk_row_count;
+
+  // For Avg, the deviations of the chunk sums from those expected by the ratio take the place of the chunk sums.
+  const auto is_avg = _aggregate_function == ApproximateAggregateFunction::Avg;
+  auto between_chunk_variance = 0.0;
+  if (sample_size < population_size) {
+    if (sample_size < 2) {
+      between_chunk_variance = std::numeric_limits<double>::infinity();
+    } else {
+      const auto mean = estimated_sum / sampled_chunk_count;
+      for (const auto& sample : samples) {
+        const auto expected_sum = is_avg ? ratio * sample.row_count : mean;
+        const auto deviation = sample.estimated_sum() - expected_sum;
+        between_chunk_variance += deviation * deviation;
+      }
+      between_chunk_variance /= sampled_chunk_count - 1.0;
+    }
+  }
+
+  auto variance = chunk_count * chunk_count * (1.0 - sampled_chunk_count / chunk_count) * between_chunk_variance /
+                      sampled_chunk_count +
+                  expansion * within_chunk_variance;
+  _result.estimate = expansion * estimated_sum;
+  if (is_avg) {
+    _result.estimate = ratio;
+    variance /= total_row_count * total_row_count;
+  }
+
+  const auto margin = normal_quantile(_sampling_options.confidence_level) * std::sqrt(variance);
+  _result.lower_bound = _result.estimate - margin;
+  _result.upper_bound = _result.estimate + margin;
+  _result.sampled_chunk_count = sample_size;
+  _performance_data.chunks_skipped -= sample_size;
+}
+
+void ApproximateAggregate::_estimate_distinct_count(const Table& table) {
+  auto merged_hyper_log_log = HyperLogLog{};
+  resolve_data_type(table.column_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.size() == 0 || chunk.column_count() == 0) continue;
+
+      if (const auto hyper_log_log = chunk.hyper_log_log(_column_id)) {
+        merged_hyper_log_log.merge(*hyper_log_log);
+        continue;
+      }
+      for (const auto& value : materialize_values<ColumnDataType>(*chunk.get_segment(_column_id))) {
+        merged_hyper_log_log.insert(value_hash(value));
+      }
+      ++_result.sampled_chunk_count;
+      _result.sampled_row_count += chunk.size();
+    }
+  });
+
+  _result.estimate = merged_hyper_log_log.estimate();
+  const auto margin = normal_quantile(_sampling_options.confidence_level) *
+                      merged_hyper_log_log.relative_standard_error() * _result.estimate;
+  _result.lower_bound = std::max(0.0, _result.estimate - margin);
+  _result.upper_bound = _result.estimate + margin;
+  _performance_data.chunks_total = table.chunk_count();
+  _performance_data.chunks_skipped = table.chunk_count() - _result.sampled_chunk_count;
+}
+
+}  // namespace opossum
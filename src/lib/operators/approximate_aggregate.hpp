@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class ApproximateAggregateFunction { Count, Sum, Avg, CountDistinct };
+
+// Which part of the input ApproximateAggregate reads. Sampling is chunk-granular: A uniform random subset of the
+// chunks is chosen first, and within each chosen chunk, every (1 / row_sampling_rate)-th row starting at a random
+// offset. Reading whole chunks keeps the accesses sequential, and chunks that are not chosen are not touched at all.
+struct SamplingOptions {
+  double chunk_sampling_rate = 0.1;
+  double row_sampling_rate = 1.0;
+
+  // The probability with which the confidence interval contains the exact result
+  double confidence_level = 0.95;
+
+  // Makes the sample reproducible, a random seed is used if not set
+  std::optional<uint32_t> seed;
+};
+
+// The estimate and its confidence interval. The interval has zero width if the result is exact, and infinite width if
+// its variance cannot be estimated, e.g., because only a single chunk was sampled.
+struct ApproximateAggregateResult {
+  double estimate = 0.0;
+  double lower_bound = 0.0;
+  double upper_bound = 0.0;
+
+  // The chunks whose values were read and the number of values read from them
+  uint64_t sampled_chunk_count = 0;
+  uint64_t sampled_row_count = 0;
+};
+
+// Estimates an aggregate over one column of its input for dashboards and other queries where an exact result is too
+// expensive. The output is a single row with the columns estimate, lower_bound, and upper_bound (all doubles).
+//
+// - Count is exact, as it only needs the chunk sizes.
+// - Sum and Avg are estimated from a two-stage sample as described in SamplingOptions. The confidence interval
+//   follows from the variance of the sample between and within the chosen chunks (see Cochran, Sampling Techniques,
+//   chapter 10). Avg is estimated as the ratio of the estimated sum and the number of rows of the sample.
+// - CountDistinct merges the HyperLogLog sketches of all chunks, which are built when the chunks are finalized (see
+//   Table::set_hyper_log_log_enabled). Chunks without sketches, e.g., the last chunk or those of operator results,
+//   are sketched on the fly. Distinct counts cannot be extrapolated from a sample, so the sampling options besides the
+//   confidence level are ignored.
+//
+// The skipped chunks are reported in the performance data.
+class ApproximateAggregate : public AbstractOperator {
+ public:
+  ApproximateAggregate(const std::shared_ptr<const AbstractOperator>& input,
+                       ApproximateAggregateFunction aggregate_function, ColumnID column_id,
+                       const SamplingOptions& sampling_options = SamplingOptions{});
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+  // Results are only cached if the sample is reproducible, i.e., a seed was set.
+  std::optional<std::string> fingerprint() const override;
+
+  // Returns the result, the operator must have been executed
+  const ApproximateAggregateResult& result() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  void _estimate_count(const Table& table);
+  void _estimate_sum_or_avg(const Table& table);
+  void _estimate_distinct_count(const Table& table);
+
+  const ApproximateAggregateFunction _aggregate_function;
+  const ColumnID _column_id;
+  const SamplingOptions _sampling_options;
+  ApproximateAggregateResult _result;
+};
+
+}  // namespace opossum
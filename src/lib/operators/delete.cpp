@@ -0,0 +1,124 @@
+#include "delete.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& values_to_delete)
+    : AbstractReadWriteOperator(values_to_delete), _table_name(table_name) {}
+
+const std::string& Delete::table_name() const { return _table_name; }
+
+const std::string& Delete::name() const {
+  static const auto name = std::string{"Delete"};
+  return name;
+}
+
+std::string Delete::description() const { return name() + " (" + _table_name + ")"; }
+
+std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _table = StorageManager::get().get_table(_table_name);
+  Assert(_table->uses_mvcc() == UseMvcc::Yes, "Delete requires a table that uses MVCC");
+
+  const auto transaction_id = context->transaction_id();
+  const auto input_table = _left_input_table();
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    // The ChunkCompactor might remove the chunk meanwhile, so it is held by pointer.
+    const auto chunk_ptr = input_table->get_chunk_ptr(chunk_id);
+    const auto& chunk = *chunk_ptr;
+    if (chunk.size() == 0) continue;
+
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+    Assert(reference_segment && reference_segment->referenced_table() == _table,
+           "Delete expects its input to reference the table " + _table_name);
+
+    // Once a row cannot be locked, the remaining positions are skipped.
+    auto failed = false;
+    auto current_chunk_id = std::optional<ChunkID>{};
+    auto mvcc_data_ptr = std::shared_ptr<MvccData>{};
+    reference_segment->pos_list()->for_each([&](const RowID& row_id) {
+      if (failed) return;
+      if (row_id.chunk_id != current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        // The rows of compacted chunks have all been deleted, possibly by a transaction that committed after our
+        // snapshot was taken. Their MvccData might already be gone, so we treat them as a conflict.
+        const auto referenced_chunk = _table->get_chunk_ptr(row_id.chunk_id);
+        mvcc_data_ptr =
+            referenced_chunk->cleanup_commit_id() == MAX_COMMIT_ID ? referenced_chunk->mvcc_data() : nullptr;
+      }
+      const auto chunk_offset = row_id.chunk_offset;
+      if (!mvcc_data_ptr || chunk_offset >= mvcc_data_ptr->size()) {
+        failed = true;
+        return;
+      }
+      auto& mvcc_data = *mvcc_data_ptr;
+
+      auto expected_transaction_id = INVALID_TRANSACTION_ID;
+      if (mvcc_data.tids[chunk_offset].compare_exchange_strong(expected_transaction_id, transaction_id)) {
+        // We hold the lock now, but the row might have been deleted by a transaction that committed after our
+        // snapshot was taken. Writing the row again would lose that update.
+        if (mvcc_data.end_cids[chunk_offset] != MAX_COMMIT_ID) {
+          mvcc_data.tids[chunk_offset] = INVALID_TRANSACTION_ID;
+          failed = true;
+          return;
+        }
+        _deleted_rows.emplace_back(row_id);
+      } else if (expected_transaction_id == transaction_id && mvcc_data.begin_cids[chunk_offset] == MAX_COMMIT_ID &&
+                 mvcc_data.end_cids[chunk_offset] == MAX_COMMIT_ID) {
+        // The row was inserted by this transaction. Setting its end commit ID to 0 hides it from us, while other
+        // transactions do not see it anyway until its insert is committed.
+        mvcc_data.end_cids[chunk_offset] = CommitID{0};
+        _deleted_own_rows.emplace_back(row_id);
+      } else {
+        // The row is locked by another transaction.
+        failed = true;
+      }
+    });
+    if (failed) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+void Delete::_on_commit_records(const CommitID commit_id) {
+  for (const auto& row_id : _deleted_rows) {
+    const auto chunk = _table->get_chunk_ptr(row_id.chunk_id);
+    auto& mvcc_data = *chunk->mvcc_data();
+    // As for inserts, the commit ID has to be set before the lock is released.
+    mvcc_data.end_cids[row_id.chunk_offset] = commit_id;
+    mvcc_data.tids[row_id.chunk_offset] = INVALID_TRANSACTION_ID;
+    chunk->increase_invalid_row_count(1);
+  }
+
+  // The Insert of the same transaction was registered before us and has already released the lock of these rows.
+  for (const auto& row_id : _deleted_own_rows) {
+    const auto chunk = _table->get_chunk_ptr(row_id.chunk_id);
+    chunk->mvcc_data()->end_cids[row_id.chunk_offset] = commit_id;
+    chunk->increase_invalid_row_count(1);
+  }
+}
+
+void Delete::_on_rollback_records() {
+  for (const auto& row_id : _deleted_rows) {
+    _table->get_chunk_ptr(row_id.chunk_id)->mvcc_data()->tids[row_id.chunk_offset] = INVALID_TRANSACTION_ID;
+  }
+
+  // The rolled back Insert of the same transaction takes care of invalidating these rows.
+  for (const auto& row_id : _deleted_own_rows) {
+    _table->get_chunk_ptr(row_id.chunk_id)->mvcc_data()->end_cids[row_id.chunk_offset] = MAX_COMMIT_ID;
+  }
+}
+
+}  // namespace opossum
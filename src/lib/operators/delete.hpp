@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_write_operator.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Invalidates the rows of the table with the given name that its input references. The input usually is the output
+// of Validate (optionally filtered further), i.e., it consists of reference segments pointing into the table.
+//
+// Each row is locked by setting its transaction ID. If a row is locked by another transaction or was deleted by a
+// transaction that committed after our snapshot, the operator fails and the transaction has to be rolled back. The
+// rows disappear for other transactions once the deleting transaction commits and sets their end commit ID.
+class Delete : public AbstractReadWriteOperator {
+ public:
+  Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& values_to_delete);
+
+  const std::string& table_name() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  void _on_commit_records(CommitID commit_id) override;
+  void _on_rollback_records() override;
+
+  const std::string _table_name;
+  std::shared_ptr<Table> _table;
+  PosList _deleted_rows;
+
+  // Rows that were inserted by the same transaction. They are already locked by it and are hidden from it by setting
+  // their end commit ID right away, see _on_execute().
+  PosList _deleted_own_rows;
+};
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include "insert.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
+    : AbstractReadWriteOperator(values_to_insert), _target_table_name(target_table_name) {}
+
+const std::string& Insert::target_table_name() const { return _target_table_name; }
+
+const std::string& Insert::name() const {
+  static const auto name = std::string{"Insert"};
+  return name;
+}
+
+std::string Insert::description() const { return name() + " (" + _target_table_name + ")"; }
+
+std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _target_table = StorageManager::get().get_table(_target_table_name);
+  Assert(_target_table->uses_mvcc() == UseMvcc::Yes, "Insert requires a table that uses MVCC");
+
+  const auto input_table = _left_input_table();
+  Assert(input_table->column_count() == _target_table->column_count(),
+         "Input has wrong column count. Should be " + std::to_string(_target_table->column_count()));
+
+  const auto column_count = input_table->column_count();
+  auto values = std::vector<AllTypeVariant>(column_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        values[column_id] = (*chunk.get_segment(column_id))[chunk_offset];
+      }
+      _inserted_rows.emplace_back(_target_table->append_uncommitted(values, context->transaction_id()));
+    }
+  }
+
+  return nullptr;
+}
+
+void Insert::_on_commit_records(const CommitID commit_id) {
+  for (const auto& row_id : _inserted_rows) {
+    auto& mvcc_data = *_target_table->get_chunk(row_id.chunk_id).mvcc_data();
+    // The begin commit ID has to be set before the lock is released, as readers check the transaction ID first.
+    mvcc_data.begin_cids[row_id.chunk_offset] = commit_id;
+    mvcc_data.tids[row_id.chunk_offset] = INVALID_TRANSACTION_ID;
+  }
+}
+
+void Insert::_on_rollback_records() {
+  // The rows keep their begin commit ID of MAX_COMMIT_ID and thus stay invisible to all transactions.
+  for (const auto& row_id : _inserted_rows) {
+    auto& chunk = _target_table->get_chunk(row_id.chunk_id);
+    chunk.mvcc_data()->tids[row_id.chunk_offset] = INVALID_TRANSACTION_ID;
+    chunk.increase_invalid_row_count(1);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Appends the rows of its input to the table with the given name.
+//
+// The rows are locked by the inserting transaction and invisible to all other transactions until it commits. If the
+// transaction is rolled back, the rows stay in the table but never become visible.
+class Insert : public AbstractReadWriteOperator {
+ public:
+  Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert);
+
+  const std::string& target_table_name() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  void _on_commit_records(CommitID commit_id) override;
+  void _on_rollback_records() override;
+
+  const std::string _target_table_name;
+  std::shared_ptr<Table> _target_table;
+  PosList _inserted_rows;
+};
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator>& input, const uint64_t row_count)
+    : AbstractOperator(input), _row_count(row_count) {}
+
+uint64_t Limit::row_count() const { return _row_count; }
+
+const std::string& Limit::name() const {
+  static const auto name = std::string{"Limit"};
+  return name;
+}
+
+std::string Limit::description() const { return name() + " (" + std::to_string(_row_count) + ")"; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  auto remaining_row_count = _row_count;
+  auto chunk_id = ChunkID{0};
+  for (; chunk_id < chunk_count && remaining_row_count > 0; ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    const auto chunk_size = static_cast<ChunkOffset>(std::min<uint64_t>(chunk.size(), remaining_row_count));
+    if (chunk_size == 0 || chunk.column_count() == 0) continue;
+
+    auto positions = PosList{};
+    positions.reserve(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      positions.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    output->emplace_chunk(create_reference_chunk(input_table, positions));
+    remaining_row_count -= chunk_size;
+  }
+
+  _performance_data.chunks_total = chunk_count;
+  _performance_data.chunks_skipped = chunk_count - chunk_id;
+  return output;
+}
+
+}  // namespace opossum
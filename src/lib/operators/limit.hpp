@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Returns the first row_count rows of its input. Chunks after the one that completes the result are not looked at
+// and reported as skipped in the performance data. Combined with a TopK, this returns the first rows of an order.
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator>& input, uint64_t row_count);
+
+  uint64_t row_count() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const uint64_t _row_count;
+};
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "operator_performance_data.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+#include <string>
+
+namespace opossum {
+
+namespace {
+
+void output_duration(std::ostream& stream, const std::chrono::nanoseconds duration) {
+  if (duration < std::chrono::microseconds{10}) {
+    stream << duration.count() << " ns";
+  } else if (duration < std::chrono::milliseconds{10}) {
+    stream << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << " µs";
+  } else {
+    stream << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+  }
+}
+
+void output_counter(std::ostream& stream, const std::string& name, const std::optional<uint64_t>& value) {
+  stream << ", " << name << ": ";
+  if (value) {
+    stream << *value;
+  } else {
+    stream << "n/a";
+  }
+}
+
+}  // namespace
+
+void OperatorPerformanceData::add_phase_duration(const std::string& phase_name,
+                                                 const std::chrono::nanoseconds duration) {
+  const auto phase = std::find_if(phase_durations.begin(), phase_durations.end(),
+                                  [&](const auto& phase_duration) { return phase_duration.first == phase_name; });
+  if (phase == phase_durations.end()) {
+    phase_durations.emplace_back(phase_name, duration);
+  } else {
+    phase->second += duration;
+  }
+}
+
+void OperatorPerformanceData::output_to_stream(std::ostream& stream) const {
+  if (!executed) {
+    stream << "not executed";
+    return;
+  }
+
+  output_duration(stream, walltime);
+  stream << ", " << output_row_count << " rows (" << left_input_row_count;
+  if (right_input_row_count > 0) stream << " + " << right_input_row_count;
+  stream << " in)";
+
+  if (chunks_skipped > 0) stream << ", " << chunks_skipped << " of " << chunks_total << " chunks skipped";
+
+  for (const auto& [phase_name, duration] : phase_durations) {
+    stream << ", " << phase_name << ": ";
+    output_duration(stream, duration);
+  }
+
+  if (hardware_counters) {
+    output_counter(stream, "cycles", hardware_counters->cycles);
+    output_counter(stream, "instructions", hardware_counters->instructions);
+    output_counter(stream, "LLC misses", hardware_counters->llc_misses);
+    output_counter(stream, "branch misses", hardware_counters->branch_misses);
+  }
+}
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data) {
+  performance_data.output_to_stream(stream);
+  return stream;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+// Describes where an operator spent its time. It is filled by AbstractOperator::execute() (walltime, row counts,
+// hardware counters) and by the operators themselves (phases, skipped chunks).
+struct OperatorPerformanceData {
+  // Adds the duration to the phase with the given name, e.g., "Build" or "Probe". Phases are reported in the order in
+  // which they were first added.
+  void add_phase_duration(const std::string& phase_name, std::chrono::nanoseconds duration);
+
+  // Prints a single-line summary, e.g., "12 µs, 3 rows (100 in), 2 of 5 chunks skipped, Build: 4 µs, Probe: 7 µs".
+  void output_to_stream(std::ostream& stream) const;
+
+  bool executed = false;
+  std::chrono::nanoseconds walltime{0};
+  std::vector<std::pair<std::string, std::chrono::nanoseconds>> phase_durations;
+
+  uint64_t left_input_row_count = 0;
+  uint64_t right_input_row_count = 0;
+  uint64_t output_row_count = 0;
+
+  // Chunks that the operator did not have to look at, e.g., because a filter excluded them.
+  uint64_t chunks_skipped = 0;
+  uint64_t chunks_total = 0;
+
+  // Only set if hardware counters were requested (see AbstractOperator::enable_hardware_counters).
+  std::optional<HardwareCounters> hardware_counters;
+};
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data);
+
+}  // namespace opossum
@@ -0,0 +1,150 @@
+#include "predicate.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::string scan_type_to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+    case ScanType::OpLike:
+      return "LIKE";
+    case ScanType::OpNotLike:
+      return "NOT LIKE";
+  }
+  Fail("Unknown scan type");
+}
+
+std::string value_fingerprint(const AllTypeVariant& value) {
+  auto fingerprint = data_type_to_string(static_cast<DataType>(value.index())) + ":";
+  std::visit(
+      [&](const auto& typed_value) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(typed_value)>, std::string>) {
+          fingerprint += std::to_string(typed_value.size()) + ":" + typed_value;
+        } else {
+          fingerprint += detail::format_number(typed_value);
+        }
+      },
+      value);
+  return fingerprint;
+}
+
+}  // namespace
+
+Predicate::Predicate(const PredicateType type, const ColumnID column_id, const ScanType scan_type,
+                     std::vector<AllTypeVariant> values, std::vector<std::shared_ptr<const Predicate>> children)
+    : _type(type),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _values(std::move(values)),
+      _children(std::move(children)) {}
+
+std::shared_ptr<const Predicate> Predicate::comparison(const ColumnID column_id, const ScanType scan_type,
+                                                       const AllTypeVariant& value) {
+  return std::shared_ptr<const Predicate>(
+      new Predicate(PredicateType::Comparison, column_id, scan_type, {value}, {}));
+}
+
+std::shared_ptr<const Predicate> Predicate::between(const ColumnID column_id, const AllTypeVariant& lower,
+                                                    const AllTypeVariant& upper) {
+  return std::shared_ptr<const Predicate>(
+      new Predicate(PredicateType::Between, column_id, ScanType::OpEquals, {lower, upper}, {}));
+}
+
+std::shared_ptr<const Predicate> Predicate::conjunction(std::vector<std::shared_ptr<const Predicate>> children) {
+  Assert(!children.empty(), "A conjunction needs at least one child");
+  return std::shared_ptr<const Predicate>(
+      new Predicate(PredicateType::And, ColumnID{0}, ScanType::OpEquals, {}, std::move(children)));
+}
+
+std::shared_ptr<const Predicate> Predicate::disjunction(std::vector<std::shared_ptr<const Predicate>> children) {
+  Assert(!children.empty(), "A disjunction needs at least one child");
+  return std::shared_ptr<const Predicate>(
+      new Predicate(PredicateType::Or, ColumnID{0}, ScanType::OpEquals, {}, std::move(children)));
+}
+
+PredicateType Predicate::type() const { return _type; }
+
+ColumnID Predicate::column_id() const {
+  DebugAssert(_type == PredicateType::Comparison || _type == PredicateType::Between, "Predicate has no column");
+  return _column_id;
+}
+
+ScanType Predicate::scan_type() const {
+  DebugAssert(_type == PredicateType::Comparison, "Only comparisons have a scan type");
+  return _scan_type;
+}
+
+const std::vector<AllTypeVariant>& Predicate::values() const { return _values; }
+
+const std::vector<std::shared_ptr<const Predicate>>& Predicate::children() const { return _children; }
+
+std::string Predicate::description() const {
+  auto stream = std::stringstream{};
+  switch (_type) {
+    case PredicateType::Comparison:
+      stream << "#" << _column_id << " " << scan_type_to_string(_scan_type) << " " << _values[0];
+      break;
+    case PredicateType::Between:
+      stream << "#" << _column_id << " BETWEEN " << _values[0] << " AND " << _values[1];
+      break;
+    case PredicateType::And:
+    case PredicateType::Or:
+      for (auto child_index = size_t{0}; child_index < _children.size(); ++child_index) {
+        if (child_index > 0) stream << (_type == PredicateType::And ? " AND " : " OR ");
+        const auto& child = _children[child_index];
+        const auto needs_parentheses = child->type() == PredicateType::And || child->type() == PredicateType::Or;
+        stream << (needs_parentheses ? "(" : "") << child->description() << (needs_parentheses ? ")" : "");
+      }
+      break;
+  }
+  return stream.str();
+}
+
+std::string Predicate::fingerprint() const {
+  auto fingerprint = std::string{};
+  switch (_type) {
+    case PredicateType::Comparison:
+      fingerprint = "#" + std::to_string(_column_id) + " " + scan_type_to_string(_scan_type);
+      break;
+    case PredicateType::Between:
+      fingerprint = "#" + std::to_string(_column_id) + " BETWEEN";
+      break;
+    case PredicateType::And:
+    case PredicateType::Or:
+      fingerprint = (_type == PredicateType::And ? "AND " : "OR ") + std::to_string(_children.size());
+      break;
+  }
+  for (const auto& value : _values) {
+    fingerprint += " " + value_fingerprint(value);
+  }
+  for (const auto& child : _children) {
+    const auto child_fingerprint = child->fingerprint();
+    fingerprint += " " + std::to_string(child_fingerprint.size()) + ":" + child_fingerprint;
+  }
+  return fingerprint;
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class PredicateType { Comparison, Between, And, Or };
+
+// A node of a predicate tree that TableScan evaluates, e.g., for a > 5 AND (b BETWEEN 1 AND 3 OR c <> 'z').
+//
+// Leaves compare a column with constant values, inner nodes combine their children. Predicates only describe the
+// filter; TableScan compiles them into kernels that are specialized for the data types of the scanned columns.
+class Predicate {
+ public:
+  // column <scan_type> value
+  static std::shared_ptr<const Predicate> comparison(ColumnID column_id, ScanType scan_type,
+                                                     const AllTypeVariant& value);
+
+  // lower <= column <= upper
+  static std::shared_ptr<const Predicate> between(ColumnID column_id, const AllTypeVariant& lower,
+                                                  const AllTypeVariant& upper);
+
+  static std::shared_ptr<const Predicate> conjunction(std::vector<std::shared_ptr<const Predicate>> children);
+  static std::shared_ptr<const Predicate> disjunction(std::vector<std::shared_ptr<const Predicate>> children);
+
+  PredicateType type() const;
+
+  // Only for comparisons and betweens
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const std::vector<AllTypeVariant>& values() const;
+
+  // Only for conjunctions and disjunctions
+  const std::vector<std::shared_ptr<const Predicate>>& children() const;
+
+  // returns a human-readable representation, e.g., "#0 > 5 AND (#1 BETWEEN 1 AND 3 OR #2 != z)"
+  std::string description() const;
+
+  // Identifies the predicate exactly, unlike the description, which rounds numbers and omits the types of the values.
+  // Values are prefixed by their type, numbers are printed without loss, and strings as well as children are prefixed
+  // by their length, e.g., "AND 2 10:#0 > int:5 ...".
+  std::string fingerprint() const;
+
+ protected:
+  Predicate(PredicateType type, ColumnID column_id, ScanType scan_type, std::vector<AllTypeVariant> values,
+            std::vector<std::shared_ptr<const Predicate>> children);
+
+  const PredicateType _type;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const std::vector<AllTypeVariant> _values;
+  const std::vector<std::shared_ptr<const Predicate>> _children;
+};
+
+}  // namespace opossum
@@ -0,0 +1,202 @@
+#include "result_cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "get_table.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Operator results often share position lists between their reference segments, so these are counted only once.
+size_t estimate_table_size(const Table& table) {
+  auto size = size_t{0};
+  auto counted_pos_lists = std::unordered_set<const BasePosList*>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      if (reference_segment && !counted_pos_lists.insert(reference_segment->pos_list().get()).second) continue;
+      size += segment->estimate_memory_usage();
+    }
+  }
+  return size;
+}
+
+}  // namespace
+
+ResultCache& ResultCache::get() {
+  static ResultCache instance;
+  return instance;
+}
+
+std::shared_ptr<const Table> ResultCache::execute(const std::shared_ptr<AbstractOperator>& plan) {
+  Assert(!plan->performance_data().executed, "ResultCache can only execute plans that were not executed yet");
+
+  // The versions are read before the plan is executed. If a table is modified during the execution, the entry is
+  // invalidated by the next lookup, even if the result already contains the modification.
+  const auto key = plan_fingerprint(*plan);
+  const auto table_versions = key ? _table_versions(*plan) : TableVersions{};
+  if (!key) {
+    _execute_plan(*plan);
+    return plan->get_output();
+  }
+
+  {
+    const auto lock = std::lock_guard{_mutex};
+    const auto entry = _entry_by_key.find(*key);
+    if (entry != _entry_by_key.end()) {
+      if (entry->second->table_versions == table_versions) {
+        ++_hit_count;
+        _entries.splice(_entries.begin(), _entries, entry->second);
+        return entry->second->table;
+      }
+      ++_invalidation_count;
+      _erase(entry->second);
+    }
+    ++_miss_count;
+  }
+
+  // As in the DecompressionCache, the plan is executed without holding the lock. If the same plan is executed twice
+  // at the same time, the first result is kept.
+  _execute_plan(*plan);
+  const auto table = plan->get_output();
+  const auto table_size = estimate_table_size(*table);
+
+  const auto lock = std::lock_guard{_mutex};
+  if (_entry_by_key.find(*key) != _entry_by_key.end() || table_size > _capacity) return table;
+
+  _evict(_capacity - table_size);
+  _entries.push_front({*key, table, table_versions, table_size});
+  _entry_by_key.emplace(*key, _entries.begin());
+  _size += table_size;
+  return table;
+}
+
+std::optional<std::string> ResultCache::plan_fingerprint(const AbstractOperator& plan) {
+  // Each part is prefixed by its length, so that fingerprints containing parentheses cannot be confused.
+  auto fingerprint = plan.fingerprint();
+  if (!fingerprint) return std::nullopt;
+  auto key = std::to_string(fingerprint->size()) + ":" + *fingerprint + "(";
+  for (const auto& input : {plan.left_input(), plan.right_input()}) {
+    if (!input) continue;
+    const auto input_fingerprint = plan_fingerprint(*input);
+    if (!input_fingerprint) return std::nullopt;
+    key += *input_fingerprint;
+  }
+  return key + ")";
+}
+
+ResultCache::TableVersions ResultCache::_table_versions(const AbstractOperator& plan) {
+  auto table_versions = TableVersions{};
+  if (const auto* get_table = dynamic_cast<const GetTable*>(&plan)) {
+    const auto& table_name = get_table->table_name();
+    // A missing table is reported by GetTable when the plan is executed.
+    const auto& storage_manager = StorageManager::get();
+    table_versions.emplace_back(table_name, storage_manager.has_table(table_name)
+                                                ? storage_manager.table_version(table_name)
+                                                : uint64_t{0});
+  }
+  for (const auto& input : {plan.left_input(), plan.right_input()}) {
+    if (!input) continue;
+    const auto input_table_versions = _table_versions(*input);
+    table_versions.insert(table_versions.end(), input_table_versions.begin(), input_table_versions.end());
+  }
+  return table_versions;
+}
+
+void ResultCache::_execute_plan(AbstractOperator& plan) {
+  // Inputs may be shared between operators, so those that were already executed are not executed again.
+  if (plan.performance_data().executed) return;
+  for (const auto& input : {plan.left_input(), plan.right_input()}) {
+    if (input) _execute_plan(const_cast<AbstractOperator&>(*input));
+  }
+  plan.execute();
+}
+
+void ResultCache::_evict(const size_t capacity) {
+  while (_size > capacity) {
+    _erase(std::prev(_entries.end()));
+    ++_eviction_count;
+  }
+}
+
+void ResultCache::_erase(const std::list<Entry>::iterator entry) {
+  _size -= entry->size;
+  _entry_by_key.erase(entry->key);
+  _entries.erase(entry);
+}
+
+void ResultCache::set_capacity(const size_t capacity) {
+  const auto lock = std::lock_guard{_mutex};
+  _capacity = capacity;
+  _evict(capacity);
+}
+
+size_t ResultCache::capacity() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _capacity;
+}
+
+size_t ResultCache::size() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _size;
+}
+
+size_t ResultCache::entry_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _entries.size();
+}
+
+uint64_t ResultCache::hit_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _hit_count;
+}
+
+uint64_t ResultCache::miss_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _miss_count;
+}
+
+uint64_t ResultCache::eviction_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _eviction_count;
+}
+
+uint64_t ResultCache::invalidation_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _invalidation_count;
+}
+
+void ResultCache::print(std::ostream& out) const {
+  const auto lock = std::lock_guard{_mutex};
+  out << "ResultCache: " << _entries.size() << " results, " << _size << " of " << _capacity << " bytes, " << _hit_count
+      << " hits, " << _miss_count << " misses, " << _eviction_count << " evictions, " << _invalidation_count
+      << " invalidations" << std::endl;
+}
+
+void ResultCache::reset() {
+  const auto lock = std::lock_guard{_mutex};
+  _entries.clear();
+  _entry_by_key.clear();
+  _capacity = DEFAULT_CAPACITY;
+  _size = 0;
+  _hit_count = 0;
+  _miss_count = 0;
+  _eviction_count = 0;
+  _invalidation_count = 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+// The ResultCache is a singleton that keeps the results of recently executed plans, so that repeated queries, e.g.,
+// from dashboards, are answered without executing them again. Plans are identified by combining the fingerprints of
+// their operators (see AbstractOperator::fingerprint), so two separately built but identical plans share an entry.
+//
+// A cached result is only valid as long as the tables it was computed from are unchanged. Each entry stores the
+// versions of the tables read by the plan's GetTable operators at the time of execution, and a lookup whose versions
+// differ invalidates the entry. The cache holds at most capacity() bytes (as reported by
+// BaseSegment::estimate_memory_usage) and evicts the least recently used results first.
+class ResultCache : private Noncopyable {
+ public:
+  static ResultCache& get();
+
+  // Returns the output of the plan, which must not have been executed yet. On a hit, the plan is not executed and
+  // the cached table is returned. Otherwise, the plan is executed bottom-up and its output is cached unless the plan
+  // contains an operator that is not cacheable or the output is larger than the capacity.
+  std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractOperator>& plan);
+
+  // Returns the key under which the output of the plan is cached, or std::nullopt if it cannot be cached.
+  static std::optional<std::string> plan_fingerprint(const AbstractOperator& plan);
+
+  // Sets the capacity in bytes, evicting results if necessary. Defaults to DEFAULT_CAPACITY.
+  void set_capacity(size_t capacity);
+  size_t capacity() const;
+
+  // Returns the number of bytes of the cached results.
+  size_t size() const;
+  size_t entry_count() const;
+
+  uint64_t hit_count() const;
+  uint64_t miss_count() const;
+  uint64_t eviction_count() const;
+  uint64_t invalidation_count() const;
+
+  // prints the capacity, size, and counters
+  void print(std::ostream& out = std::cout) const;
+
+  // Drops all cached results, resets the counters, and restores the default capacity, used especially in tests
+  void reset();
+
+  static constexpr auto DEFAULT_CAPACITY = size_t{64} * 1024 * 1024;
+
+  ResultCache(ResultCache&&) = delete;
+
+ protected:
+  ResultCache() = default;
+
+  using TableVersions = std::vector<std::pair<std::string, uint64_t>>;
+
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const Table> table;
+    TableVersions table_versions;
+    size_t size;
+  };
+
+  static TableVersions _table_versions(const AbstractOperator& plan);
+  static void _execute_plan(AbstractOperator& plan);
+
+  // Must be called with _mutex held
+  void _evict(size_t capacity);
+  void _erase(std::list<Entry>::iterator entry);
+
+  // Most recently used entries come first.
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entry_by_key;
+
+  size_t _capacity = DEFAULT_CAPACITY;
+  size_t _size = 0;
+  uint64_t _hit_count = 0;
+  uint64_t _miss_count = 0;
+  uint64_t _eviction_count = 0;
+  uint64_t _invalidation_count = 0;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
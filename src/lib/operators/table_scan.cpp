@@ -0,0 +1,131 @@
+#include "table_scan.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "predicate.hpp"
+#include "storage/pos_lists.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_scan/predicate_kernels.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the positions at the given ascending indices of the position list
+std::shared_ptr<const BasePosList> filter_pos_list(const BasePosList& pos_list,
+                                                   const std::vector<ChunkOffset>& indices) {
+  auto positions = PosList{};
+  positions.reserve(indices.size());
+  auto next_index = indices.cbegin();
+  auto index = ChunkOffset{0};
+  pos_list.for_each([&](const RowID& row_id) {
+    if (next_index != indices.cend() && *next_index == index) {
+      positions.emplace_back(row_id);
+      ++next_index;
+    }
+    ++index;
+  });
+  return make_pos_list(std::move(positions));
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& input,
+                     const std::shared_ptr<const Predicate>& predicate)
+    : AbstractOperator(input), _predicate(predicate) {}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& input, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant& value)
+    : TableScan(input, Predicate::comparison(column_id, scan_type, value)) {}
+
+const std::shared_ptr<const Predicate>& TableScan::predicate() const { return _predicate; }
+
+const std::string& TableScan::name() const {
+  static const auto name = std::string{"TableScan"};
+  return name;
+}
+
+std::string TableScan::description() const { return name() + " (" + _predicate->description() + ")"; }
+
+std::optional<std::string> TableScan::fingerprint() const { return name() + " (" + _predicate->fingerprint() + ")"; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto kernel = compile_predicate(*_predicate, *input_table);
+  auto selection = SelectionVector{};
+  auto matches = std::vector<ChunkOffset>{};
+
+  const auto chunk_count = input_table->chunk_count();
+  _performance_data.chunks_total = chunk_count;
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    // The ChunkCompactor might remove the chunk meanwhile, so it is held by pointer.
+    const auto chunk_ptr = input_table->get_chunk_ptr(chunk_id);
+    const auto& chunk = *chunk_ptr;
+    const auto chunk_size = chunk.size();
+    if (chunk_size == 0 || chunk.column_count() == 0) continue;
+
+    // Checked before set_chunk, which accesses the segments of the chunk.
+    if (kernel->can_skip_chunk(chunk)) {
+      ++_performance_data.chunks_skipped;
+      continue;
+    }
+
+    const auto trace_scope = TraceScope{name().c_str(), TraceCategory::Chunk, chunk_id};
+    kernel->set_chunk(chunk);
+    matches.clear();
+    for (auto batch_begin = ChunkOffset{0}; batch_begin < chunk_size; batch_begin += SCAN_BATCH_SIZE) {
+      const auto batch_size = std::min(SCAN_BATCH_SIZE, chunk_size - batch_begin);
+      selection.select_all(batch_size);
+      kernel->filter(batch_begin, batch_size, selection);
+
+      if (selection.is_dense) {
+        for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+          matches.emplace_back(batch_begin + offset);
+        }
+      } else {
+        for (auto index = ChunkOffset{0}; index < selection.size; ++index) {
+          matches.emplace_back(batch_begin + selection.offsets[index]);
+        }
+      }
+    }
+    if (matches.empty()) continue;
+
+    // Columns that reference the same positions share the filtered positions, too. Positions within one chunk are
+    // stored in the representation that takes the least memory, e.g., as a bitmap if most rows match.
+    auto output_chunk = Chunk{};
+    auto filtered_pos_lists = std::map<std::shared_ptr<const BasePosList>, std::shared_ptr<const BasePosList>>{};
+    auto direct_pos_list = std::shared_ptr<const BasePosList>{};
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+
+      if (reference_segment) {
+        auto& filtered_pos_list = filtered_pos_lists[reference_segment->pos_list()];
+        if (!filtered_pos_list) filtered_pos_list = filter_pos_list(*reference_segment->pos_list(), matches);
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+            reference_segment->referenced_table(), reference_segment->referenced_column_id(), filtered_pos_list));
+      } else {
+        if (!direct_pos_list) direct_pos_list = make_pos_list(chunk_id, matches);
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, direct_pos_list));
+      }
+    }
+    output->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+class Predicate;
+
+// Selects the rows of its input that satisfy a predicate, which can combine comparisons on several columns with AND
+// and OR. The output consists of reference segments; if the input already consists of reference segments, the
+// output references the same tables instead of the input.
+//
+// The predicate is compiled into kernels specialized for the column types (see predicate_kernels.hpp). Each chunk is
+// scanned in batches of SCAN_BATCH_SIZE rows, and a selection vector carries the qualifying rows of a batch from one
+// predicate to the next. Conjunctions stop as soon as no row qualifies anymore and learn which of their predicates
+// are the most selective ones. Chunks whose Bloom filters rule out an equality predicate are skipped without reading
+// their segments and are reported in the performance data.
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator>& input, const std::shared_ptr<const Predicate>& predicate);
+
+  // Scans for column <scan_type> value
+  TableScan(const std::shared_ptr<const AbstractOperator>& input, ColumnID column_id, ScanType scan_type,
+            const AllTypeVariant& value);
+
+  const std::shared_ptr<const Predicate>& predicate() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+  std::optional<std::string> fingerprint() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::shared_ptr<const Predicate> _predicate;
+};
+
+}  // namespace opossum
@@ -0,0 +1,181 @@
+#include "like_matcher.hpp"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+// Candidates for occurrences of a needle are found by comparing its first and its last character with a block of
+// the haystack at once. Only for positions where both match, the whole needle is compared.
+#if defined(__AVX2__)
+using SimdVector = __m256i;
+
+SimdVector broadcast(const char character) { return _mm256_set1_epi8(character); }
+
+uint32_t candidate_mask(const SimdVector first, const SimdVector last, const char* block, const size_t needle_size) {
+  const auto block_first = _mm256_loadu_si256(reinterpret_cast<const SimdVector*>(block));
+  const auto block_last = _mm256_loadu_si256(reinterpret_cast<const SimdVector*>(block + needle_size - 1));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(
+      _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))));
+}
+#else
+using SimdVector = __m128i;
+
+SimdVector broadcast(const char character) { return _mm_set1_epi8(character); }
+
+uint32_t candidate_mask(const SimdVector first, const SimdVector last, const char* block, const size_t needle_size) {
+  const auto block_first = _mm_loadu_si128(reinterpret_cast<const SimdVector*>(block));
+  const auto block_last = _mm_loadu_si128(reinterpret_cast<const SimdVector*>(block + needle_size - 1));
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+}
+#endif
+
+constexpr auto SIMD_WIDTH = sizeof(SimdVector);
+
+#endif
+
+// Returns the position of the first occurrence of the needle in the haystack, or std::string::npos
+size_t find(const std::string_view haystack, const std::string_view needle) {
+  if (needle.empty()) return 0;
+  if (needle.size() > haystack.size()) return std::string::npos;
+
+  auto position = size_t{0};
+#if defined(__AVX2__) || defined(__SSE2__)
+  const auto first = broadcast(needle.front());
+  const auto last = broadcast(needle.back());
+  for (; position + needle.size() - 1 + SIMD_WIDTH <= haystack.size(); position += SIMD_WIDTH) {
+    auto mask = candidate_mask(first, last, haystack.data() + position, needle.size());
+    while (mask != 0) {
+      const auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+      if (std::memcmp(haystack.data() + candidate, needle.data(), needle.size()) == 0) return candidate;
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  // The rest of the haystack, which is too short for a full block
+  const auto* match =
+      ::memmem(haystack.data() + position, haystack.size() - position, needle.data(), needle.size());
+  return match ? static_cast<size_t>(static_cast<const char*>(match) - haystack.data()) : std::string::npos;
+}
+
+}  // namespace
+
+LikeMatcher::LikeMatcher(const std::string& pattern) {
+  _prefix = pattern.substr(0, pattern.find_first_of("%_"));
+
+  if (pattern.find('%') == std::string::npos) {
+    _kind = pattern.find('_') == std::string::npos ? PatternKind::Exact : PatternKind::General;
+    _literal = pattern;
+    _segments = {pattern};
+    _anchored_at_start = true;
+    _anchored_at_end = true;
+    return;
+  }
+
+  auto segment_begin = size_t{0};
+  while (segment_begin <= pattern.size()) {
+    const auto segment_end = std::min(pattern.find('%', segment_begin), pattern.size());
+    if (segment_end > segment_begin) _segments.emplace_back(pattern.substr(segment_begin, segment_end - segment_begin));
+    segment_begin = segment_end + 1;
+  }
+  _anchored_at_start = pattern.front() != '%';
+  _anchored_at_end = pattern.back() != '%';
+
+  if (_segments.empty()) {
+    _kind = PatternKind::MatchAll;
+  } else if (_segments.size() == 1 && _segments.front().find('_') == std::string::npos) {
+    _literal = _segments.front();
+    if (_anchored_at_start) {
+      _kind = PatternKind::Prefix;
+    } else {
+      _kind = _anchored_at_end ? PatternKind::Suffix : PatternKind::Contains;
+    }
+  } else {
+    _kind = PatternKind::General;
+  }
+}
+
+LikeMatcher::PatternKind LikeMatcher::kind() const { return _kind; }
+
+const std::string& LikeMatcher::prefix() const { return _prefix; }
+
+std::string LikeMatcher::prefix_upper_bound(const std::string& prefix) {
+  auto upper_bound = prefix;
+  while (!upper_bound.empty() && static_cast<unsigned char>(upper_bound.back()) == 0xFF) {
+    upper_bound.pop_back();
+  }
+  if (!upper_bound.empty()) {
+    upper_bound.back() = static_cast<char>(static_cast<unsigned char>(upper_bound.back()) + 1);
+  }
+  return upper_bound;
+}
+
+bool LikeMatcher::contains(const std::string_view value, const std::string_view needle) {
+  return find(value, needle) != std::string::npos;
+}
+
+bool LikeMatcher::_matches_at(const std::string_view value, const size_t position, const std::string_view segment) {
+  if (position + segment.size() > value.size()) return false;
+  for (auto index = size_t{0}; index < segment.size(); ++index) {
+    if (segment[index] != '_' && segment[index] != value[position + index]) return false;
+  }
+  return true;
+}
+
+size_t LikeMatcher::_find(const std::string_view value, const size_t begin, const std::string_view segment) {
+  if (segment.find('_') == std::string::npos) {
+    const auto position = find(value.substr(begin), segment);
+    return position == std::string::npos ? position : begin + position;
+  }
+  for (auto position = begin; position + segment.size() <= value.size(); ++position) {
+    if (_matches_at(value, position, segment)) return position;
+  }
+  return std::string::npos;
+}
+
+bool LikeMatcher::_matches_segments(std::string_view value) const {
+  if (_segments.size() == 1 && _anchored_at_start && _anchored_at_end) {
+    return value.size() == _segments.front().size() && _matches_at(value, 0, _segments.front());
+  }
+
+  auto position = size_t{0};
+  auto first_unmatched = size_t{0};
+  auto end_unmatched = _segments.size();
+  if (_anchored_at_start) {
+    if (!_matches_at(value, 0, _segments.front())) return false;
+    position = _segments.front().size();
+    ++first_unmatched;
+  }
+  if (_anchored_at_end) {
+    const auto& segment = _segments.back();
+    // The last segment must not overlap with the first one.
+    if (value.size() < position + segment.size() || !_matches_at(value, value.size() - segment.size(), segment)) {
+      return false;
+    }
+    value.remove_suffix(segment.size());
+    --end_unmatched;
+  }
+
+  // Matching each segment as early as possible leaves the most room for the following ones.
+  for (auto segment_index = first_unmatched; segment_index < end_unmatched; ++segment_index) {
+    const auto match = _find(value, position, _segments[segment_index]);
+    if (match == std::string::npos) return false;
+    position = match + _segments[segment_index].size();
+  }
+  return true;
+}
+
+}  // namespace opossum
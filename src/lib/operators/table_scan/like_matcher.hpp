@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// Decides whether strings match a SQL LIKE pattern, in which % matches any sequence of characters and _ matches a
+// single character. Characters are compared byte by byte, and there is no escape character.
+//
+// The pattern is analyzed once, so that the common patterns are matched by specialized code: 'abc' is compared for
+// equality, 'abc%' and '%abc' with memcmp, and '%abc%' with a SIMD substring search. Other patterns are split at the
+// % signs into segments that are searched for one after another.
+class LikeMatcher {
+ public:
+  enum class PatternKind { Exact, Prefix, Suffix, Contains, MatchAll, General };
+
+  explicit LikeMatcher(const std::string& pattern);
+
+  bool operator()(const std::string_view value) const {
+    switch (_kind) {
+      case PatternKind::Exact:
+        return value == _literal;
+      case PatternKind::Prefix:
+        return value.starts_with(_literal);
+      case PatternKind::Suffix:
+        return value.ends_with(_literal);
+      case PatternKind::Contains:
+        return contains(value, _literal);
+      case PatternKind::MatchAll:
+        return true;
+      case PatternKind::General:
+        return _matches_segments(value);
+    }
+    return false;
+  }
+
+  PatternKind kind() const;
+
+  // Returns the characters before the first wildcard, which all matching strings start with. Scans use it to only
+  // look at the dictionary entries and partitions that begin with it.
+  const std::string& prefix() const;
+
+  // Returns the first string that is larger than all strings that start with the prefix, or an empty string if there
+  // is no such string.
+  static std::string prefix_upper_bound(const std::string& prefix);
+
+  // Returns true if the value contains the needle. Uses AVX2 or SSE2 if available, and memmem, which implements the
+  // Two-Way algorithm, for the rest.
+  static bool contains(std::string_view value, std::string_view needle);
+
+ protected:
+  // Returns true if the segment matches the value at the given position, where _ matches any character
+  static bool _matches_at(std::string_view value, size_t position, std::string_view segment);
+
+  // Returns the position of the first occurrence of the segment in value at or after begin, or std::string::npos
+  static size_t _find(std::string_view value, size_t begin, std::string_view segment);
+
+  bool _matches_segments(std::string_view value) const;
+
+  PatternKind _kind;
+  std::string _literal;
+  std::string _prefix;
+
+  // For General patterns: the parts between the % signs. If the pattern does not start (end) with %, the first
+  // (last) segment has to be at the start (end) of the value.
+  std::vector<std::string> _segments;
+  bool _anchored_at_start = false;
+  bool _anchored_at_end = false;
+};
+
+}  // namespace opossum
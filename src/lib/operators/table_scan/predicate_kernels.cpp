@@ -0,0 +1,630 @@
+#include "predicate_kernels.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "like_matcher.hpp"
+#include "operators/predicate.hpp"
+#include "resolve_type.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/partition_schema.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void SelectionVector::select_all(const ChunkOffset batch_size) {
+  size = batch_size;
+  is_dense = true;
+}
+
+namespace {
+
+// Provides the values of one segment batch by batch. Values of ValueSegments are read in place. Values of other
+// segments, e.g., ReferenceSegments or RunLengthSegments, are gathered into a buffer first, which is cheaper than
+// resolving every row through AllTypeVariant in each predicate that reads the column.
+template <typename T>
+class ColumnReader {
+ public:
+  void set_segment(const std::shared_ptr<const BaseSegment>& segment) {
+    _segment = segment;
+    _value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(_segment);
+
+    // LZ4 segments are read through their decompressed version, which is kept alive until the next segment.
+    if (const auto lz4_segment = std::dynamic_pointer_cast<const LZ4Segment<T>>(_segment)) {
+      _value_segment = lz4_segment->decompress();
+    }
+    _reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(_segment);
+    _run_length_segment = std::dynamic_pointer_cast<const RunLengthSegment<T>>(_segment);
+  }
+
+  const T* values(const ChunkOffset batch_begin, const ChunkOffset batch_size) {
+    if (_value_segment) return _value_segment->values().data() + batch_begin;
+
+    if (_reference_segment) {
+      const auto& pos_list = *_reference_segment->pos_list();
+      const auto& referenced_table = *_reference_segment->referenced_table();
+      const auto referenced_column_id = _reference_segment->referenced_column_id();
+
+      // Consecutive rows of a ValueSegment, e.g., of an EntireChunkPosList, are read in place like the segment itself.
+      if (const auto contiguous_begin = pos_list.contiguous_begin(batch_begin, batch_size)) {
+        const auto referenced_segment =
+            referenced_table.get_chunk(contiguous_begin->chunk_id).get_segment(referenced_column_id);
+        _referenced_value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(referenced_segment);
+        if (const auto lz4_segment = std::dynamic_pointer_cast<const LZ4Segment<T>>(referenced_segment)) {
+          _referenced_value_segment = lz4_segment->decompress();
+        }
+        if (_referenced_value_segment) {
+          return _referenced_value_segment->values().data() + contiguous_begin->chunk_offset;
+        }
+      }
+
+      // Compressed positions are decoded batch by batch.
+      pos_list.copy_positions(batch_begin, batch_size, _positions.data());
+
+      // Positions usually point into few chunks, so the referenced segment is only looked up when the chunk changes.
+      auto cached_chunk_id = ChunkID{std::numeric_limits<ChunkID::base_type>::max()};
+      auto referenced_segment = std::shared_ptr<const BaseSegment>{};
+      auto referenced_values = static_cast<const T*>(nullptr);
+      auto referenced_dictionary_segment = std::shared_ptr<const DictionarySegment<T>>{};
+      for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+        const auto& row_id = _positions[offset];
+        if (row_id.chunk_id != cached_chunk_id) {
+          cached_chunk_id = row_id.chunk_id;
+          referenced_segment = referenced_table.get_chunk(row_id.chunk_id).get_segment(referenced_column_id);
+          auto referenced_value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(referenced_segment);
+          if (const auto lz4_segment = std::dynamic_pointer_cast<const LZ4Segment<T>>(referenced_segment)) {
+            referenced_value_segment = lz4_segment->decompress();
+            referenced_segment = referenced_value_segment;
+          }
+          referenced_values = referenced_value_segment ? referenced_value_segment->values().data() : nullptr;
+          referenced_dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(referenced_segment);
+        }
+        if (referenced_values) {
+          _buffer[offset] = referenced_values[row_id.chunk_offset];
+        } else if (referenced_dictionary_segment) {
+          _buffer[offset] = referenced_dictionary_segment->get(row_id.chunk_offset);
+        } else {
+          _buffer[offset] = get<T>((*referenced_segment)[row_id.chunk_offset]);
+        }
+      }
+      return _buffer.data();
+    }
+
+    if (_run_length_segment) {
+      const auto& end_positions = _run_length_segment->end_positions();
+      const auto& run_values = _run_length_segment->values();
+      auto run = static_cast<size_t>(std::lower_bound(end_positions.cbegin(), end_positions.cend(), batch_begin) -
+                                     end_positions.cbegin());
+      for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+        if (end_positions[run] < batch_begin + offset) ++run;
+        _buffer[offset] = run_values[run];
+      }
+      return _buffer.data();
+    }
+
+    for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+      _buffer[offset] = get<T>((*_segment)[batch_begin + offset]);
+    }
+    return _buffer.data();
+  }
+
+ protected:
+  std::shared_ptr<const BaseSegment> _segment;
+  std::shared_ptr<const ValueSegment<T>> _value_segment;
+  std::shared_ptr<const ReferenceSegment> _reference_segment;
+  std::shared_ptr<const RunLengthSegment<T>> _run_length_segment;
+  // Keeps the referenced segment that values() returned a pointer into alive until the next batch.
+  std::shared_ptr<const ValueSegment<T>> _referenced_value_segment;
+  std::array<RowID, SCAN_BATCH_SIZE> _positions;
+  std::array<T, SCAN_BATCH_SIZE> _buffer;
+};
+
+// The ValueIDs of a DictionarySegment that satisfy a predicate, as the range [begin, end) of ValueIDs, or all
+// ValueIDs outside of it if the range is negated. As the dictionary is sorted, this is possible for all ScanTypes.
+struct ValueIDRange {
+  ValueID::base_type begin;
+  ValueID::base_type end;
+  bool negated;
+};
+
+// Positions of the first dictionary entry >= value and of the first dictionary entry > value. Unlike
+// DictionarySegment::lower_bound and upper_bound, these return the dictionary size instead of INVALID_VALUE_ID.
+template <typename T>
+ValueID::base_type lower_bound_position(const std::vector<T>& dictionary, const T& value) {
+  return static_cast<ValueID::base_type>(std::lower_bound(dictionary.cbegin(), dictionary.cend(), value) -
+                                         dictionary.cbegin());
+}
+
+template <typename T>
+ValueID::base_type upper_bound_position(const std::vector<T>& dictionary, const T& value) {
+  return static_cast<ValueID::base_type>(std::upper_bound(dictionary.cbegin(), dictionary.cend(), value) -
+                                         dictionary.cbegin());
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::equal_to<T>, const T& value) {
+  return {lower_bound_position(dictionary, value), upper_bound_position(dictionary, value), false};
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::not_equal_to<T>, const T& value) {
+  return {lower_bound_position(dictionary, value), upper_bound_position(dictionary, value), true};
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::less<T>, const T& value) {
+  return {0, lower_bound_position(dictionary, value), false};
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::less_equal<T>, const T& value) {
+  return {0, upper_bound_position(dictionary, value), false};
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::greater<T>, const T& value) {
+  return {upper_bound_position(dictionary, value), static_cast<ValueID::base_type>(dictionary.size()), false};
+}
+
+template <typename T>
+ValueIDRange value_id_range(const std::vector<T>& dictionary, std::greater_equal<T>, const T& value) {
+  return {lower_bound_position(dictionary, value), static_cast<ValueID::base_type>(dictionary.size()), false};
+}
+
+template <typename T, typename Comparator>
+struct CompareWithValue {
+  bool operator()(const T& value) const { return Comparator{}(value, search_value); }
+
+  ValueIDRange value_id_range(const std::vector<T>& dictionary) const {
+    return ::opossum::value_id_range(dictionary, Comparator{}, search_value);
+  }
+
+  // Only equality predicates can be decided by a Bloom filter.
+  bool excludes(const BlockedBloomFilter& bloom_filter) const {
+    if constexpr (std::is_same_v<Comparator, std::equal_to<T>>) {
+      return !bloom_filter.may_contain(value_hash(search_value));
+    }
+    return false;
+  }
+
+  bool excludes(const AbstractPartitionSchema& partition_schema, const PartitionID partition_id) const {
+    return !partition_schema.may_match(partition_id, scan_type(), search_value);
+  }
+
+  static constexpr ScanType scan_type() {
+    if constexpr (std::is_same_v<Comparator, std::equal_to<T>>) return ScanType::OpEquals;
+    if constexpr (std::is_same_v<Comparator, std::not_equal_to<T>>) return ScanType::OpNotEquals;
+    if constexpr (std::is_same_v<Comparator, std::less<T>>) return ScanType::OpLessThan;
+    if constexpr (std::is_same_v<Comparator, std::less_equal<T>>) return ScanType::OpLessThanEquals;
+    if constexpr (std::is_same_v<Comparator, std::greater<T>>) return ScanType::OpGreaterThan;
+    return ScanType::OpGreaterThanEquals;
+  }
+
+  const T search_value;
+};
+
+template <typename T>
+struct IsBetween {
+  bool operator()(const T& value) const { return lower_bound <= value && value <= upper_bound; }
+
+  ValueIDRange value_id_range(const std::vector<T>& dictionary) const {
+    const auto begin = lower_bound_position(dictionary, lower_bound);
+    return {begin, std::max(begin, upper_bound_position(dictionary, upper_bound)), false};
+  }
+
+  bool excludes(const BlockedBloomFilter& bloom_filter) const {
+    return lower_bound == upper_bound && !bloom_filter.may_contain(value_hash(lower_bound));
+  }
+
+  bool excludes(const AbstractPartitionSchema& partition_schema, const PartitionID partition_id) const {
+    const auto scan_type = lower_bound == upper_bound ? ScanType::OpEquals : ScanType::OpGreaterThanEquals;
+    return !partition_schema.may_match(partition_id, scan_type, lower_bound) ||
+           !partition_schema.may_match(partition_id, ScanType::OpLessThanEquals, upper_bound);
+  }
+
+  const T lower_bound;
+  const T upper_bound;
+};
+
+// Matches strings against a LIKE pattern, or against NOT LIKE if negated.
+struct MatchesPattern {
+  bool operator()(const std::string& value) const { return like_matcher(value) != negated; }
+
+  // A pattern does not correspond to a range of the dictionary in general, so it is evaluated on each dictionary
+  // entry. Only the entries that start with the prefix of the pattern can match.
+  std::vector<uint8_t> matching_value_ids(const std::vector<std::string>& dictionary) const {
+    auto matching_value_ids = std::vector<uint8_t>(dictionary.size(), negated);
+    const auto& prefix = like_matcher.prefix();
+    const auto upper_bound = LikeMatcher::prefix_upper_bound(prefix);
+    const auto begin = lower_bound_position(dictionary, prefix);
+    const auto end = upper_bound.empty() ? dictionary.size() : lower_bound_position(dictionary, upper_bound);
+    for (auto value_id = begin; value_id < end; ++value_id) {
+      matching_value_ids[value_id] = (*this)(dictionary[value_id]);
+    }
+    return matching_value_ids;
+  }
+
+  bool excludes(const BlockedBloomFilter& bloom_filter) const {
+    return !negated && like_matcher.kind() == LikeMatcher::PatternKind::Exact &&
+           !bloom_filter.may_contain(value_hash(like_matcher.prefix()));
+  }
+
+  bool excludes(const AbstractPartitionSchema& partition_schema, const PartitionID partition_id) const {
+    const auto& prefix = like_matcher.prefix();
+    if (negated || prefix.empty()) return false;
+    const auto upper_bound = LikeMatcher::prefix_upper_bound(prefix);
+    return !partition_schema.may_match(partition_id, ScanType::OpGreaterThanEquals, prefix) ||
+           (!upper_bound.empty() && !partition_schema.may_match(partition_id, ScanType::OpLessThan, upper_bound));
+  }
+
+  const LikeMatcher like_matcher;
+  const bool negated;
+};
+
+// Evaluates a predicate on a single column. Matcher is a functor that decides for one value whether it qualifies.
+// If the table is partitioned by the column, chunks of partitions that cannot hold qualifying values are skipped.
+//
+// On DictionarySegments, the values are not decoded at all. Instead, the matcher translates the predicate into a
+// range of ValueIDs once per segment, which are then compared with the narrow entries of the attribute vector. If the
+// range contains all or none of the ValueIDs, the batches are not even looked at. Matchers whose matches do not form
+// a range, such as LIKE patterns, mark the matching ValueIDs instead.
+template <typename T, typename Matcher>
+class ColumnKernel : public AbstractPredicateKernel {
+ public:
+  static constexpr bool MATCHES_VALUE_IDS_INDIVIDUALLY =
+      requires(const Matcher& matcher, const std::vector<T>& dictionary) { matcher.matching_value_ids(dictionary); };
+
+  ColumnKernel(const ColumnID column_id, Matcher matcher,
+               const std::shared_ptr<const AbstractPartitionSchema>& partition_schema)
+      : _column_id(column_id),
+        _matcher(std::move(matcher)),
+        _partition_schema(partition_schema && partition_schema->column_id() == column_id ? partition_schema
+                                                                                          : nullptr) {}
+
+  void set_chunk(const Chunk& chunk) override {
+    const auto segment = chunk.get_segment(_column_id);
+    _dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment);
+    if (!_dictionary_segment) {
+      _reader.set_segment(segment);
+      return;
+    }
+
+    const auto& dictionary = *_dictionary_segment->dictionary();
+    if constexpr (MATCHES_VALUE_IDS_INDIVIDUALLY) {
+      _matching_value_ids = _matcher.matching_value_ids(dictionary);
+      const auto match_count = std::count(_matching_value_ids.cbegin(), _matching_value_ids.cend(), uint8_t{1});
+      _all_rows_match = static_cast<size_t>(match_count) == dictionary.size();
+      _no_row_matches = match_count == 0;
+      return;
+    } else {
+      _value_id_range = _matcher.value_id_range(dictionary);
+    }
+    const auto range_size = _value_id_range.end - _value_id_range.begin;
+    _all_rows_match = range_size == (_value_id_range.negated ? 0 : dictionary.size());
+    _no_row_matches = range_size == (_value_id_range.negated ? dictionary.size() : 0);
+  }
+
+  bool can_skip_chunk(const Chunk& chunk) const override {
+    const auto partition_id = chunk.partition_id();
+    if (_partition_schema && partition_id && _matcher.excludes(*_partition_schema, *partition_id)) return true;
+    const auto bloom_filter = chunk.bloom_filter(_column_id);
+    return bloom_filter && _matcher.excludes(*bloom_filter);
+  }
+
+  void filter(const ChunkOffset batch_begin, const ChunkOffset batch_size, SelectionVector& selection) override {
+    if (_dictionary_segment) {
+      _filter_dictionary_segment(batch_begin, batch_size, selection);
+    } else {
+      _filter(_reader.values(batch_begin, batch_size), batch_size, selection, _matcher);
+    }
+  }
+
+ protected:
+  // Removes the rows whose value does not satisfy the matcher from the selection. values point to the first value of
+  // the batch.
+  template <typename ValueType, typename ValueMatcher>
+  static void _filter(const ValueType* values, const ChunkOffset batch_size, SelectionVector& selection,
+                      const ValueMatcher& matcher) {
+    auto& offsets = selection.offsets;
+    auto match_count = ChunkOffset{0};
+
+    if (selection.is_dense) {
+      // The comparisons do not depend on each other and write to a separate array, so this loop is vectorized. The
+      // matching offsets are then written without branches.
+      auto matches = std::array<uint8_t, SCAN_BATCH_SIZE>{};
+      for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+        matches[offset] = matcher(values[offset]);
+      }
+      for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+        offsets[match_count] = static_cast<uint16_t>(offset);
+        match_count += matches[offset];
+      }
+    } else {
+      for (auto index = ChunkOffset{0}; index < selection.size; ++index) {
+        const auto offset = offsets[index];
+        offsets[match_count] = offset;
+        match_count += matcher(values[offset]);
+      }
+    }
+
+    selection.size = match_count;
+    selection.is_dense = false;
+  }
+
+  void _filter_dictionary_segment(const ChunkOffset batch_begin, const ChunkOffset batch_size,
+                                  SelectionVector& selection) const {
+    if (_all_rows_match) return;
+    if (_no_row_matches) {
+      selection.size = 0;
+      selection.is_dense = false;
+      return;
+    }
+
+    if constexpr (MATCHES_VALUE_IDS_INDIVIDUALLY) {
+      const auto* matching_value_ids = _matching_value_ids.data();
+      _filter_value_ids(batch_begin, batch_size, selection,
+                        [&](const auto value_id) { return matching_value_ids[value_id] != 0; });
+    } else {
+      // A single unsigned comparison checks both bounds of the range: ValueIDs below begin wrap around to large
+      // values.
+      const auto begin = _value_id_range.begin;
+      const auto range_size = _value_id_range.end - begin;
+      const auto negated = _value_id_range.negated;
+      _filter_value_ids(batch_begin, batch_size, selection, [&](const auto value_id) {
+        return (static_cast<ValueID::base_type>(value_id - begin) < range_size) != negated;
+      });
+    }
+  }
+
+  template <typename ValueIDMatcher>
+  void _filter_value_ids(const ChunkOffset batch_begin, const ChunkOffset batch_size, SelectionVector& selection,
+                         const ValueIDMatcher& matches_value_id) const {
+    const auto& attribute_vector = *_dictionary_segment->attribute_vector();
+    switch (attribute_vector.width()) {
+      case 1:
+        return _filter(_value_ids<uint8_t>(attribute_vector, batch_begin), batch_size, selection, matches_value_id);
+      case 2:
+        return _filter(_value_ids<uint16_t>(attribute_vector, batch_begin), batch_size, selection, matches_value_id);
+      case 4:
+        return _filter(_value_ids<uint32_t>(attribute_vector, batch_begin), batch_size, selection, matches_value_id);
+    }
+    Fail("Unknown attribute vector width");
+  }
+
+  template <typename ValueIDType>
+  static const ValueIDType* _value_ids(const BaseAttributeVector& attribute_vector, const ChunkOffset batch_begin) {
+    return static_cast<const FixedSizeAttributeVector<ValueIDType>&>(attribute_vector).values().data() + batch_begin;
+  }
+
+  const ColumnID _column_id;
+  const Matcher _matcher;
+  const std::shared_ptr<const AbstractPartitionSchema> _partition_schema;
+  ColumnReader<T> _reader;
+
+  std::shared_ptr<const DictionarySegment<T>> _dictionary_segment;
+  ValueIDRange _value_id_range{0, 0, false};
+  std::vector<uint8_t> _matching_value_ids;
+  bool _all_rows_match = false;
+  bool _no_row_matches = false;
+};
+
+// Base class for conjunctions and disjunctions. It records how many rows each child let pass and periodically
+// reorders the children by their observed selectivity, so that the child that decides the most rows runs first.
+class AbstractCompositeKernel : public AbstractPredicateKernel {
+ public:
+  explicit AbstractCompositeKernel(std::vector<std::unique_ptr<AbstractPredicateKernel>> children) {
+    for (auto& child : children) {
+      _children.push_back({std::move(child), 0, 0});
+    }
+  }
+
+  void set_chunk(const Chunk& chunk) override {
+    for (auto& child : _children) {
+      child.kernel->set_chunk(chunk);
+    }
+  }
+
+ protected:
+  struct Child {
+    std::unique_ptr<AbstractPredicateKernel> kernel;
+    uint64_t input_row_count;
+    uint64_t output_row_count;
+
+    double pass_rate() const {
+      return input_row_count == 0 ? 0.5 : static_cast<double>(output_row_count) / input_row_count;
+    }
+  };
+
+  // Sorts the children by ascending (for conjunctions) or descending (for disjunctions) pass rate every few batches.
+  void _reorder_children(const bool most_selective_first) {
+    if (++_batch_count % REORDER_INTERVAL != 0) return;
+    std::stable_sort(_children.begin(), _children.end(), [&](const Child& lhs, const Child& rhs) {
+      return most_selective_first ? lhs.pass_rate() < rhs.pass_rate() : lhs.pass_rate() > rhs.pass_rate();
+    });
+  }
+
+  static constexpr auto REORDER_INTERVAL = size_t{16};
+
+  std::vector<Child> _children;
+  size_t _batch_count = 0;
+};
+
+class AndKernel : public AbstractCompositeKernel {
+ public:
+  using AbstractCompositeKernel::AbstractCompositeKernel;
+
+  bool can_skip_chunk(const Chunk& chunk) const override {
+    return std::any_of(_children.begin(), _children.end(),
+                       [&](const Child& child) { return child.kernel->can_skip_chunk(chunk); });
+  }
+
+  void filter(const ChunkOffset batch_begin, const ChunkOffset batch_size, SelectionVector& selection) override {
+    for (auto& child : _children) {
+      // Once no row is left, the remaining children do not need to run.
+      if (selection.size == 0) break;
+      child.input_row_count += selection.size;
+      child.kernel->filter(batch_begin, batch_size, selection);
+      child.output_row_count += selection.size;
+    }
+    _reorder_children(true);
+  }
+};
+
+class OrKernel : public AbstractCompositeKernel {
+ public:
+  using AbstractCompositeKernel::AbstractCompositeKernel;
+
+  bool can_skip_chunk(const Chunk& chunk) const override {
+    return std::all_of(_children.begin(), _children.end(),
+                       [&](const Child& child) { return child.kernel->can_skip_chunk(chunk); });
+  }
+
+  void filter(const ChunkOffset batch_begin, const ChunkOffset batch_size, SelectionVector& selection) override {
+    // Each child only looks at the rows that no previous child has selected yet.
+    _remaining = selection;
+    _matched.size = 0;
+    _matched.is_dense = false;
+
+    for (auto& child : _children) {
+      if (_remaining.size == 0) break;
+
+      _candidates = _remaining;
+      child.input_row_count += _candidates.size;
+      child.kernel->filter(batch_begin, batch_size, _candidates);
+      child.output_row_count += _candidates.size;
+      if (_candidates.size == 0) continue;
+
+      _merge_candidates(batch_size);
+    }
+
+    selection = _matched;
+    if (selection.size == batch_size) selection.select_all(batch_size);
+    _reorder_children(false);
+  }
+
+ protected:
+  // Adds the candidates to the matched rows and removes them from the remaining rows. All three are sorted.
+  void _merge_candidates(const ChunkOffset batch_size) {
+    if (_remaining.is_dense) {
+      for (auto offset = ChunkOffset{0}; offset < batch_size; ++offset) {
+        _remaining.offsets[offset] = static_cast<uint16_t>(offset);
+      }
+      _remaining.is_dense = false;
+    }
+
+    auto remaining_size = ChunkOffset{0};
+    auto candidate_index = ChunkOffset{0};
+    for (auto index = ChunkOffset{0}; index < _remaining.size; ++index) {
+      const auto offset = _remaining.offsets[index];
+      if (candidate_index < _candidates.size && _candidates.offsets[candidate_index] == offset) {
+        ++candidate_index;
+      } else {
+        _remaining.offsets[remaining_size++] = offset;
+      }
+    }
+    _remaining.size = remaining_size;
+
+    auto merged = std::array<uint16_t, SCAN_BATCH_SIZE>{};
+    const auto merged_end = std::merge(_matched.offsets.begin(), _matched.offsets.begin() + _matched.size,
+                                       _candidates.offsets.begin(), _candidates.offsets.begin() + _candidates.size,
+                                       merged.begin());
+    _matched.size = static_cast<ChunkOffset>(merged_end - merged.begin());
+    std::copy(merged.begin(), merged_end, _matched.offsets.begin());
+  }
+
+  SelectionVector _remaining;
+  SelectionVector _candidates;
+  SelectionVector _matched;
+};
+
+template <typename T>
+std::unique_ptr<AbstractPredicateKernel> compile_comparison(
+    const ColumnID column_id, const ScanType scan_type, const T& value,
+    const std::shared_ptr<const AbstractPartitionSchema>& partition_schema) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::equal_to<T>>>>(
+          column_id, CompareWithValue<T, std::equal_to<T>>{value}, partition_schema);
+    case ScanType::OpNotEquals:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::not_equal_to<T>>>>(
+          column_id, CompareWithValue<T, std::not_equal_to<T>>{value}, partition_schema);
+    case ScanType::OpLessThan:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::less<T>>>>(
+          column_id, CompareWithValue<T, std::less<T>>{value}, partition_schema);
+    case ScanType::OpLessThanEquals:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::less_equal<T>>>>(
+          column_id, CompareWithValue<T, std::less_equal<T>>{value}, partition_schema);
+    case ScanType::OpGreaterThan:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::greater<T>>>>(
+          column_id, CompareWithValue<T, std::greater<T>>{value}, partition_schema);
+    case ScanType::OpGreaterThanEquals:
+      return std::make_unique<ColumnKernel<T, CompareWithValue<T, std::greater_equal<T>>>>(
+          column_id, CompareWithValue<T, std::greater_equal<T>>{value}, partition_schema);
+    case ScanType::OpLike:
+    case ScanType::OpNotLike:
+      if constexpr (std::is_same_v<T, std::string>) {
+        return std::make_unique<ColumnKernel<T, MatchesPattern>>(
+            column_id, MatchesPattern{LikeMatcher{value}, scan_type == ScanType::OpNotLike}, partition_schema);
+      }
+      Fail("LIKE requires a string column");
+  }
+  Fail("Unknown scan type");
+}
+
+}  // namespace
+
+std::unique_ptr<AbstractPredicateKernel> compile_predicate(const Predicate& predicate, const Table& table) {
+  switch (predicate.type()) {
+    case PredicateType::Comparison:
+    case PredicateType::Between: {
+      const auto column_id = predicate.column_id();
+      Assert(column_id < table.column_count(), "Predicate references non-existing column " + std::to_string(column_id));
+      const auto is_like = predicate.type() == PredicateType::Comparison &&
+                           (predicate.scan_type() == ScanType::OpLike || predicate.scan_type() == ScanType::OpNotLike);
+      Assert(!is_like || table.column_type(column_id) == DataType::String, "LIKE requires a string column");
+
+      auto kernel = std::unique_ptr<AbstractPredicateKernel>{};
+      resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto& values = predicate.values();
+        if (predicate.type() == PredicateType::Comparison) {
+          kernel = compile_comparison(column_id, predicate.scan_type(), type_cast<ColumnDataType>(values[0]),
+                                      table.partition_schema());
+        } else {
+          const auto matcher =
+              IsBetween<ColumnDataType>{type_cast<ColumnDataType>(values[0]), type_cast<ColumnDataType>(values[1])};
+          kernel = std::make_unique<ColumnKernel<ColumnDataType, IsBetween<ColumnDataType>>>(column_id, matcher,
+                                                                                             table.partition_schema());
+        }
+      });
+      return kernel;
+    }
+
+    case PredicateType::And:
+    case PredicateType::Or: {
+      auto children = std::vector<std::unique_ptr<AbstractPredicateKernel>>{};
+      for (const auto& child : predicate.children()) {
+        children.emplace_back(compile_predicate(*child, table));
+      }
+      if (children.size() == 1) return std::move(children.front());
+      if (predicate.type() == PredicateType::And) return std::make_unique<AndKernel>(std::move(children));
+      return std::make_unique<OrKernel>(std::move(children));
+    }
+  }
+  Fail("Unknown predicate type");
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Predicate;
+class Table;
+
+// TableScan evaluates predicates on batches of rows so that the selection vector and the values of the current
+// batch stay in the L1 cache while all predicates are applied to them.
+constexpr auto SCAN_BATCH_SIZE = ChunkOffset{2048};
+
+// The rows of the current batch that satisfy all predicates evaluated so far, as ascending offsets relative to the
+// start of the batch. A dense selection contains all rows of the batch without listing them, which lets the first
+// predicate run a tight loop over contiguous values that the compiler turns into SIMD instructions.
+struct SelectionVector {
+  void select_all(ChunkOffset batch_size);
+
+  std::array<uint16_t, SCAN_BATCH_SIZE> offsets;
+  ChunkOffset size = 0;
+  bool is_dense = false;
+};
+
+static_assert(SCAN_BATCH_SIZE <= std::numeric_limits<uint16_t>::max() + 1, "Offsets do not fit into uint16_t");
+
+// A predicate compiled for the data types of the columns of one table. Kernels are stateful (they track the chunk
+// they work on and the selectivity of their children), so each scan compiles its own kernels.
+class AbstractPredicateKernel {
+ public:
+  virtual ~AbstractPredicateKernel() = default;
+
+  // Prepares the kernel for scanning the given chunk of the table it was compiled for.
+  virtual void set_chunk(const Chunk& chunk) = 0;
+
+  // Returns true if no row of the chunk can satisfy the predicate, judging only by metadata of the chunk such as its
+  // Bloom filters. The segments of the chunk are not accessed, so that evicted chunks do not have to be reloaded.
+  virtual bool can_skip_chunk(const Chunk& /*chunk*/) const { return false; }
+
+  // Removes the rows that do not satisfy the predicate from the selection. The batch starts at the given offset of
+  // the current chunk and contains batch_size rows.
+  virtual void filter(ChunkOffset batch_begin, ChunkOffset batch_size, SelectionVector& selection) = 0;
+};
+
+// Compiles the predicate for the given table. Values of the predicate are converted to the column types once here,
+// so that the kernels compare values without going through AllTypeVariant.
+std::unique_ptr<AbstractPredicateKernel> compile_predicate(const Predicate& predicate, const Table& table);
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#include "table_wrapper.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+TableWrapper::TableWrapper(const std::shared_ptr<const Table> table) : _table(table) {}
+
+const std::string& TableWrapper::name() const {
+  static const auto name = std::string{"TableWrapper"};
+  return name;
+}
+
+std::optional<std::string> TableWrapper::fingerprint() const { return std::nullopt; }
+
+std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+}  // namespace opossum
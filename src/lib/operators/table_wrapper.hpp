@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// operator to wrap a table that is not stored in the StorageManager, e.g., as input for other operators in tests
+class TableWrapper : public AbstractOperator {
+ public:
+  explicit TableWrapper(const std::shared_ptr<const Table> table);
+
+  const std::string& name() const override;
+
+  // The wrapped table has no name or version, so results of plans using it are not cached.
+  std::optional<std::string> fingerprint() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::shared_ptr<const Table> _table;
+};
+
+}  // namespace opossum
@@ -0,0 +1,201 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct Candidate {
+  T value;
+  RowID row_id;
+};
+
+// Keeps the best k candidates seen so far. The worst of them is at the top of the heap, so that it can be compared
+// with and replaced by a better candidate in O(log k).
+template <typename T>
+class BoundedHeap {
+ public:
+  BoundedHeap(const size_t k, const OrderByMode order_by_mode) : _k(k), _order_by_mode(order_by_mode) {}
+
+  // Returns whether a row with the value can enter the heap. Rows are added in ascending order of their RowIDs, so a
+  // row whose value equals that of the worst candidate would rank after it.
+  bool admits(const T& value) const {
+    return _candidates.size() < _k || _is_better(value, _candidates.front().value);
+  }
+
+  // Returns whether any row with a value between min and max can enter the heap.
+  bool admits_any(const T& min, const T& max) const {
+    return admits(_order_by_mode == OrderByMode::Ascending ? min : max);
+  }
+
+  void add(const T& value, const RowID row_id) {
+    if (!admits(value)) return;
+    if (_candidates.size() == _k) {
+      std::pop_heap(_candidates.begin(), _candidates.end(), _ranks_before());
+      _candidates.pop_back();
+    }
+    _candidates.push_back({value, row_id});
+    std::push_heap(_candidates.begin(), _candidates.end(), _ranks_before());
+  }
+
+  // Merges the candidates of all heaps and returns the positions of the best k, best first.
+  static PosList merge(std::vector<BoundedHeap>& heaps, const size_t k) {
+    auto candidates = std::vector<Candidate<T>>{};
+    for (auto& heap : heaps) {
+      std::move(heap._candidates.begin(), heap._candidates.end(), std::back_inserter(candidates));
+    }
+    const auto end = candidates.begin() + std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), end, candidates.end(), heaps.front()._ranks_before());
+
+    auto positions = PosList{};
+    positions.reserve(end - candidates.begin());
+    std::transform(candidates.begin(), end, std::back_inserter(positions),
+                   [](const Candidate<T>& candidate) { return candidate.row_id; });
+    return positions;
+  }
+
+ protected:
+  bool _is_better(const T& lhs, const T& rhs) const {
+    return _order_by_mode == OrderByMode::Ascending ? lhs < rhs : rhs < lhs;
+  }
+
+  auto _ranks_before() const {
+    return [this](const Candidate<T>& lhs, const Candidate<T>& rhs) {
+      if (_is_better(lhs.value, rhs.value)) return true;
+      if (_is_better(rhs.value, lhs.value)) return false;
+      return lhs.row_id < rhs.row_id;
+    };
+  }
+
+  const size_t _k;
+  const OrderByMode _order_by_mode;
+  std::vector<Candidate<T>> _candidates;
+};
+
+// Adds the rows of one chunk to the heap. Returns false if the chunk was skipped.
+template <typename T>
+bool add_chunk(const Table& table, const ChunkID chunk_id, const ColumnID column_id, BoundedHeap<T>& heap) {
+  const auto& chunk = table.get_chunk(chunk_id);
+  if (chunk.size() == 0 || chunk.column_count() == 0) return true;
+
+  const auto segment = chunk.get_segment(column_id);
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    // The dictionary is sorted, so its first and last values bound the values of the chunk, like a zone map.
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if (!heap.admits_any(dictionary.front(), dictionary.back())) return false;
+  }
+
+  const auto add_values = [&](const std::vector<T>& values) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      heap.add(values[chunk_offset], RowID{chunk_id, chunk_offset});
+    }
+  };
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    add_values(value_segment->values());
+  } else {
+    add_values(materialize_values<T>(*segment));
+  }
+  return true;
+}
+
+template <typename T>
+PosList top_k_positions(const Table& table, const ColumnID column_id, const OrderByMode order_by_mode, const size_t k,
+                        OperatorPerformanceData& performance_data) {
+  const auto chunk_count = table.chunk_count();
+  const auto worker_count = std::max(size_t{1}, std::min<size_t>(std::thread::hardware_concurrency(), chunk_count));
+  auto heaps = std::vector<BoundedHeap<T>>(worker_count, BoundedHeap<T>{k, order_by_mode});
+
+  // Each worker takes the next chunk that nobody has taken yet, so the chunks of a worker have ascending ChunkIDs.
+  auto next_chunk_id = std::atomic<ChunkID::base_type>{0};
+  auto skipped_chunk_count = std::atomic<uint64_t>{0};
+  auto exceptions = std::vector<std::exception_ptr>(worker_count);
+  const auto work = [&](const size_t worker_id) {
+    const auto trace_scope = TraceScope{"TopK worker", TraceCategory::Task};
+    try {
+      for (auto chunk_id = ChunkID{next_chunk_id++}; chunk_id < chunk_count; chunk_id = ChunkID{next_chunk_id++}) {
+        const auto chunk_trace_scope = TraceScope{"TopK", TraceCategory::Chunk, chunk_id};
+        if (!add_chunk(table, chunk_id, column_id, heaps[worker_id])) ++skipped_chunk_count;
+      }
+    } catch (...) {
+      exceptions[worker_id] = std::current_exception();
+    }
+  };
+
+  auto threads = std::vector<std::thread>{};
+  for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+    threads.emplace_back(work, worker_id);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  performance_data.chunks_total = chunk_count;
+  performance_data.chunks_skipped = skipped_chunk_count;
+  return BoundedHeap<T>::merge(heaps, k);
+}
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& input, const ColumnID column_id,
+           const OrderByMode order_by_mode, const size_t k)
+    : AbstractOperator(input), _column_id(column_id), _order_by_mode(order_by_mode), _k(k) {}
+
+ColumnID TopK::column_id() const { return _column_id; }
+
+OrderByMode TopK::order_by_mode() const { return _order_by_mode; }
+
+size_t TopK::k() const { return _k; }
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description() const {
+  return name() + " (" + std::to_string(_k) + " by #" + std::to_string(_column_id) +
+         (_order_by_mode == OrderByMode::Ascending ? " ASC" : " DESC") + ")";
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(_column_id < input_table->column_count(), "TopK references non-existing column " + std::to_string(_column_id));
+
+  auto output = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  if (_k == 0) return output;
+
+  auto positions = PosList{};
+  resolve_data_type(input_table->column_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    positions = top_k_positions<ColumnDataType>(*input_table, _column_id, _order_by_mode, _k, _performance_data);
+  });
+
+  if (!positions.empty()) output->emplace_chunk(create_reference_chunk(input_table, positions));
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the k rows of its input with the smallest (Ascending) or largest (Descending) values in one column, in that
+// order. Rows with equal values are ordered by their position in the input, so the result is deterministic. The
+// output consists of reference segments, like that of a TableScan.
+//
+// Instead of sorting the whole input, the chunks are distributed over several threads, each of which keeps the best
+// k rows it has seen in a bounded heap. Values that cannot enter the heap are discarded with a single comparison, and
+// chunks whose best value, known from the sorted dictionary of a DictionarySegment, cannot enter it are skipped
+// without looking at their rows. The heaps are merged at the end.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& input, ColumnID column_id, OrderByMode order_by_mode, size_t k);
+
+  ColumnID column_id() const;
+  OrderByMode order_by_mode() const;
+  size_t k() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  const size_t _k;
+};
+
+}  // namespace opossum
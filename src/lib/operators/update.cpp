@@ -0,0 +1,49 @@
+#include "update.hpp"
+
+#include <memory>
+#include <string>
+
+#include "delete.hpp"
+#include "insert.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Update::Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+               const std::shared_ptr<const AbstractOperator>& updated_values)
+    : AbstractReadWriteOperator(rows_to_update, updated_values), _table_name(table_name) {}
+
+const std::string& Update::table_name() const { return _table_name; }
+
+const std::string& Update::name() const {
+  static const auto name = std::string{"Update"};
+  return name;
+}
+
+std::string Update::description() const { return name() + " (" + _table_name + ")"; }
+
+std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionContext> context) {
+  Assert(_left_input_table()->row_count() == _right_input_table()->row_count(),
+         "Update requires as many new values as rows to update");
+
+  const auto delete_operator = std::make_shared<Delete>(_table_name, _left_input);
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+  if (delete_operator->execute_failed()) {
+    _mark_as_failed();
+    return nullptr;
+  }
+
+  const auto insert = std::make_shared<Insert>(_table_name, _right_input);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  return nullptr;
+}
+
+void Update::_on_commit_records(const CommitID /*commit_id*/) {}
+
+void Update::_on_rollback_records() {}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_write_operator.hpp"
+
+namespace opossum {
+
+// Replaces rows of the table with the given name. The left input references the rows to update (see Delete), the
+// right input holds their new values, i.e., complete rows in the schema of the table.
+//
+// As rows are never modified in place, an update is a Delete of the old rows followed by an Insert of the new ones
+// within the same transaction. Both register with the transaction themselves and are committed or rolled back with
+// it.
+class Update : public AbstractReadWriteOperator {
+ public:
+  Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+         const std::shared_ptr<const AbstractOperator>& updated_values);
+
+  const std::string& table_name() const;
+
+  const std::string& name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+
+  // The changes are owned by the Delete and Insert operators.
+  void _on_commit_records(CommitID commit_id) override;
+  void _on_rollback_records() override;
+
+  const std::string _table_name;
+};
+
+}  // namespace opossum
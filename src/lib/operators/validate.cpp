@@ -0,0 +1,125 @@
+#include "validate.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool is_visible(const TransactionContext& context, const MvccData& mvcc_data, const ChunkOffset chunk_offset) {
+  // The transaction ID is read first, see Insert::_on_commit_records.
+  const auto row_transaction_id = mvcc_data.tids[chunk_offset].load();
+  return Validate::is_row_visible(context.transaction_id(), context.snapshot_commit_id(), row_transaction_id,
+                                  mvcc_data.begin_cids[chunk_offset], mvcc_data.end_cids[chunk_offset]);
+}
+
+}  // namespace
+
+Validate::Validate(const std::shared_ptr<const AbstractOperator>& input) : AbstractOperator(input) {}
+
+const std::string& Validate::name() const {
+  static const auto name = std::string{"Validate"};
+  return name;
+}
+
+std::optional<std::string> Validate::fingerprint() const { return std::nullopt; }
+
+bool Validate::is_row_visible(const TransactionID our_transaction_id, const CommitID snapshot_commit_id,
+                              const TransactionID row_transaction_id, const CommitID begin_commit_id,
+                              const CommitID end_commit_id) {
+  const auto own_insert = our_transaction_id == row_transaction_id && !(begin_commit_id <= snapshot_commit_id) &&
+                          !(end_commit_id <= snapshot_commit_id);
+  const auto past_insert = our_transaction_id != row_transaction_id && begin_commit_id <= snapshot_commit_id &&
+                           !(end_commit_id <= snapshot_commit_id);
+  return own_insert || past_insert;
+}
+
+std::shared_ptr<const Table> Validate::_on_execute() {
+  const auto context = transaction_context();
+  Assert(context, "Validate must be executed within a transaction");
+
+  const auto input_table = _left_input_table();
+  auto output = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    // The ChunkCompactor might remove the chunk meanwhile, so it is held by pointer.
+    const auto chunk_ptr = input_table->get_chunk_ptr(chunk_id);
+    const auto& chunk = *chunk_ptr;
+    // Compacted chunks do not contain rows visible to us. Their data might already be gone.
+    if (chunk.cleanup_commit_id() <= context->snapshot_commit_id()) continue;
+    if (chunk.column_count() == 0) continue;
+
+    auto output_chunk = Chunk{};
+
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+    if (reference_segment) {
+      // All segments of a chunk of references share the positions, so we filter them once and reuse the result.
+      const auto referenced_table = reference_segment->referenced_table();
+      auto positions = PosList{};
+      auto current_chunk_id = std::optional<ChunkID>{};
+      auto mvcc_data = std::shared_ptr<const MvccData>{};
+      reference_segment->pos_list()->for_each([&](const RowID& row_id) {
+        if (row_id.chunk_id != current_chunk_id) {
+          current_chunk_id = row_id.chunk_id;
+          // The positions might have been created before the referenced chunk was compacted and removed. As for the
+          // chunks of the input, its rows are not visible to us then. Holding the MvccData keeps it alive meanwhile.
+          const auto referenced_chunk = referenced_table->get_chunk_ptr(row_id.chunk_id);
+          Assert(referenced_chunk->has_mvcc_data(), "Validate requires the referenced table to use MVCC");
+          mvcc_data = referenced_chunk->cleanup_commit_id() <= context->snapshot_commit_id()
+                          ? nullptr
+                          : referenced_chunk->mvcc_data();
+        }
+        // Rows beyond the size of the MVCC data are not visible to us, see below.
+        if (!mvcc_data || row_id.chunk_offset >= mvcc_data->size()) return;
+        if (is_visible(*context, *mvcc_data, row_id.chunk_offset)) positions.emplace_back(row_id);
+      });
+      if (positions.empty()) continue;
+
+      const auto pos_list = make_pos_list(std::move(positions));
+
+      for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+        const auto segment = std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(segment->referenced_table(),
+                                                                    segment->referenced_column_id(), pos_list));
+      }
+    } else {
+      const auto mvcc_data = chunk.mvcc_data();
+      Assert(mvcc_data, "Validate requires a table that uses MVCC");
+
+      // Rows beyond the size of the MVCC data might still be written and are not visible to us anyway.
+      const auto row_count = mvcc_data->size();
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (is_visible(*context, *mvcc_data, chunk_offset)) chunk_offsets.emplace_back(chunk_offset);
+      }
+      if (chunk_offsets.empty()) continue;
+
+      // Usually, all rows are visible, which is stored as an EntireChunkPosList.
+      const auto pos_list = make_pos_list(chunk_id, chunk_offsets);
+
+      for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      }
+    }
+
+    output->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Filters out the rows of its input that are not visible to the transaction the operator is executed in.
+//
+// The input is either a table that uses MVCC or a table of reference segments pointing into one. The output consists
+// of reference segments to the visible rows. Validate does not lock the table: It only looks at rows whose MVCC
+// entries were published before it reached their chunk, and the snapshot commit ID of the transaction guarantees
+// that later commits do not change the result.
+class Validate : public AbstractOperator {
+ public:
+  explicit Validate(const std::shared_ptr<const AbstractOperator>& input);
+
+  const std::string& name() const override;
+
+  // The result depends on the snapshot of the transaction, so it is not cached.
+  std::optional<std::string> fingerprint() const override;
+
+  // A row is visible if it was inserted by the transaction itself and not deleted yet, or if it was committed before
+  // the snapshot of the transaction and neither deleted before the snapshot nor by the transaction itself.
+  static bool is_row_visible(TransactionID our_transaction_id, CommitID snapshot_commit_id,
+                             TransactionID row_transaction_id, CommitID begin_commit_id, CommitID end_commit_id);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include "client.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/binary_serialization.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Client::Client(const std::filesystem::path& socket_path) {
+  auto address = sockaddr_un{};
+  address.sun_family = AF_UNIX;
+  Assert(socket_path.native().size() < sizeof(address.sun_path),
+         "Socket path " + socket_path.string() + " is too long");
+  std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  _file_descriptor = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  Assert(_file_descriptor >= 0, "Cannot create socket: " + std::string{std::strerror(errno)});
+  if (::connect(_file_descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+    const auto error = std::string{std::strerror(errno)};
+    ::close(_file_descriptor);
+    Fail("Cannot connect to " + socket_path.string() + ": " + error);
+  }
+}
+
+Client::~Client() { ::close(_file_descriptor); }
+
+std::shared_ptr<Table> Client::query(const QueryRequest& request,
+                                     const std::function<void(const Table& schema, Chunk&& chunk)>& on_chunk) {
+  _write(make_frame(MessageType::Query, serialize_query(request)));
+
+  auto schema = std::shared_ptr<Table>{};
+  auto row_count = uint64_t{0};
+  while (true) {
+    const auto header = read_frame_header(_read(FRAME_HEADER_SIZE).data());
+    Assert(header.payload_size <= MAX_PAYLOAD_SIZE, "Received a malformed frame");
+    const auto payload = _read(header.payload_size);
+    switch (header.message_type) {
+      case MessageType::Schema:
+        schema = deserialize_schema(payload);
+        break;
+      case MessageType::Chunk: {
+        Assert(schema, "Received a chunk before the schema");
+        auto chunk = deserialize_chunk(*schema, payload);
+        row_count += chunk.size();
+        on_chunk(*schema, std::move(chunk));
+        break;
+      }
+      case MessageType::Done: {
+        auto stream = std::istringstream{payload};
+        Assert(schema && read_value<uint64_t>(stream) == row_count, "Received an incomplete result");
+        return schema;
+      }
+      case MessageType::Error:
+        Fail("Query failed on the server: " + payload);
+      default:
+        Fail("Received an unexpected message");
+    }
+  }
+}
+
+std::shared_ptr<Table> Client::query(const QueryRequest& request) {
+  auto chunks = std::vector<Chunk>{};
+  const auto result =
+      query(request, [&](const Table& /*schema*/, Chunk&& chunk) { chunks.emplace_back(std::move(chunk)); });
+  for (auto& chunk : chunks) {
+    result->emplace_chunk(std::move(chunk));
+  }
+  return result;
+}
+
+void Client::_write(const std::string& data) {
+  auto written_size = size_t{0};
+  while (written_size < data.size()) {
+    const auto size = ::send(_file_descriptor, data.data() + written_size, data.size() - written_size, MSG_NOSIGNAL);
+    if (size < 0 && errno == EINTR) continue;
+    Assert(size > 0, "Cannot send to the server: " + std::string{std::strerror(errno)});
+    written_size += static_cast<size_t>(size);
+  }
+}
+
+std::string Client::_read(const size_t size) {
+  auto data = std::string(size, '\0');
+  auto read_size = size_t{0};
+  while (read_size < size) {
+    const auto received_size = ::recv(_file_descriptor, data.data() + read_size, size - read_size, 0);
+    if (received_size < 0 && errno == EINTR) continue;
+    Assert(received_size > 0, "Connection to the server was closed");
+    read_size += static_cast<size_t>(received_size);
+  }
+  return data;
+}
+
+}  // namespace opossum
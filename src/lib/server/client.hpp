@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+#include "wire_protocol.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// A blocking connection to a Server, e.g., for tools and tests. A Client must only be used by one thread at a time.
+class Client : private Noncopyable {
+ public:
+  // Connects to the server listening on the socket
+  explicit Client(const std::filesystem::path& socket_path);
+  ~Client();
+
+  // Sends the query and calls on_chunk with each chunk of the result as soon as it arrived. Returns a table with the
+  // column definitions of the result, but without rows, which is also passed to on_chunk. Fails with the message of
+  // the server if the query failed.
+  std::shared_ptr<Table> query(const QueryRequest& request,
+                               const std::function<void(const Table& schema, Chunk&& chunk)>& on_chunk);
+
+  // Sends the query and returns the complete result
+  std::shared_ptr<Table> query(const QueryRequest& request);
+
+ protected:
+  // Blocks until the message was written or received completely
+  void _write(const std::string& data);
+  std::string _read(size_t size);
+
+  int _file_descriptor = -1;
+};
+
+}  // namespace opossum
@@ -0,0 +1,407 @@
+#include "server.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/result_cache.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+#include "wire_protocol.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Frames are handed to the kernel in batches of up to this many, so that small frames do not cost a syscall each
+constexpr auto MAX_FRAMES_PER_WRITE = size_t{16};
+
+constexpr auto READ_BUFFER_SIZE = size_t{64} * 1024;
+
+void register_file_descriptor(const int epoll_file_descriptor, const int operation, const int file_descriptor,
+                              const uint32_t events) {
+  auto event = epoll_event{};
+  event.events = events;
+  event.data.fd = file_descriptor;
+  Assert(::epoll_ctl(epoll_file_descriptor, operation, file_descriptor, &event) == 0,
+         "epoll_ctl failed: " + std::string{std::strerror(errno)});
+}
+
+}  // namespace
+
+struct Server::Connection {
+  explicit Connection(const int init_file_descriptor) : file_descriptor(init_file_descriptor) {}
+
+  const int file_descriptor;
+
+  // Only accessed by the event loop: The bytes received but not parsed into frames yet, and whether epoll reports
+  // that the socket became writable again
+  std::string input;
+  bool waits_for_writability = false;
+
+  // Guards the remaining members
+  std::mutex mutex;
+  std::condition_variable output_drained;
+
+  // The frames to be written. The first written_size bytes of the first frame were written already. output_size
+  // counts the bytes that are left.
+  std::deque<std::string> output;
+  size_t written_size = 0;
+  size_t output_size = 0;
+
+  // The payloads of the queries that were received but not executed yet, and whether the connection was handed to
+  // the workers for them
+  std::deque<std::string> queries;
+  bool is_scheduled = false;
+
+  bool is_closed = false;
+};
+
+Server::Server(std::filesystem::path socket_path, const size_t worker_count)
+    : _socket_path(std::move(socket_path)), _worker_count(worker_count) {
+  Assert(_worker_count > 0, "Server needs at least one worker");
+}
+
+Server::~Server() { stop(); }
+
+void Server::start() {
+  Assert(!_is_running, "Server is already running");
+  auto address = sockaddr_un{};
+  address.sun_family = AF_UNIX;
+  Assert(_socket_path.native().size() < sizeof(address.sun_path),
+         "Socket path " + _socket_path.string() + " is too long");
+  std::strncpy(address.sun_path, _socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  _listen_file_descriptor = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  Assert(_listen_file_descriptor >= 0, "Cannot create socket: " + std::string{std::strerror(errno)});
+  std::filesystem::remove(_socket_path);
+  Assert(::bind(_listen_file_descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0,
+         "Cannot bind socket to " + _socket_path.string() + ": " + std::strerror(errno));
+  Assert(::listen(_listen_file_descriptor, SOMAXCONN) == 0, "Cannot listen on " + _socket_path.string());
+
+  _epoll_file_descriptor = ::epoll_create1(EPOLL_CLOEXEC);
+  Assert(_epoll_file_descriptor >= 0, "Cannot create epoll instance");
+  _wake_up_file_descriptor = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  Assert(_wake_up_file_descriptor >= 0, "Cannot create eventfd");
+  register_file_descriptor(_epoll_file_descriptor, EPOLL_CTL_ADD, _listen_file_descriptor, EPOLLIN);
+  register_file_descriptor(_epoll_file_descriptor, EPOLL_CTL_ADD, _wake_up_file_descriptor, EPOLLIN);
+
+  _stop_workers = false;
+  _is_running = true;
+  _event_loop_thread = std::thread{&Server::_event_loop, this};
+  for (auto worker_index = size_t{0}; worker_index < _worker_count; ++worker_index) {
+    _workers.emplace_back(&Server::_worker_loop, this);
+  }
+}
+
+void Server::stop() {
+  if (!_is_running) return;
+
+  // The event loop checks _is_running whenever it wakes up and closes the connections on its way out, which
+  // unblocks workers waiting for their output to drain.
+  _is_running = false;
+  const auto value = uint64_t{1};
+  Assert(::write(_wake_up_file_descriptor, &value, sizeof(value)) == sizeof(value), "Cannot wake up event loop");
+  _event_loop_thread.join();
+
+  {
+    const auto lock = std::lock_guard{_task_mutex};
+    _stop_workers = true;
+    _tasks.clear();
+  }
+  _task_available.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+
+  {
+    const auto lock = std::lock_guard{_wake_up_mutex};
+    _connections_to_write.clear();
+  }
+  ::close(_wake_up_file_descriptor);
+  ::close(_epoll_file_descriptor);
+  ::close(_listen_file_descriptor);
+  _listen_file_descriptor = -1;
+  _epoll_file_descriptor = -1;
+  _wake_up_file_descriptor = -1;
+  std::filesystem::remove(_socket_path);
+}
+
+bool Server::is_running() const { return _is_running; }
+
+const std::filesystem::path& Server::socket_path() const { return _socket_path; }
+
+uint64_t Server::connection_count() const { return _connection_count; }
+
+uint64_t Server::query_count() const { return _query_count; }
+
+void Server::_event_loop() {
+  auto events = std::array<epoll_event, 64>{};
+  while (_is_running) {
+    const auto event_count = ::epoll_wait(_epoll_file_descriptor, events.data(), static_cast<int>(events.size()), -1);
+    if (event_count < 0) {
+      Assert(errno == EINTR, "epoll_wait failed: " + std::string{std::strerror(errno)});
+      continue;
+    }
+
+    for (auto event_index = 0; event_index < event_count; ++event_index) {
+      const auto file_descriptor = events[event_index].data.fd;
+      if (file_descriptor == _listen_file_descriptor) {
+        _accept_connections();
+      } else if (file_descriptor == _wake_up_file_descriptor) {
+        auto value = uint64_t{};
+        [[maybe_unused]] const auto read_size = ::read(_wake_up_file_descriptor, &value, sizeof(value));
+        auto connections = std::vector<std::shared_ptr<Connection>>{};
+        {
+          const auto lock = std::lock_guard{_wake_up_mutex};
+          connections.swap(_connections_to_write);
+        }
+        for (const auto& connection : connections) {
+          _write(connection);
+        }
+      } else {
+        // The connection might have been closed while handling an earlier event.
+        const auto connection_iter = _connections.find(file_descriptor);
+        if (connection_iter == _connections.end()) continue;
+        const auto connection = connection_iter->second;
+        if (events[event_index].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) _read(connection);
+        if (events[event_index].events & EPOLLOUT) _write(connection);
+      }
+    }
+  }
+
+  while (!_connections.empty()) {
+    const auto connection = _connections.begin()->second;
+    _close(connection);
+  }
+}
+
+void Server::_worker_loop() {
+  while (true) {
+    auto connection = std::shared_ptr<Connection>{};
+    {
+      auto lock = std::unique_lock{_task_mutex};
+      _task_available.wait(lock, [&]() { return _stop_workers || !_tasks.empty(); });
+      if (_stop_workers) return;
+      connection = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+
+    auto payload = std::string{};
+    {
+      const auto lock = std::lock_guard{connection->mutex};
+      if (connection->is_closed) continue;
+      payload = std::move(connection->queries.front());
+      connection->queries.pop_front();
+    }
+    ++_query_count;
+    _execute_query(connection, payload);
+
+    // The connection goes to the back of the queue for its next query, so that connections with many queries do not
+    // starve the others.
+    {
+      const auto lock = std::lock_guard{connection->mutex};
+      if (connection->is_closed || connection->queries.empty()) {
+        connection->is_scheduled = false;
+        continue;
+      }
+    }
+    const auto lock = std::lock_guard{_task_mutex};
+    _tasks.emplace_back(std::move(connection));
+  }
+}
+
+void Server::_accept_connections() {
+  while (true) {
+    const auto file_descriptor = ::accept4(_listen_file_descriptor, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (file_descriptor < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      // No more pending connections, or too many open files, in which case the remaining connections are accepted
+      // once others were closed.
+      return;
+    }
+    register_file_descriptor(_epoll_file_descriptor, EPOLL_CTL_ADD, file_descriptor, EPOLLIN);
+    _connections.emplace(file_descriptor, std::make_shared<Connection>(file_descriptor));
+    ++_connection_count;
+  }
+}
+
+void Server::_read(const std::shared_ptr<Connection>& connection) {
+  auto buffer = std::array<char, READ_BUFFER_SIZE>{};
+  while (true) {
+    const auto read_size = ::read(connection->file_descriptor, buffer.data(), buffer.size());
+    if (read_size > 0) {
+      connection->input.append(buffer.data(), static_cast<size_t>(read_size));
+      continue;
+    }
+    if (read_size < 0 && errno == EINTR) continue;
+    if (read_size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    // The client closed the connection, or it failed
+    _close(connection);
+    return;
+  }
+
+  auto& input = connection->input;
+  auto offset = size_t{0};
+  auto queries = std::vector<std::string>{};
+  while (input.size() - offset >= FRAME_HEADER_SIZE) {
+    const auto header = read_frame_header(input.data() + offset);
+    if (header.message_type != MessageType::Query || header.payload_size > MAX_PAYLOAD_SIZE) {
+      // Clients only send queries, anything else means that the client and the server are out of sync.
+      _close(connection);
+      return;
+    }
+    if (input.size() - offset - FRAME_HEADER_SIZE < header.payload_size) break;
+    queries.emplace_back(input, offset + FRAME_HEADER_SIZE, header.payload_size);
+    offset += FRAME_HEADER_SIZE + header.payload_size;
+  }
+  input.erase(0, offset);
+  if (queries.empty()) return;
+
+  auto schedule = false;
+  {
+    const auto lock = std::lock_guard{connection->mutex};
+    std::move(queries.begin(), queries.end(), std::back_inserter(connection->queries));
+    schedule = !connection->is_scheduled;
+    connection->is_scheduled = true;
+  }
+  if (!schedule) return;
+  {
+    const auto lock = std::lock_guard{_task_mutex};
+    _tasks.emplace_back(connection);
+  }
+  _task_available.notify_one();
+}
+
+void Server::_write(const std::shared_ptr<Connection>& connection) {
+  auto would_block = false;
+  auto failed = false;
+  {
+    const auto lock = std::lock_guard{connection->mutex};
+    if (connection->is_closed) return;
+
+    auto& output = connection->output;
+    while (!output.empty()) {
+      auto buffers = std::array<iovec, MAX_FRAMES_PER_WRITE>{};
+      auto buffer_count = size_t{0};
+      for (auto frame = output.begin(); frame != output.end() && buffer_count < buffers.size(); ++frame) {
+        const auto offset = buffer_count == 0 ? connection->written_size : size_t{0};
+        buffers[buffer_count].iov_base = frame->data() + offset;
+        buffers[buffer_count].iov_len = frame->size() - offset;
+        ++buffer_count;
+      }
+      auto message = msghdr{};
+      message.msg_iov = buffers.data();
+      message.msg_iovlen = buffer_count;
+      // MSG_NOSIGNAL reports a closed connection as an error instead of raising SIGPIPE.
+      const auto written_size = ::sendmsg(connection->file_descriptor, &message, MSG_NOSIGNAL);
+      if (written_size < 0) {
+        if (errno == EINTR) continue;
+        would_block = errno == EAGAIN || errno == EWOULDBLOCK;
+        failed = !would_block;
+        break;
+      }
+
+      auto remaining_size = static_cast<size_t>(written_size);
+      connection->output_size -= remaining_size;
+      while (remaining_size > 0) {
+        const auto unwritten_size = output.front().size() - connection->written_size;
+        if (remaining_size < unwritten_size) {
+          connection->written_size += remaining_size;
+          break;
+        }
+        remaining_size -= unwritten_size;
+        output.pop_front();
+        connection->written_size = 0;
+      }
+    }
+  }
+  connection->output_drained.notify_all();
+
+  if (failed) {
+    _close(connection);
+    return;
+  }
+  // Only wait for the socket to become writable while there is output left, as epoll would report it all the time.
+  if (would_block != connection->waits_for_writability) {
+    connection->waits_for_writability = would_block;
+    register_file_descriptor(_epoll_file_descriptor, EPOLL_CTL_MOD, connection->file_descriptor,
+                             would_block ? EPOLLIN | EPOLLOUT : EPOLLIN);
+  }
+}
+
+void Server::_close(const std::shared_ptr<Connection>& connection) {
+  ::epoll_ctl(_epoll_file_descriptor, EPOLL_CTL_DEL, connection->file_descriptor, nullptr);
+  ::close(connection->file_descriptor);
+  _connections.erase(connection->file_descriptor);
+  {
+    const auto lock = std::lock_guard{connection->mutex};
+    connection->is_closed = true;
+    connection->output.clear();
+    connection->output_size = 0;
+    connection->queries.clear();
+  }
+  connection->output_drained.notify_all();
+}
+
+void Server::_execute_query(const std::shared_ptr<Connection>& connection, const std::string& payload) {
+  const auto trace_scope = TraceScope{"Query", TraceCategory::Task};
+  try {
+    const auto request = deserialize_query(payload);
+    auto plan = std::shared_ptr<AbstractOperator>{std::make_shared<GetTable>(request.table_name)};
+    if (request.predicate) plan = std::make_shared<TableScan>(plan, request.predicate);
+    if (request.limit) plan = std::make_shared<Limit>(plan, *request.limit);
+    const auto table = ResultCache::get().execute(plan);
+
+    if (!_send(connection, make_frame(MessageType::Schema, serialize_schema(*table)))) return;
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id).size() == 0) continue;
+      if (!_send(connection, make_frame(MessageType::Chunk, serialize_chunk(*table, chunk_id)))) return;
+    }
+    auto done_payload = std::ostringstream{};
+    write_value(done_payload, static_cast<uint64_t>(table->row_count()));
+    _send(connection, make_frame(MessageType::Done, done_payload.str()));
+  } catch (const std::exception& exception) {
+    _send(connection, make_frame(MessageType::Error, exception.what()));
+  }
+}
+
+bool Server::_send(const std::shared_ptr<Connection>& connection, std::string frame) {
+  {
+    auto lock = std::unique_lock{connection->mutex};
+    connection->output_drained.wait(
+        lock, [&]() { return connection->is_closed || connection->output_size < MAX_BUFFERED_BYTES; });
+    if (connection->is_closed) return false;
+    connection->output_size += frame.size();
+    connection->output.emplace_back(std::move(frame));
+  }
+
+  {
+    const auto lock = std::lock_guard{_wake_up_mutex};
+    _connections_to_write.emplace_back(connection);
+  }
+  const auto value = uint64_t{1};
+  [[maybe_unused]] const auto written_size = ::write(_wake_up_file_descriptor, &value, sizeof(value));
+  return true;
+}
+
+}  // namespace opossum
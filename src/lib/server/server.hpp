@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Answers queries (see QueryRequest) on the tables of the StorageManager for clients in other processes, which
+// connect via a Unix domain socket. This way, the data is loaded once and stays resident, instead of each client tool
+// loading its own copy.
+//
+// A single event loop thread multiplexes all connections with epoll: It accepts connections, reads requests, and
+// writes responses, all on non-blocking sockets. Queries are executed by a pool of worker threads via the
+// ResultCache. A worker sends the result as it serializes it, one frame per chunk (see wire_protocol.hpp), by handing
+// the frames to the event loop. If a client reads slower than the worker produces, the worker blocks once
+// MAX_BUFFERED_BYTES frames are waiting for the connection, so the memory used per connection stays bounded.
+//
+// The queries of one connection are answered one after another, in the order they arrived, while queries of
+// different connections run in parallel.
+class Server : private Noncopyable {
+ public:
+  explicit Server(std::filesystem::path socket_path, size_t worker_count = std::thread::hardware_concurrency());
+  ~Server();
+
+  // Creates the socket (replacing an existing file at its path) and starts the event loop and the workers
+  void start();
+
+  // Closes all connections and the socket. Queries that are being executed are finished, but their results are
+  // dropped.
+  void stop();
+
+  bool is_running() const;
+  const std::filesystem::path& socket_path() const;
+
+  // The number of connections accepted and of queries whose execution started since the server was created
+  uint64_t connection_count() const;
+  uint64_t query_count() const;
+
+  static constexpr auto MAX_BUFFERED_BYTES = size_t{16} * 1024 * 1024;
+
+ protected:
+  struct Connection;
+
+  void _event_loop();
+  void _worker_loop();
+
+  // Called by the event loop
+  void _accept_connections();
+  void _read(const std::shared_ptr<Connection>& connection);
+  void _write(const std::shared_ptr<Connection>& connection);
+  void _close(const std::shared_ptr<Connection>& connection);
+
+  // Called by the workers
+  void _execute_query(const std::shared_ptr<Connection>& connection, const std::string& payload);
+  // Returns false if the connection was closed
+  bool _send(const std::shared_ptr<Connection>& connection, std::string frame);
+
+  const std::filesystem::path _socket_path;
+  const size_t _worker_count;
+
+  int _listen_file_descriptor = -1;
+  int _epoll_file_descriptor = -1;
+  // An eventfd that wakes up the event loop, when workers queued frames or the server is stopped
+  int _wake_up_file_descriptor = -1;
+
+  std::atomic_bool _is_running{false};
+  std::thread _event_loop_thread;
+  std::vector<std::thread> _workers;
+
+  // Only accessed by the event loop
+  std::unordered_map<int, std::shared_ptr<Connection>> _connections;
+
+  // Connections for which workers queued frames since the event loop last woke up
+  std::mutex _wake_up_mutex;
+  std::vector<std::shared_ptr<Connection>> _connections_to_write;
+
+  // Connections with queries that no worker processes yet
+  std::mutex _task_mutex;
+  std::condition_variable _task_available;
+  std::deque<std::shared_ptr<Connection>> _tasks;
+  bool _stop_workers = false;
+
+  std::atomic<uint64_t> _connection_count{0};
+  std::atomic<uint64_t> _query_count{0};
+};
+
+}  // namespace opossum
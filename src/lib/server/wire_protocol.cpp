@@ -0,0 +1,253 @@
+#include "wire_protocol.hpp"
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "operators/predicate.hpp"
+#include "resolve_type.hpp"
+#include "storage/binary_serialization.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The index of a type in AllTypeVariant is its DataType (see data_types_macro).
+void write_variant(std::ostream& stream, const AllTypeVariant& value) {
+  const auto data_type = static_cast<DataType>(value.index());
+  write_value(stream, data_type);
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ValueDataType = typename decltype(data_type_t)::type;
+    write_value(stream, type_cast<ValueDataType>(value));
+  });
+}
+
+// Reads a value of a query, which is malformed if it ends before the value
+template <typename T>
+T read_query_value(std::istream& stream) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // The length is checked first, so that it cannot make us allocate more than the remaining payload.
+    const auto size = read_query_value<uint32_t>(stream);
+    Assert(static_cast<std::streamsize>(size) <= stream.rdbuf()->in_avail(), "Malformed query");
+    auto value = std::string(size, '\0');
+    stream.read(value.data(), static_cast<std::streamsize>(size));
+    return value;
+  } else {
+    const auto value = read_value<T>(stream);
+    Assert(stream, "Malformed query");
+    return value;
+  }
+}
+
+AllTypeVariant read_variant(std::istream& stream) {
+  auto value = AllTypeVariant{};
+  const auto data_type = read_query_value<DataType>(stream);
+  Assert(static_cast<size_t>(data_type) < std::variant_size_v<AllTypeVariant>, "Malformed query");
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ValueDataType = typename decltype(data_type_t)::type;
+    value = read_query_value<ValueDataType>(stream);
+  });
+  return value;
+}
+
+void write_predicate(std::ostream& stream, const Predicate& predicate) {
+  write_value(stream, predicate.type());
+  switch (predicate.type()) {
+    case PredicateType::Comparison:
+      write_value(stream, predicate.column_id());
+      write_value(stream, predicate.scan_type());
+      write_variant(stream, predicate.values()[0]);
+      return;
+    case PredicateType::Between:
+      write_value(stream, predicate.column_id());
+      write_variant(stream, predicate.values()[0]);
+      write_variant(stream, predicate.values()[1]);
+      return;
+    case PredicateType::And:
+    case PredicateType::Or:
+      write_value(stream, static_cast<uint32_t>(predicate.children().size()));
+      for (const auto& child : predicate.children()) {
+        write_predicate(stream, *child);
+      }
+      return;
+  }
+}
+
+std::shared_ptr<const Predicate> read_predicate(std::istream& stream, const uint32_t depth = 1) {
+  Assert(depth <= MAX_PREDICATE_DEPTH, "Predicate is nested too deeply");
+  const auto type = read_query_value<PredicateType>(stream);
+  if (type == PredicateType::Comparison) {
+    const auto column_id = read_query_value<ColumnID>(stream);
+    const auto scan_type = read_query_value<ScanType>(stream);
+    Assert(scan_type >= ScanType::OpEquals && scan_type <= ScanType::OpNotLike, "Malformed predicate");
+    return Predicate::comparison(column_id, scan_type, read_variant(stream));
+  }
+  if (type == PredicateType::Between) {
+    const auto column_id = read_query_value<ColumnID>(stream);
+    const auto lower = read_variant(stream);
+    return Predicate::between(column_id, lower, read_variant(stream));
+  }
+
+  Assert(type == PredicateType::And || type == PredicateType::Or, "Malformed predicate");
+  const auto child_count = read_query_value<uint32_t>(stream);
+  Assert(child_count <= MAX_PREDICATE_CHILD_COUNT, "Predicate has too many children");
+  auto children = std::vector<std::shared_ptr<const Predicate>>{};
+  for (auto child_index = uint32_t{0}; child_index < child_count; ++child_index) {
+    children.emplace_back(read_predicate(stream, depth + 1));
+  }
+  if (type == PredicateType::And) return Predicate::conjunction(std::move(children));
+  return Predicate::disjunction(std::move(children));
+}
+
+// Gathers the referenced values chunk by chunk. Consecutive positions usually point into the same chunk, so each
+// referenced segment is only materialized once per run of positions.
+template <typename T>
+std::vector<T> gather_values(const ReferenceSegment& reference_segment) {
+  const auto& pos_list = *reference_segment.pos_list();
+  const auto& referenced_table = *reference_segment.referenced_table();
+  const auto referenced_column_id = reference_segment.referenced_column_id();
+
+  // Consecutive rows of a ValueSegment, e.g., of an EntireChunkPosList, are copied at once.
+  if (const auto contiguous_begin = pos_list.contiguous_begin(0, pos_list.size())) {
+    const auto segment = referenced_table.get_chunk(contiguous_begin->chunk_id).get_segment(referenced_column_id);
+    if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(segment.get())) {
+      const auto begin = value_segment->values().cbegin() + contiguous_begin->chunk_offset;
+      return std::vector<T>(begin, begin + pos_list.size());
+    }
+  }
+
+  auto values = std::vector<T>{};
+  values.reserve(pos_list.size());
+  auto current_chunk_id = std::optional<ChunkID>{};
+  auto current_segment = std::shared_ptr<const BaseSegment>{};
+  auto materialized_values = std::vector<T>{};
+  const std::vector<T>* current_values = nullptr;
+  pos_list.for_each([&](const RowID& row_id) {
+    if (row_id.chunk_id != current_chunk_id) {
+      current_chunk_id = row_id.chunk_id;
+      // The segment is held while its values are read, so that the BufferManager does not evict it.
+      current_segment = referenced_table.get_chunk(row_id.chunk_id).get_segment(referenced_column_id);
+      if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(current_segment.get())) {
+        current_values = &value_segment->values();
+      } else {
+        materialized_values = materialize_values<T>(*current_segment);
+        current_values = &materialized_values;
+      }
+    }
+    values.emplace_back((*current_values)[row_id.chunk_offset]);
+  });
+  return values;
+}
+
+template <typename T>
+void write_segment(std::ostream& stream, const BaseSegment& segment) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    write_values(stream, value_segment->values());
+  } else if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    write_values(stream, gather_values<T>(*reference_segment));
+  } else {
+    write_values(stream, materialize_values<T>(segment));
+  }
+}
+
+}  // namespace
+
+std::string make_frame(const MessageType message_type, const std::string& payload) {
+  Assert(payload.size() <= MAX_PAYLOAD_SIZE, "Payload of " + std::to_string(payload.size()) + " bytes is too large");
+  auto frame = std::string(FRAME_HEADER_SIZE + payload.size(), '\0');
+  const auto payload_size = static_cast<uint32_t>(payload.size());
+  std::memcpy(frame.data(), &payload_size, sizeof(payload_size));
+  std::memcpy(frame.data() + sizeof(payload_size), &message_type, sizeof(message_type));
+  std::memcpy(frame.data() + FRAME_HEADER_SIZE, payload.data(), payload.size());
+  return frame;
+}
+
+FrameHeader read_frame_header(const char* data) {
+  auto header = FrameHeader{};
+  std::memcpy(&header.payload_size, data, sizeof(header.payload_size));
+  std::memcpy(&header.message_type, data + sizeof(header.payload_size), sizeof(header.message_type));
+  return header;
+}
+
+std::string serialize_query(const QueryRequest& request) {
+  auto stream = std::ostringstream{};
+  write_value(stream, request.table_name);
+  write_value(stream, static_cast<uint8_t>(request.predicate != nullptr));
+  if (request.predicate) write_predicate(stream, *request.predicate);
+  write_value(stream, static_cast<uint8_t>(request.limit.has_value()));
+  if (request.limit) write_value(stream, *request.limit);
+  return stream.str();
+}
+
+QueryRequest deserialize_query(const std::string& payload) {
+  auto stream = std::istringstream{payload};
+  auto request = QueryRequest{};
+  request.table_name = read_query_value<std::string>(stream);
+  if (read_query_value<uint8_t>(stream)) request.predicate = read_predicate(stream);
+  if (read_query_value<uint8_t>(stream)) request.limit = read_query_value<uint64_t>(stream);
+  Assert(stream && stream.peek() == std::char_traits<char>::eof(), "Malformed query");
+  return request;
+}
+
+std::string serialize_schema(const Table& table) {
+  auto stream = std::ostringstream{};
+  write_value(stream, static_cast<ColumnID::base_type>(table.column_count()));
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    write_value(stream, table.column_name(column_id));
+    write_value(stream, table.column_type(column_id));
+  }
+  return stream.str();
+}
+
+std::shared_ptr<Table> deserialize_schema(const std::string& payload) {
+  auto stream = std::istringstream{payload};
+  auto table = std::make_shared<Table>();
+  const auto column_count = read_value<ColumnID::base_type>(stream);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_name = read_value<std::string>(stream);
+    table->add_column_definition(column_name, read_value<DataType>(stream));
+  }
+  Assert(stream, "Malformed schema");
+  return table;
+}
+
+std::string serialize_chunk(const Table& table, const ChunkID chunk_id) {
+  const auto& chunk = table.get_chunk(chunk_id);
+  auto stream = std::ostringstream{};
+  write_value(stream, chunk.size());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      write_segment<ColumnDataType>(stream, *chunk.get_segment(column_id));
+    });
+  }
+  return stream.str();
+}
+
+Chunk deserialize_chunk(const Table& schema, const std::string& payload) {
+  auto stream = std::istringstream{payload};
+  const auto row_count = read_value<ChunkOffset>(stream);
+  auto chunk = Chunk{};
+  for (auto column_id = ColumnID{0}; column_id < schema.column_count(); ++column_id) {
+    resolve_data_type(schema.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(read_values<ColumnDataType>(stream, row_count)));
+    });
+  }
+  Assert(stream, "Malformed chunk");
+  return chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Predicate;
+class Table;
+
+// The messages exchanged between the Server and its Clients over a stream socket. Each message is sent as a frame of
+// a header, i.e., the size of the payload and the MessageType, followed by the payload. A client sends Query messages.
+// The server answers each query, in the order they were sent, with a Schema message, one Chunk message per non-empty
+// chunk of the result, and a Done message carrying the row count. If the query fails, an Error message with the
+// reason ends the answer instead, possibly after some chunks were sent.
+//
+// As with the other binary formats (see binary_serialization.hpp), values are written in the byte order of the
+// machine, which is fine for a server that is only reachable via a Unix domain socket.
+enum class MessageType : uint8_t { Query, Schema, Chunk, Done, Error };
+
+struct FrameHeader {
+  uint32_t payload_size;
+  MessageType message_type;
+};
+
+constexpr auto FRAME_HEADER_SIZE = sizeof(uint32_t) + sizeof(MessageType);
+
+// Larger frames are treated as a protocol error, so that a corrupt header cannot make the receiver allocate gigabytes
+constexpr auto MAX_PAYLOAD_SIZE = uint32_t{1} << 30;
+
+// Predicates that are nested deeper or combine more children are rejected, so that a malformed query can neither
+// overflow the stack of the server nor make it allocate large amounts of memory
+constexpr auto MAX_PREDICATE_DEPTH = uint32_t{64};
+constexpr auto MAX_PREDICATE_CHILD_COUNT = uint32_t{1'024};
+
+// There is no SQL layer, so queries describe their plan directly: A scan of a table of the StorageManager with an
+// optional predicate, whose output is cut off after an optional number of rows. The server executes them as
+// GetTable -> TableScan -> Limit.
+struct QueryRequest {
+  std::string table_name;
+  std::shared_ptr<const Predicate> predicate;
+  std::optional<uint64_t> limit;
+};
+
+std::string make_frame(MessageType message_type, const std::string& payload);
+
+// Reads the header from the first FRAME_HEADER_SIZE bytes of a frame
+FrameHeader read_frame_header(const char* data);
+
+std::string serialize_query(const QueryRequest& request);
+QueryRequest deserialize_query(const std::string& payload);
+
+// The schema consists of the names and data types of the columns
+std::string serialize_schema(const Table& table);
+std::shared_ptr<Table> deserialize_schema(const std::string& payload);
+
+// Chunks are sent column by column, as written by write_values. The values of ReferenceSegments are gathered from the
+// segments they reference, so the client always receives ValueSegments.
+std::string serialize_chunk(const Table& table, ChunkID chunk_id);
+Chunk deserialize_chunk(const Table& schema, const std::string& payload);
+
+}  // namespace opossum
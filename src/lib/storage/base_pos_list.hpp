@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BasePosList is the abstract super class for the positions of a ReferenceSegment. Besides plain RowIDs, positions
+// can be stored as an entire chunk, as ranges, or as a bitmap of a single chunk (see pos_lists.hpp), which takes far
+// less memory than 8 bytes per row for non-selective filters.
+class BasePosList : private Noncopyable {
+ public:
+  BasePosList() = default;
+  virtual ~BasePosList() = default;
+
+  // returns the number of positions
+  virtual size_t size() const = 0;
+
+  bool empty() const { return size() == 0; }
+
+  // Returns the position at the given index. This may be slower than for_each() for compressed position lists.
+  virtual RowID operator[](const size_t index) const = 0;
+
+  // Writes the positions [begin, begin + count) to out
+  virtual void copy_positions(const size_t begin, const size_t count, RowID* out) const = 0;
+
+  // Returns the chunk that all positions point into if they reference a single chunk in ascending order. Filtering
+  // such a list yields ascending offsets again, which can be stored in any representation.
+  virtual std::optional<ChunkID> ordered_chunk_id() const = 0;
+
+  // Returns the first position if the positions [begin, begin + count) are consecutive rows of one chunk, so that
+  // consumers can read the referenced values in place.
+  virtual std::optional<RowID> contiguous_begin(const size_t begin, const size_t count) const = 0;
+
+  // returns the memory used by the positions
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // Calls functor with each position in order. Positions are decoded batch by batch instead of being expanded
+  // into a vector of RowIDs.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto batch = std::array<RowID, 1024>{};
+    const auto position_count = size();
+    for (auto begin = size_t{0}; begin < position_count; begin += batch.size()) {
+      const auto count = std::min(batch.size(), position_count - begin);
+      copy_positions(begin, count, batch.data());
+      for (auto index = size_t{0}; index < count; ++index) {
+        functor(batch[index]);
+      }
+    }
+  }
+};
+
+}  // namespace opossum
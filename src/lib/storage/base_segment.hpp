@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -28,5 +29,22 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual ChunkOffset size() const = 0;
+
+  // releases memory that was reserved for future appends
+  virtual void shrink_to_fit() = 0;
+
+  // returns the approximate number of bytes used by the segment, see value_memory_usage
+  virtual size_t estimate_memory_usage() const = 0;
 };
+
+// Returns the number of bytes a value occupies in a segment. The characters of strings are counted as well, even
+// though short strings store them inline.
+template <typename T>
+size_t value_memory_usage(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return sizeof(T) + value.size();
+  } else {
+    return sizeof(T);
+  }
+}
 }  // namespace opossum
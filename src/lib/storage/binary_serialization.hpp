@@ -0,0 +1,104 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "lz4_segment.hpp"
+#include "run_length_segment.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// Helpers for the binary files written by the storage layer, e.g., by the BufferManager and the WriteAheadLog.
+// Values are written in the byte order of the machine, so the files are not portable.
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void write_value(std::ostream& stream, const std::string& value) {
+  write_value(stream, static_cast<uint32_t>(value.size()));
+  stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  auto value = T{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    value.resize(read_value<uint32_t>(stream));
+    stream.read(value.data(), static_cast<std::streamsize>(value.size()));
+  } else {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+  return value;
+}
+
+// Writes the values of a column. Fixed-width values are written as one block, strings as their lengths followed by
+// their characters, so that reading them back needs few calls. The number of values is not written.
+template <typename T>
+void write_values(std::ostream& stream, const std::vector<T>& values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : values) {
+      write_value(stream, static_cast<uint32_t>(value.size()));
+    }
+    for (const auto& value : values) {
+      stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+  } else {
+    stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(sizeof(T) * values.size()));
+  }
+}
+
+template <typename T>
+std::vector<T> read_values(std::istream& stream, const size_t value_count) {
+  auto values = std::vector<T>(value_count);
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto lengths = std::vector<uint32_t>(value_count);
+    stream.read(reinterpret_cast<char*>(lengths.data()), static_cast<std::streamsize>(sizeof(uint32_t) * value_count));
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      values[index].resize(lengths[index]);
+      stream.read(values[index].data(), lengths[index]);
+    }
+  } else {
+    stream.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(sizeof(T) * value_count));
+  }
+  return values;
+}
+
+// Returns the values of a segment, without going through AllTypeVariant for the segment types of base tables.
+template <typename T>
+std::vector<T> materialize_values(const BaseSegment& segment) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) return value_segment->values();
+  if (const auto* lz4_segment = dynamic_cast<const LZ4Segment<T>*>(&segment)) {
+    return lz4_segment->decompress()->values();
+  }
+
+  auto values = std::vector<T>{};
+  values.reserve(segment.size());
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      values.emplace_back(dictionary_segment->get(chunk_offset));
+    }
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    const auto& run_values = run_length_segment->values();
+    const auto& end_positions = run_length_segment->end_positions();
+    for (auto run = size_t{0}; run < run_values.size(); ++run) {
+      values.resize(end_positions[run] + 1, run_values[run]);
+    }
+  } else {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      values.emplace_back(type_cast<T>(segment[chunk_offset]));
+    }
+  }
+  return values;
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The bits within the block are taken from a second hash that is independent of the block index, nine bits for each
+// hash function. Double hashing (h1 + i * h2) would be cheaper, but is too correlated within 512 bits and noticeably
+// raises the false positive rate.
+template <typename Function>
+void for_each_bit(const uint64_t hash, const size_t hash_function_count, const Function& function) {
+  constexpr auto BITS_PER_FUNCTION = 9;
+  constexpr auto FUNCTIONS_PER_HASH = 64 / BITS_PER_FUNCTION;
+  auto bit_hash = hash * 0x9e3779b97f4a7c15ULL;
+  for (auto index = size_t{0}; index < hash_function_count; ++index) {
+    if (index % FUNCTIONS_PER_HASH == 0) {
+      bit_hash ^= bit_hash >> 29;
+      bit_hash *= 0xbf58476d1ce4e5b9ULL;
+      bit_hash ^= bit_hash >> 32;
+    }
+    const auto bit = (bit_hash >> (BITS_PER_FUNCTION * (index % FUNCTIONS_PER_HASH))) % BlockedBloomFilter::BLOCK_BITS;
+    function(bit / 64, uint64_t{1} << (bit % 64));
+  }
+}
+
+// Values are not spread evenly across the blocks, and the false positive rate of a block grows faster with the
+// number of values in it than it falls for emptier blocks. The expected rate sums the rate of a block with i values
+// over the Poisson distribution of the number of values per block.
+double expected_false_positive_rate(const double bits_per_element, const double hash_function_count) {
+  const auto block_bits = static_cast<double>(BlockedBloomFilter::BLOCK_BITS);
+  const auto mean_element_count = block_bits / bits_per_element;
+  auto probability = std::exp(-mean_element_count);
+  auto false_positive_rate = 0.0;
+  for (auto element_count = 0; element_count < 3 * mean_element_count + 50; ++element_count) {
+    if (element_count > 0) probability *= mean_element_count / element_count;
+    const auto bit_set_probability = 1.0 - std::pow(1.0 - 1.0 / block_bits, hash_function_count * element_count);
+    false_positive_rate += probability * std::pow(bit_set_probability, hash_function_count);
+  }
+  return false_positive_rate;
+}
+
+}  // namespace
+
+BlockedBloomFilter::BlockedBloomFilter(const size_t element_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False positive rate must be between 0 and 1");
+
+  // For a standard Bloom filter, the optimal number of bits per element is -ln(p) / ln(2)^2 and the optimal number of
+  // hash functions bits per element * ln(2). Blocking requires a few more bits for the same false positive rate.
+  const auto optimal_bits_per_element = -std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0));
+  const auto hash_function_count = std::clamp(std::round(optimal_bits_per_element * std::log(2.0)), 1.0, 16.0);
+  auto bits_per_element = optimal_bits_per_element;
+  while (expected_false_positive_rate(bits_per_element, hash_function_count) > false_positive_rate) {
+    bits_per_element *= 1.05;
+  }
+
+  const auto bit_count = static_cast<double>(std::max(element_count, size_t{1})) * bits_per_element;
+  const auto block_count = static_cast<size_t>(std::ceil(bit_count / BLOCK_BITS));
+  _blocks.resize(std::max(block_count, size_t{1}), Block{});
+  _hash_function_count = static_cast<size_t>(hash_function_count);
+}
+
+void BlockedBloomFilter::insert(const uint64_t hash) {
+  auto& block = _blocks[_block_index(hash)];
+  for_each_bit(hash, _hash_function_count,
+               [&](const size_t word, const uint64_t mask) { block.words[word] |= mask; });
+}
+
+bool BlockedBloomFilter::may_contain(const uint64_t hash) const {
+  const auto& block = _blocks[_block_index(hash)];
+  auto contained = true;
+  for_each_bit(hash, _hash_function_count,
+               [&](const size_t word, const uint64_t mask) { contained &= (block.words[word] & mask) != 0; });
+  return contained;
+}
+
+size_t BlockedBloomFilter::hash_function_count() const { return _hash_function_count; }
+
+size_t BlockedBloomFilter::memory_usage() const { return sizeof(*this) + _blocks.size() * sizeof(Block); }
+
+size_t BlockedBloomFilter::_block_index(const uint64_t hash) const {
+  // Maps the upper 32 bits of the hash to a block with a multiplication instead of a modulo.
+  return ((hash >> 32) * _blocks.size()) >> 32;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+// A Bloom filter that sets all bits of a value within a single cache line, so that a lookup costs one cache miss no
+// matter how many hash functions are used. The filter is sized for the expected number of distinct values and the
+// desired false positive rate. As values are not spread evenly across the blocks, a blocked filter needs a few more
+// bits than a standard Bloom filter to reach the same rate, which the sizing accounts for.
+//
+// Filters are built for each segment when a chunk is finalized (see Table::set_bloom_filter_false_positive_rate) and
+// let equality scans skip chunks that cannot contain the value they look for.
+class BlockedBloomFilter : private Noncopyable {
+ public:
+  BlockedBloomFilter(size_t element_count, double false_positive_rate);
+
+  // Takes the value_hash of a value.
+  void insert(uint64_t hash);
+
+  // Returns false if no value with the hash was inserted. Returns true if one was, or, with the false positive rate,
+  // if none was.
+  bool may_contain(uint64_t hash) const;
+
+  size_t hash_function_count() const;
+  size_t memory_usage() const;
+
+  static constexpr auto BLOCK_BITS = size_t{512};
+
+ protected:
+  struct alignas(64) Block {
+    std::array<uint64_t, BLOCK_BITS / 64> words;
+  };
+
+  size_t _block_index(uint64_t hash) const;
+
+  std::vector<Block> _blocks;
+  size_t _hash_function_count;
+};
+
+}  // namespace opossum
@@ -0,0 +1,285 @@
+#include "buffer_manager.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "binary_serialization.hpp"
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "lz4_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto CHUNK_FILE_MAGIC = uint32_t{0x4B4E4843};  // "CHNK"
+
+template <typename T>
+EncodingType encoding_type_of(const BaseSegment& segment) {
+  if (dynamic_cast<const DictionarySegment<T>*>(&segment)) return EncodingType::Dictionary;
+  if (dynamic_cast<const RunLengthSegment<T>*>(&segment)) return EncodingType::RunLength;
+  if (dynamic_cast<const LZ4Segment<T>*>(&segment)) return EncodingType::LZ4;
+  return EncodingType::Unencoded;
+}
+
+}  // namespace
+
+BufferFrame::~BufferFrame() {
+  if (!file_path.empty()) {
+    auto error_code = std::error_code{};
+    std::filesystem::remove(file_path, error_code);
+  }
+}
+
+BufferManager& BufferManager::get() {
+  // Chunks unregister themselves when they are destroyed, which can happen during static destruction, e.g., when the
+  // StorageManager is destroyed. Thus, the BufferManager is never destroyed.
+  static auto* instance = new BufferManager{};
+  return *instance;
+}
+
+void BufferManager::set_memory_budget(const size_t memory_budget) {
+  const auto lock = std::lock_guard{_mutex};
+  _memory_budget = memory_budget;
+  _evict_until(_memory_budget);
+}
+
+size_t BufferManager::memory_budget() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _memory_budget;
+}
+
+bool BufferManager::is_enabled() const { return memory_budget() != UNLIMITED; }
+
+void BufferManager::set_spill_directory(const std::filesystem::path& spill_directory) {
+  const auto lock = std::lock_guard{_mutex};
+  _spill_directory = spill_directory;
+}
+
+void BufferManager::register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_types) {
+  Assert(chunk->is_finalized(), "Only finalized chunks can be managed");
+  Assert(column_types.size() == chunk->column_count(), "Number of column types does not match the chunk");
+
+  const auto lock = std::lock_guard{_mutex};
+  if (chunk->_buffer_frame) return;
+
+  auto frame = std::make_unique<BufferFrame>();
+  frame->chunk = chunk.get();
+  frame->column_types = column_types;
+  for (const auto& segment : chunk->_segments) {
+    Assert(!std::dynamic_pointer_cast<const ReferenceSegment>(segment), "Chunks of references cannot be managed");
+    frame->memory_usage += segment->estimate_memory_usage();
+  }
+  _resident_memory_usage += frame->memory_usage;
+  chunk->_buffer_frame = frame.get();
+  _frames.emplace_back(std::move(frame));
+
+  _evict_until(_memory_budget);
+}
+
+void BufferManager::unregister_chunk(Chunk& chunk) {
+  const auto lock = std::lock_guard{_mutex};
+  const auto* frame = chunk._buffer_frame.load();
+  if (!frame) return;
+
+  const auto frame_iter =
+      std::find_if(_frames.begin(), _frames.end(), [&](const auto& candidate) { return candidate.get() == frame; });
+  DebugAssert(frame_iter != _frames.end(), "Chunk refers to an unknown frame");
+  if (frame->is_resident) _resident_memory_usage -= frame->memory_usage;
+  chunk._buffer_frame = nullptr;
+
+  const auto frame_index = static_cast<size_t>(std::distance(_frames.begin(), frame_iter));
+  _frames.erase(frame_iter);
+  if (_clock_hand > frame_index) --_clock_hand;
+}
+
+void BufferManager::reload_chunk(Chunk& chunk) {
+  const auto lock = std::lock_guard{_mutex};
+  auto* frame = chunk._buffer_frame.load();
+  Assert(frame, "Chunk is not managed by the BufferManager");
+  if (frame->is_resident) return;
+
+  // Make room first, so that the chunk is not evicted again before the reader can access it.
+  _evict_until(_memory_budget > frame->memory_usage ? _memory_budget - frame->memory_usage : 0);
+  _reload(*frame);
+}
+
+void BufferManager::update_memory_usage(Chunk& chunk) {
+  const auto lock = std::lock_guard{_mutex};
+  auto* frame = chunk._buffer_frame.load();
+  // Evicted chunks do not use memory, their usage is computed again when they are reloaded.
+  if (!frame || !frame->is_resident) return;
+
+  auto memory_usage = size_t{0};
+  for (const auto& segment : chunk._segments) {
+    memory_usage += std::atomic_load(&segment)->estimate_memory_usage();
+  }
+  _resident_memory_usage = _resident_memory_usage - frame->memory_usage + memory_usage;
+  frame->memory_usage = memory_usage;
+  _evict_until(_memory_budget);
+}
+
+void BufferManager::_evict_until(const size_t memory_usage) {
+  // Each resident frame is looked at at most twice: once to clear its reference bit and once to evict it.
+  const auto max_inspection_count = 2 * _frames.size();
+  for (auto inspection_count = size_t{0};
+       _resident_memory_usage > memory_usage && inspection_count < max_inspection_count; ++inspection_count) {
+    if (_clock_hand >= _frames.size()) _clock_hand = 0;
+    auto& frame = *_frames[_clock_hand++];
+    if (!frame.is_resident || _is_pinned(frame)) continue;
+    if (frame.is_referenced.exchange(false)) continue;
+    _evict(frame);
+  }
+}
+
+bool BufferManager::_is_pinned(const BufferFrame& frame) const {
+  // A segment that is referenced by someone besides the chunk (and the copy taken here) is in use by a reader.
+  for (const auto& segment : frame.chunk->_segments) {
+    if (std::atomic_load(&segment).use_count() > 2) return true;
+  }
+  return false;
+}
+
+void BufferManager::_evict(BufferFrame& frame) {
+  auto& chunk = *frame.chunk;
+  frame.encodings.clear();
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(frame.column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      frame.encodings.emplace_back(encoding_type_of<ColumnDataType>(*chunk._segments[column_id]));
+    });
+  }
+  if (frame.file_path.empty()) _write_chunk(frame);
+
+  for (auto& segment : chunk._segments) {
+    std::atomic_store(&segment, std::shared_ptr<BaseSegment>{});
+  }
+  frame.is_resident = false;
+  _resident_memory_usage -= frame.memory_usage;
+  ++_eviction_count;
+}
+
+void BufferManager::_write_chunk(BufferFrame& frame) {
+  if (_spill_directory.empty()) {
+    _spill_directory =
+        std::filesystem::temp_directory_path() / ("hyrise_buffer_manager_" + std::to_string(::getpid()));
+  }
+  std::filesystem::create_directories(_spill_directory);
+  frame.file_path = _spill_directory / ("chunk_" + std::to_string(_next_file_id++) + ".bin");
+
+  auto stream = std::ofstream{frame.file_path, std::ios::binary | std::ios::trunc};
+  Assert(stream.is_open(), "Cannot open " + frame.file_path.string());
+
+  // The file stores the values of the columns one after another.
+  const auto& chunk = *frame.chunk;
+  write_value(stream, CHUNK_FILE_MAGIC);
+  write_value(stream, static_cast<ColumnID::base_type>(chunk.column_count()));
+  write_value(stream, chunk.size());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(frame.column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      write_values(stream, materialize_values<ColumnDataType>(*chunk._segments[column_id]));
+    });
+  }
+  Assert(stream.good(), "Writing " + frame.file_path.string() + " failed");
+}
+
+void BufferManager::_reload(BufferFrame& frame) {
+  auto stream = std::ifstream{frame.file_path, std::ios::binary};
+  Assert(stream.is_open(), "Cannot open " + frame.file_path.string());
+  Assert(read_value<uint32_t>(stream) == CHUNK_FILE_MAGIC, frame.file_path.string() + " is not a chunk file");
+
+  auto& chunk = *frame.chunk;
+  const auto column_count = read_value<ColumnID::base_type>(stream);
+  const auto row_count = read_value<ChunkOffset>(stream);
+  Assert(column_count == chunk.column_count() && row_count == chunk.size(), "Chunk file does not match the chunk");
+
+  auto memory_usage = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = frame.column_types[column_id];
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto values = read_values<ColumnDataType>(stream, row_count);
+      Assert(stream.good(), "Reading " + frame.file_path.string() + " failed");
+
+      auto segment = std::static_pointer_cast<BaseSegment>(
+          std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      const auto encoding_type = frame.encodings[column_id];
+      if (encoding_type != EncodingType::Unencoded) segment = encode_segment(segment, data_type, encoding_type);
+      memory_usage += segment->estimate_memory_usage();
+      std::atomic_store(&chunk._segments[column_id], segment);
+    });
+  }
+
+  frame.memory_usage = memory_usage;
+  frame.is_resident = true;
+  frame.is_referenced = true;
+  _resident_memory_usage += memory_usage;
+  ++_reload_count;
+}
+
+size_t BufferManager::resident_memory_usage() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _resident_memory_usage;
+}
+
+size_t BufferManager::managed_chunk_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _frames.size();
+}
+
+size_t BufferManager::resident_chunk_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return std::count_if(_frames.cbegin(), _frames.cend(), [](const auto& frame) { return frame->is_resident; });
+}
+
+uint64_t BufferManager::eviction_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _eviction_count;
+}
+
+uint64_t BufferManager::reload_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _reload_count;
+}
+
+void BufferManager::print(std::ostream& out) const {
+  const auto lock = std::lock_guard{_mutex};
+  const auto resident_chunk_count =
+      std::count_if(_frames.cbegin(), _frames.cend(), [](const auto& frame) { return frame->is_resident; });
+  out << "BufferManager: " << resident_chunk_count << " of " << _frames.size() << " chunks resident, "
+      << _resident_memory_usage << " bytes (budget: ";
+  if (_memory_budget == UNLIMITED) {
+    out << "unlimited";
+  } else {
+    out << _memory_budget << " bytes";
+  }
+  out << "), " << _eviction_count << " evictions, " << _reload_count << " reloads" << std::endl;
+}
+
+void BufferManager::reset() {
+  const auto lock = std::lock_guard{_mutex};
+  for (auto& frame : _frames) {
+    if (!frame->is_resident) _reload(*frame);
+    frame->chunk->_buffer_frame = nullptr;
+  }
+  _frames.clear();
+  _memory_budget = UNLIMITED;
+  _spill_directory.clear();
+  _clock_hand = 0;
+  _resident_memory_usage = 0;
+  _eviction_count = 0;
+  _reload_count = 0;
+}
+
+}  // namespace opossum
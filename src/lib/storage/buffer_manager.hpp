@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "encoding_advisor.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// The state of a chunk that is managed by the BufferManager
+struct BufferFrame {
+  ~BufferFrame();
+
+  Chunk* chunk;
+  std::vector<DataType> column_types;
+
+  // The encodings of the segments when the chunk was evicted, which are restored when it is reloaded
+  std::vector<EncodingType> encodings;
+
+  // The file the values were written to when the chunk was evicted for the first time. As managed chunks are
+  // finalized, the file stays valid and later evictions do not write it again.
+  std::filesystem::path file_path;
+
+  bool is_resident = true;
+  size_t memory_usage = 0;
+
+  // Set on each access and cleared when the clock hand passes the frame
+  std::atomic_bool is_referenced{true};
+};
+
+// The BufferManager is a singleton that keeps the memory used by finalized chunks within a budget. If the budget is
+// exceeded, it evicts chunks by writing their values to a file (once) and releasing their segments. Accessing a
+// segment of an evicted chunk (see Chunk::get_segment) reloads the chunk transparently. Thus, tables larger than the
+// memory can be processed, but each reload costs reading and possibly re-encoding the chunk.
+//
+// Chunks are chosen for eviction with the CLOCK policy: A hand sweeps over the resident chunks, evicting those that
+// were not accessed since it last passed them. Chunks whose segments are still held by a reader, e.g., a running
+// scan, are pinned and skipped.
+//
+// Only chunks that are finalized while a budget is set are managed, see Table. Chunks of operator results, which
+// consist of ReferenceSegments, are never managed.
+class BufferManager : private Noncopyable {
+ public:
+  static BufferManager& get();
+
+  // Sets the number of bytes (as reported by BaseSegment::estimate_memory_usage) that resident managed chunks may
+  // use, evicting chunks if necessary. UNLIMITED (the default) disables the BufferManager.
+  void set_memory_budget(size_t memory_budget);
+  size_t memory_budget() const;
+  bool is_enabled() const;
+
+  // Sets the directory evicted chunks are written to. Defaults to a directory in the temporary directory of the
+  // system, which is created on the first eviction.
+  void set_spill_directory(const std::filesystem::path& spill_directory);
+
+  // Starts managing a finalized chunk, which might evict other chunks or the chunk itself.
+  void register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_types);
+
+  // Stops managing a chunk without reloading it. Called when the chunk is destroyed or removed from its table.
+  void unregister_chunk(Chunk& chunk);
+
+  // Makes an evicted chunk resident again. Called by the chunk when a segment is accessed.
+  void reload_chunk(Chunk& chunk);
+
+  // Recomputes the memory usage of a managed chunk after its segments were replaced, e.g., by encoded ones, which
+  // might evict chunks if it grew. Called by the chunk, see Chunk::replace_segment.
+  void update_memory_usage(Chunk& chunk);
+
+  // Returns the number of bytes used by resident managed chunks
+  size_t resident_memory_usage() const;
+
+  size_t managed_chunk_count() const;
+  size_t resident_chunk_count() const;
+  uint64_t eviction_count() const;
+  uint64_t reload_count() const;
+
+  // prints the budget, the memory usage, and the counters
+  void print(std::ostream& out = std::cout) const;
+
+  // Reloads all chunks, stops managing them, and disables the BufferManager, used especially in tests
+  void reset();
+
+  static constexpr auto UNLIMITED = std::numeric_limits<size_t>::max();
+
+  BufferManager(BufferManager&&) = delete;
+
+ protected:
+  BufferManager() = default;
+
+  // All of these must be called with _mutex held
+  void _evict_until(size_t memory_usage);
+  bool _is_pinned(const BufferFrame& frame) const;
+  void _evict(BufferFrame& frame);
+  void _reload(BufferFrame& frame);
+  void _write_chunk(BufferFrame& frame);
+
+  size_t _memory_budget = UNLIMITED;
+  std::filesystem::path _spill_directory;
+
+  std::vector<std::unique_ptr<BufferFrame>> _frames;
+  size_t _clock_hand = 0;
+  size_t _resident_memory_usage = 0;
+  uint64_t _eviction_count = 0;
+  uint64_t _reload_count = 0;
+  uint64_t _next_file_id = 0;
+
+  // Reloads read files while holding the mutex, so that a chunk is never reloaded twice.
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
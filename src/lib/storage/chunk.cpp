@@ -3,24 +3,63 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "bloom_filter.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
+#include "hyper_log_log.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+// Managed chunks are referenced by the BufferManager and thus must not be moved.
+Chunk::Chunk(Chunk&& other) noexcept
+    : _segments(std::move(other._segments)),
+      _is_finalized(other._is_finalized.load()),
+      _finalized_size(other._finalized_size),
+      _bloom_filters(std::move(other._bloom_filters)),
+      _hyper_log_logs(std::move(other._hyper_log_logs)),
+      _mvcc_data(std::move(other._mvcc_data)),
+      _invalid_row_count(other._invalid_row_count.load()),
+      _cleanup_commit_id(other._cleanup_commit_id.load()),
+      _partition_id(other._partition_id) {
+  DebugAssert(!other.is_buffer_managed(), "Cannot move a chunk that is managed by the BufferManager");
+}
+
+Chunk& Chunk::operator=(Chunk&& other) noexcept {
+  DebugAssert(!is_buffer_managed() && !other.is_buffer_managed(),
+              "Cannot move a chunk that is managed by the BufferManager");
+  _segments = std::move(other._segments);
+  _is_finalized = other._is_finalized.load();
+  _finalized_size = other._finalized_size;
+  _bloom_filters = std::move(other._bloom_filters);
+  _hyper_log_logs = std::move(other._hyper_log_logs);
+  _mvcc_data = std::move(other._mvcc_data);
+  _invalid_row_count = other._invalid_row_count.load();
+  _cleanup_commit_id = other._cleanup_commit_id.load();
+  _partition_id = other._partition_id;
+  return *this;
+}
+
+Chunk::~Chunk() {
+  if (is_buffer_managed()) BufferManager::get().unregister_chunk(*this);
+}
+
 void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(!is_finalized(), "Cannot add segments to a finalized chunk");
   DebugAssert(column_count() == 0 || segment->size() == size(),
               "Segment has wrong size. Should be " + std::to_string(size()));
   _segments.push_back(segment);
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(!is_finalized(), "Cannot append to a finalized chunk");
   DebugAssert(values.size() == column_count(),
               "Value vector has wrong size. Should be " + std::to_string(column_count()));
   for (std::vector<AllTypeVariant>::size_type column_index = 0, size = values.size(); column_index < size;
@@ -29,13 +68,87 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments.at(column_id); }
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  // Segments of finalized chunks can be replaced while they are read, see replace_segment, or be evicted.
+  auto segment = std::atomic_load(&_segments.at(column_id));
+  if (auto* buffer_frame = _buffer_frame.load()) {
+    // The chunk might be evicted again right after reloading it, so this has to loop until the segment is held.
+    while (!segment) {
+      BufferManager::get().reload_chunk(const_cast<Chunk&>(*this));
+      segment = std::atomic_load(&_segments[column_id]);
+    }
+    buffer_frame->is_referenced = true;
+  }
+  return segment;
+}
+
+void Chunk::replace_segment(ColumnID column_id, const std::shared_ptr<BaseSegment>& segment) {
+  Assert(is_finalized(), "Only segments of finalized chunks can be replaced");
+  Assert(segment->size() == size(), "Segment has wrong size. Should be " + std::to_string(size()));
+  std::atomic_store(&_segments.at(column_id), segment);
+  if (_buffer_frame.load()) BufferManager::get().update_memory_usage(*this);
+}
 
 ColumnCount Chunk::column_count() const { return static_cast<ColumnCount>(_segments.size()); }
 
+void Chunk::finalize() {
+  Assert(!is_finalized(), "Chunk is already finalized");
+  for (const auto& segment : _segments) {
+    segment->shrink_to_fit();
+  }
+  _finalized_size = size();
+  _bloom_filters.resize(_segments.size());
+  _hyper_log_logs.resize(_segments.size());
+  _is_finalized = true;
+}
+
+bool Chunk::is_finalized() const { return _is_finalized; }
+
+bool Chunk::has_mvcc_data() const { return _mvcc_data != nullptr; }
+
+std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
+
+void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) { _mvcc_data = mvcc_data; }
+
+ChunkOffset Chunk::invalid_row_count() const { return _invalid_row_count; }
+
+void Chunk::increase_invalid_row_count(const ChunkOffset count) { _invalid_row_count += count; }
+
+CommitID Chunk::cleanup_commit_id() const { return _cleanup_commit_id; }
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) { _cleanup_commit_id = cleanup_commit_id; }
+
+std::shared_ptr<const BlockedBloomFilter> Chunk::bloom_filter(const ColumnID column_id) const {
+  if (!is_finalized()) return nullptr;
+  return std::atomic_load(&_bloom_filters.at(column_id));
+}
+
+void Chunk::set_bloom_filter(const ColumnID column_id, const std::shared_ptr<const BlockedBloomFilter>& bloom_filter) {
+  Assert(is_finalized(), "Bloom filters can only be set for finalized chunks");
+  std::atomic_store(&_bloom_filters.at(column_id), bloom_filter);
+}
+
+std::shared_ptr<const HyperLogLog> Chunk::hyper_log_log(const ColumnID column_id) const {
+  if (!is_finalized()) return nullptr;
+  return std::atomic_load(&_hyper_log_logs.at(column_id));
+}
+
+void Chunk::set_hyper_log_log(const ColumnID column_id, const std::shared_ptr<const HyperLogLog>& hyper_log_log) {
+  Assert(is_finalized(), "HyperLogLog sketches can only be set for finalized chunks");
+  std::atomic_store(&_hyper_log_logs.at(column_id), hyper_log_log);
+}
+
+std::optional<PartitionID> Chunk::partition_id() const { return _partition_id; }
+
+void Chunk::set_partition_id(const PartitionID partition_id) { _partition_id = partition_id; }
+
+bool Chunk::is_buffer_managed() const { return _buffer_frame.load() != nullptr; }
+
 ChunkOffset Chunk::size() const {
-  if (!_segments.empty()) {
-    return _segments[0]->size();
+  if (is_finalized()) {
+    return _finalized_size;
+  } else if (!_segments.empty()) {
+    return std::atomic_load(&_segments[0])->size();
   } else {
     return 0;
   }
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,10 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BlockedBloomFilter;
+class HyperLogLog;
+class MvccData;
+struct BufferFrame;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -23,6 +28,11 @@ class BaseSegment;
 class Chunk : private Noncopyable {
  public:
   Chunk() = default;
+  ~Chunk();
+
+  // std::atomic is neither copyable nor movable, so the move operations have to be spelled out.
+  Chunk(Chunk&& other) noexcept;
+  Chunk& operator=(Chunk&& other) noexcept;
 
   // adds a segment to the "right" of the chunk
   void add_segment(std::shared_ptr<BaseSegment> segment);
@@ -37,11 +47,79 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
-  // Returns the segment at a given position
+  // Returns the segment at a given position. If the chunk was evicted by the BufferManager, it is reloaded first.
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Exchanges a segment of a finalized chunk for one with the same values, e.g., an encoded one. Readers that still
+  // hold the previous segment keep it alive, so this does not have to wait for them.
+  void replace_segment(ColumnID column_id, const std::shared_ptr<BaseSegment>& segment);
+
+  // Seals the chunk once no more rows will be appended, i.e., when it reached the target chunk size of its table.
+  // The segments release their spare capacity and the chunk becomes immutable. As finalized chunks never change
+  // again, readers do not need to synchronize with writers on them, and work such as encoding or gathering
+  // statistics can safely run in the background.
+  void finalize();
+
+  // returns whether finalize() was called
+  bool is_finalized() const;
+
+  // Returns the MVCC data of the chunk. Only chunks of tables that use MVCC have it, not, e.g., those of operator
+  // results.
+  bool has_mvcc_data() const;
+  std::shared_ptr<MvccData> mvcc_data() const;
+  void set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data);
+
+  // Returns the number of rows that will never be visible to new transactions again, i.e., committed deletes and
+  // rolled back inserts. It is increased by Delete and Insert and used to find chunks worth compacting.
+  ChunkOffset invalid_row_count() const;
+  void increase_invalid_row_count(ChunkOffset count);
+
+  // Once all rows of a chunk were deleted by the ChunkCompactor, this is the commit ID of that deletion. Transactions
+  // whose snapshot includes it skip the chunk without looking at its MVCC data, which allows removing its data
+  // physically once no older transaction is active anymore. MAX_COMMIT_ID if the chunk was not compacted.
+  CommitID cleanup_commit_id() const;
+  void set_cleanup_commit_id(CommitID cleanup_commit_id);
+
+  // Returns the Bloom filter over the values of a column, or nullptr if none was built. Filters are only built for
+  // finalized chunks, see Table::set_bloom_filter_false_positive_rate. They stay in memory when the chunk is evicted
+  // by the BufferManager, so that chunks that a scan skips are not reloaded.
+  std::shared_ptr<const BlockedBloomFilter> bloom_filter(ColumnID column_id) const;
+  void set_bloom_filter(ColumnID column_id, const std::shared_ptr<const BlockedBloomFilter>& bloom_filter);
+
+  // Returns the HyperLogLog sketch of the distinct values of a column, or nullptr if none was built. Like Bloom
+  // filters, sketches are only built for finalized chunks, see Table::set_hyper_log_log_enabled.
+  std::shared_ptr<const HyperLogLog> hyper_log_log(ColumnID column_id) const;
+  void set_hyper_log_log(ColumnID column_id, const std::shared_ptr<const HyperLogLog>& hyper_log_log);
+
+  // Returns the partition whose rows the chunk holds, or std::nullopt if its table is not partitioned, see
+  // Table::create_hash_partitioning.
+  std::optional<PartitionID> partition_id() const;
+  void set_partition_id(PartitionID partition_id);
+
+  // returns whether the chunk is managed by the BufferManager
+  bool is_buffer_managed() const;
+
  protected:
+  friend class BufferManager;
+
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::atomic_bool _is_finalized{false};
+
+  // The size is stored on finalization, as the segments of finalized chunks might be evicted
+  ChunkOffset _finalized_size{0};
+
+  // One entry per column once the chunk is finalized. Entries are set while readers might access them and are thus
+  // accessed atomically.
+  std::vector<std::shared_ptr<const BlockedBloomFilter>> _bloom_filters;
+  std::vector<std::shared_ptr<const HyperLogLog>> _hyper_log_logs;
+
+  // Owned by the BufferManager, nullptr if the chunk is not managed
+  std::atomic<BufferFrame*> _buffer_frame{nullptr};
+
+  std::shared_ptr<MvccData> _mvcc_data;
+  std::atomic<ChunkOffset> _invalid_row_count{0};
+  std::atomic<CommitID> _cleanup_commit_id{MAX_COMMIT_ID};
+  std::optional<PartitionID> _partition_id;
 };
 
 }  // namespace opossum
@@ -0,0 +1,172 @@
+#include "chunk_compactor.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "mvcc_data.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "pos_lists.hpp"
+#include "reference_segment.hpp"
+#include "storage_manager.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Sets the cleanup commit ID of a chunk as part of the commit that moved its rows. As the TransactionManager
+// publishes the commit ID only after all records are committed, every transaction whose snapshot includes the move
+// sees the mark and skips the chunk.
+class MarkChunkForCleanup : public AbstractReadWriteOperator {
+ public:
+  explicit MarkChunkForCleanup(Chunk& chunk) : _chunk(chunk) {}
+
+  const std::string& name() const override {
+    static const auto name = std::string{"MarkChunkForCleanup"};
+    return name;
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override { return nullptr; }
+  void _on_commit_records(const CommitID commit_id) override { _chunk.set_cleanup_commit_id(commit_id); }
+  void _on_rollback_records() override {}
+
+  Chunk& _chunk;
+};
+
+}  // namespace
+
+ChunkCompactor::ChunkCompactor(const double invalid_row_share_threshold)
+    : _invalid_row_share_threshold(invalid_row_share_threshold) {
+  Assert(invalid_row_share_threshold > 0.0 && invalid_row_share_threshold <= 1.0,
+         "Threshold must be in (0, 1], otherwise chunks without invalid rows would be compacted");
+}
+
+ChunkCompactor::~ChunkCompactor() { stop(); }
+
+size_t ChunkCompactor::run_once() {
+  auto compacted_chunk_count = size_t{0};
+  auto& storage_manager = StorageManager::get();
+
+  for (const auto& table_name : storage_manager.table_names()) {
+    const auto table = storage_manager.get_table(table_name);
+    if (table->uses_mvcc() == UseMvcc::No) continue;
+
+    // Chunks appended by _move_valid_rows are not finalized and thus not considered in the same pass.
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      // Held by pointer, as remove_chunk replaces the chunk.
+      const auto chunk_ptr = table->get_chunk_ptr(chunk_id);
+      const auto& chunk = *chunk_ptr;
+      if (!chunk.is_finalized() || chunk.size() == 0) continue;
+
+      const auto cleanup_commit_id = chunk.cleanup_commit_id();
+      if (cleanup_commit_id != MAX_COMMIT_ID) {
+        // The rows were moved before. Release the chunk's data once no transaction can see the old rows anymore.
+        const auto lowest_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+        if (!lowest_snapshot_commit_id || *lowest_snapshot_commit_id >= cleanup_commit_id) {
+          table->remove_chunk(chunk_id);
+          ++_removed_chunk_count;
+        }
+        continue;
+      }
+
+      const auto invalid_row_share = static_cast<double>(chunk.invalid_row_count()) / chunk.size();
+      if (invalid_row_share < _invalid_row_share_threshold) continue;
+
+      if (_move_valid_rows(table_name, table, chunk_id)) ++compacted_chunk_count;
+    }
+  }
+
+  return compacted_chunk_count;
+}
+
+bool ChunkCompactor::_move_valid_rows(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                      const ChunkID chunk_id) {
+  auto& chunk = table->get_chunk(chunk_id);
+  const auto& mvcc_data = *chunk.mvcc_data();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+
+  // Rows that are locked by a running transaction, e.g., uncommitted inserts, cannot be moved yet. Neither can rows
+  // that are not deleted but were inserted after the snapshot: Insert sets their begin commit ID and unlocks them
+  // before the commit ID is published, so they might be invisible to the snapshot and still be committed. Moving
+  // only the rows visible to the snapshot would lose them. Rolled back inserts keep a begin commit ID of
+  // MAX_COMMIT_ID and are dropped. The transaction ID is checked first, as Insert unlocks rows last.
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_data.size(); ++chunk_offset) {
+    if (mvcc_data.tids[chunk_offset] != INVALID_TRANSACTION_ID) return false;
+    const auto begin_commit_id = mvcc_data.begin_cids[chunk_offset].load();
+    if (begin_commit_id == MAX_COMMIT_ID || mvcc_data.end_cids[chunk_offset] != MAX_COMMIT_ID) continue;
+    if (begin_commit_id > context->snapshot_commit_id()) return false;
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+  const auto pos_list = make_pos_list(chunk_id, chunk_offsets);
+
+  auto valid_rows = std::make_shared<Table>();
+  auto valid_rows_chunk = Chunk{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    valid_rows->add_column_definition(table->column_name(column_id), table->column_type(column_id));
+    valid_rows_chunk.add_segment(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  valid_rows->emplace_chunk(std::move(valid_rows_chunk));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(valid_rows);
+  table_wrapper->execute();
+
+  const auto delete_operator = std::make_shared<Delete>(table_name, table_wrapper);
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+  if (delete_operator->execute_failed()) {
+    context->rollback();
+    return false;
+  }
+
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  const auto mark_chunk_for_cleanup = std::make_shared<MarkChunkForCleanup>(chunk);
+  mark_chunk_for_cleanup->set_transaction_context(context);
+  mark_chunk_for_cleanup->execute();
+
+  context->commit();
+  return true;
+}
+
+void ChunkCompactor::start(const std::chrono::milliseconds interval) {
+  const auto lock = std::lock_guard{_thread_mutex};
+  Assert(!_thread.joinable(), "ChunkCompactor is already running");
+  _stop_requested = false;
+
+  _thread = std::thread{[this, interval]() {
+    auto lock = std::unique_lock{_thread_mutex};
+    while (!_stop_condition.wait_for(lock, interval, [&]() { return _stop_requested; })) {
+      lock.unlock();
+      run_once();
+      lock.lock();
+    }
+  }};
+}
+
+void ChunkCompactor::stop() {
+  {
+    const auto lock = std::lock_guard{_thread_mutex};
+    _stop_requested = true;
+  }
+  _stop_condition.notify_all();
+  if (_thread.joinable()) _thread.join();
+}
+
+size_t ChunkCompactor::removed_chunk_count() const { return _removed_chunk_count; }
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Reclaims the space of invalidated rows in the MVCC tables of the StorageManager.
+//
+// Deleted rows stay in their chunk, as readers with older snapshots might still see them, and every scan has to skip
+// them. Once the share of invalid rows of a finalized chunk reaches the threshold, the compactor moves the remaining
+// valid rows to the end of the table in a transaction of its own (i.e., deletes and re-inserts them) and marks the
+// chunk with the commit ID of that transaction. Transactions that start afterwards skip the chunk. Once all older
+// transactions have finished, the data of the chunk is released via Table::remove_chunk.
+//
+// Compaction either runs synchronously via run_once() or periodically in a background thread.
+class ChunkCompactor : private Noncopyable {
+ public:
+  explicit ChunkCompactor(double invalid_row_share_threshold = DEFAULT_INVALID_ROW_SHARE_THRESHOLD);
+  ~ChunkCompactor();
+
+  // Runs one compaction pass over all tables. Returns the number of chunks whose rows were moved.
+  size_t run_once();
+
+  // Starts a background thread that calls run_once() after each interval, until stop() is called.
+  void start(std::chrono::milliseconds interval);
+  void stop();
+
+  // Returns the number of chunks whose data was released so far.
+  size_t removed_chunk_count() const;
+
+  static constexpr auto DEFAULT_INVALID_ROW_SHARE_THRESHOLD = 0.5;
+
+ protected:
+  // Moves the valid rows of the chunk in a transaction. Returns false if the chunk could not be compacted because
+  // another transaction holds a lock on one of its rows.
+  bool _move_valid_rows(const std::string& table_name, const std::shared_ptr<Table>& table, ChunkID chunk_id);
+
+  const double _invalid_row_share_threshold;
+  std::atomic<size_t> _removed_chunk_count{0};
+
+  std::thread _thread;
+  std::mutex _thread_mutex;
+  std::condition_variable _stop_condition;
+  bool _stop_requested = false;
+};
+
+}  // namespace opossum
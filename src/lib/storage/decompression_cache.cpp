@@ -0,0 +1,119 @@
+#include "decompression_cache.hpp"
+
+#include <atomic>
+#include <memory>
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+DecompressionCache& DecompressionCache::get() {
+  // LZ4Segments erase their entries when they are destroyed, which can happen during static destruction, e.g., when
+  // the StorageManager is destroyed. Thus, the cache is never destroyed.
+  static auto* instance = new DecompressionCache{};
+  return *instance;
+}
+
+std::shared_ptr<const BaseSegment> DecompressionCache::get_or_decompress(
+    const uint64_t key, const std::function<std::shared_ptr<const BaseSegment>()>& decompress) {
+  {
+    const auto lock = std::lock_guard{_mutex};
+    const auto entry = _entry_by_key.find(key);
+    if (entry != _entry_by_key.end()) {
+      ++_hit_count;
+      _entries.splice(_entries.begin(), _entries, entry->second);
+      return entry->second->segment;
+    }
+    ++_miss_count;
+  }
+
+  // Decompressing takes long compared to the lookup, so other segments can be accessed meanwhile. If two readers miss
+  // the same segment at the same time, both decompress it and the first result is kept.
+  auto segment = decompress();
+  const auto segment_size = segment->estimate_memory_usage();
+
+  const auto lock = std::lock_guard{_mutex};
+  const auto entry = _entry_by_key.find(key);
+  if (entry != _entry_by_key.end()) return entry->second->segment;
+  if (segment_size > _capacity) return segment;
+
+  _evict(_capacity - segment_size);
+  _entries.push_front({key, segment, segment_size});
+  _entry_by_key.emplace(key, _entries.begin());
+  _size += segment_size;
+  return segment;
+}
+
+void DecompressionCache::erase(const uint64_t key) {
+  const auto lock = std::lock_guard{_mutex};
+  const auto entry = _entry_by_key.find(key);
+  if (entry == _entry_by_key.end()) return;
+  _size -= entry->second->size;
+  _entries.erase(entry->second);
+  _entry_by_key.erase(entry);
+}
+
+void DecompressionCache::_evict(const size_t capacity) {
+  while (_size > capacity) {
+    const auto& entry = _entries.back();
+    _size -= entry.size;
+    _entry_by_key.erase(entry.key);
+    _entries.pop_back();
+    ++_eviction_count;
+  }
+}
+
+void DecompressionCache::set_capacity(const size_t capacity) {
+  const auto lock = std::lock_guard{_mutex};
+  _capacity = capacity;
+  _evict(capacity);
+}
+
+size_t DecompressionCache::capacity() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _capacity;
+}
+
+size_t DecompressionCache::size() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _size;
+}
+
+uint64_t DecompressionCache::hit_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _hit_count;
+}
+
+uint64_t DecompressionCache::miss_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _miss_count;
+}
+
+uint64_t DecompressionCache::eviction_count() const {
+  const auto lock = std::lock_guard{_mutex};
+  return _eviction_count;
+}
+
+void DecompressionCache::print(std::ostream& out) const {
+  const auto lock = std::lock_guard{_mutex};
+  out << "DecompressionCache: " << _entries.size() << " segments, " << _size << " of " << _capacity << " bytes, "
+      << _hit_count << " hits, " << _miss_count << " misses, " << _eviction_count << " evictions" << std::endl;
+}
+
+void DecompressionCache::reset() {
+  const auto lock = std::lock_guard{_mutex};
+  _entries.clear();
+  _entry_by_key.clear();
+  _capacity = DEFAULT_CAPACITY;
+  _size = 0;
+  _hit_count = 0;
+  _miss_count = 0;
+  _eviction_count = 0;
+}
+
+uint64_t DecompressionCache::next_key() {
+  static auto next_key = std::atomic<uint64_t>{0};
+  return next_key++;
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// The DecompressionCache is a singleton that keeps the decoded versions of recently accessed LZ4Segments. It holds at
+// most capacity() bytes (as reported by BaseSegment::estimate_memory_usage) and evicts the least recently used
+// segments first. Readers that still use an evicted segment keep it alive until they are done.
+class DecompressionCache : private Noncopyable {
+ public:
+  static DecompressionCache& get();
+
+  // Returns the decoded segment cached under the key. On a miss, decompress is called without holding a lock and its
+  // result is cached unless it is larger than the capacity.
+  std::shared_ptr<const BaseSegment> get_or_decompress(
+      uint64_t key, const std::function<std::shared_ptr<const BaseSegment>()>& decompress);
+
+  // Removes the entry of a segment that is destroyed.
+  void erase(uint64_t key);
+
+  // Sets the capacity in bytes, evicting segments if necessary. Defaults to DEFAULT_CAPACITY.
+  void set_capacity(size_t capacity);
+  size_t capacity() const;
+
+  // Returns the number of bytes of the cached segments.
+  size_t size() const;
+
+  uint64_t hit_count() const;
+  uint64_t miss_count() const;
+  uint64_t eviction_count() const;
+
+  // prints the capacity, size, and counters
+  void print(std::ostream& out = std::cout) const;
+
+  // Drops all cached segments, resets the counters, and restores the default capacity, used especially in tests
+  void reset();
+
+  // returns a new key for a segment
+  static uint64_t next_key();
+
+  static constexpr auto DEFAULT_CAPACITY = size_t{256} * 1024 * 1024;
+
+  DecompressionCache(DecompressionCache&&) = delete;
+
+ protected:
+  DecompressionCache() = default;
+
+  struct Entry {
+    uint64_t key;
+    std::shared_ptr<const BaseSegment> segment;
+    size_t size;
+  };
+
+  // Must be called with _mutex held
+  void _evict(size_t capacity);
+
+  // Most recently used entries come first.
+  std::list<Entry> _entries;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> _entry_by_key;
+
+  size_t _capacity = DEFAULT_CAPACITY;
+  size_t _size = 0;
+  uint64_t _hit_count = 0;
+  uint64_t _miss_count = 0;
+  uint64_t _eviction_count = 0;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,134 @@
+#include "dictionary_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fixed_size_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto segment_size = base_segment->size();
+
+  // Reading the values of a ValueSegment directly avoids the AllTypeVariant round trip of operator[].
+  auto values = std::vector<T>{};
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment)) {
+    values = value_segment->values();
+  } else {
+    values.reserve(segment_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      values.emplace_back(type_cast<T>((*base_segment)[chunk_offset]));
+    }
+  }
+
+  _dictionary = std::make_shared<std::vector<T>>(values);
+  std::sort(_dictionary->begin(), _dictionary->end());
+  _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
+  _dictionary->shrink_to_fit();
+
+  const auto create_attribute_vector = [&](auto value_id_type) {
+    using ValueIDType = decltype(value_id_type);
+    auto attribute_vector = std::make_shared<FixedSizeAttributeVector<ValueIDType>>(segment_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      const auto value_id = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), values[chunk_offset]);
+      attribute_vector->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(value_id - _dictionary->cbegin())});
+    }
+    _attribute_vector = attribute_vector;
+  };
+
+  const auto dictionary_size = _dictionary->size();
+  if (dictionary_size <= size_t{std::numeric_limits<uint8_t>::max()} + 1) {
+    create_attribute_vector(uint8_t{});
+  } else if (dictionary_size <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+    create_attribute_vector(uint16_t{});
+  } else {
+    create_attribute_vector(uint32_t{});
+  }
+}
+
+template <typename T>
+AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  return get(chunk_offset);
+}
+
+template <typename T>
+T DictionarySegment<T>::get(const ChunkOffset chunk_offset) const {
+  return (*_dictionary)[_attribute_vector->get(chunk_offset)];
+}
+
+template <typename T>
+void DictionarySegment<T>::append(const AllTypeVariant&) {
+  Fail("Dictionary segments are immutable");
+}
+
+template <typename T>
+void DictionarySegment<T>::shrink_to_fit() {}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> DictionarySegment<T>::dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> DictionarySegment<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+const T& DictionarySegment<T>::value_by_value_id(const ValueID value_id) const {
+  return _dictionary->at(value_id);
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::lower_bound(const T& value) const {
+  const auto iter = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (iter == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), iter))};
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
+  return lower_bound(type_cast<T>(value));
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::upper_bound(const T& value) const {
+  const auto iter = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (iter == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), iter))};
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
+  return upper_bound(type_cast<T>(value));
+}
+
+template <typename T>
+size_t DictionarySegment<T>::unique_values_count() const {
+  return _dictionary->size();
+}
+
+template <typename T>
+ChunkOffset DictionarySegment<T>::size() const {
+  return static_cast<ChunkOffset>(_attribute_vector->size());
+}
+
+template <typename T>
+size_t DictionarySegment<T>::estimate_memory_usage() const {
+  auto dictionary_memory_usage = size_t{0};
+  for (const auto& value : *_dictionary) {
+    dictionary_memory_usage += value_memory_usage(value);
+  }
+  return dictionary_memory_usage + _attribute_vector->width() * _attribute_vector->size();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
+
+}  // namespace opossum
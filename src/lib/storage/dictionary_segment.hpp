@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// DictionarySegment is a segment type that stores each distinct value once in a sorted dictionary and, for each row,
+// the position of its value in the dictionary (its ValueID) in an attribute vector of the smallest sufficient width.
+// Dictionary segments are immutable; they are created from a full segment, see Table::compress_chunk.
+template <typename T>
+class DictionarySegment : public BaseSegment {
+ public:
+  // Creates a dictionary segment from the values of the given segment.
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // dictionary segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // dictionary segments are created with their final size
+  void shrink_to_fit() override;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const std::vector<T>> dictionary() const;
+
+  // returns an underlying data structure
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+
+  // return the value represented by a given ValueID
+  const T& value_by_value_id(ValueID value_id) const;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  ValueID lower_bound(const T& value) const;
+
+  // same as lower_bound(T), but accepts an AllTypeVariant
+  ValueID lower_bound(const AllTypeVariant& value) const;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  ValueID upper_bound(const T& value) const;
+
+  // same as upper_bound(T), but accepts an AllTypeVariant
+  ValueID upper_bound(const AllTypeVariant& value) const;
+
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const;
+
+  // return the number of entries
+  ChunkOffset size() const override;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _dictionary;
+  std::shared_ptr<BaseAttributeVector> _attribute_vector;
+};
+
+}  // namespace opossum
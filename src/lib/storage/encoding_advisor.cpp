@@ -0,0 +1,266 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "lz4_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The sample consists of this many contiguous blocks, so that runs can be observed within the blocks.
+constexpr auto SAMPLE_BLOCK_COUNT = ChunkOffset{16};
+
+// Width of the ValueIDs of a dictionary with the given number of entries, as chosen by DictionarySegment.
+double value_id_width(const double distinct_count) {
+  if (distinct_count <= 256.0) return 1.0;
+  if (distinct_count <= 65'536.0) return 2.0;
+  return 4.0;
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& stream, const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return stream << "Unencoded";
+    case EncodingType::Dictionary:
+      return stream << "Dictionary";
+    case EncodingType::RunLength:
+      return stream << "RunLength";
+    case EncodingType::LZ4:
+      return stream << "LZ4";
+  }
+  Fail("Unknown encoding type");
+}
+
+EncodingAdvisor::EncodingAdvisor(const EncodingObjective objective, const ChunkOffset sample_size)
+    : _objective(objective), _sample_size(sample_size) {
+  Assert(sample_size >= SAMPLE_BLOCK_COUNT, "Sample size must be at least " + std::to_string(SAMPLE_BLOCK_COUNT));
+}
+
+SegmentStatistics EncodingAdvisor::sample_segment(const BaseSegment& segment, const DataType data_type) const {
+  auto statistics = SegmentStatistics{};
+  statistics.row_count = segment.size();
+  if (statistics.row_count == 0) return statistics;
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment);
+    const auto value_at = [&](const ChunkOffset chunk_offset) {
+      return value_segment ? value_segment->values()[chunk_offset] : type_cast<ColumnDataType>(segment[chunk_offset]);
+    };
+
+    // Small segments are read completely, which makes all estimates exact.
+    const auto row_count = statistics.row_count;
+    const auto block_count = row_count <= _sample_size ? ChunkOffset{1} : SAMPLE_BLOCK_COUNT;
+    const auto block_length = row_count <= _sample_size ? row_count : _sample_size / SAMPLE_BLOCK_COUNT;
+
+    auto sample = std::vector<ColumnDataType>{};
+    sample.reserve(static_cast<size_t>(block_count) * block_length);
+    auto neighbor_count = uint64_t{0};
+    auto value_change_count = uint64_t{0};
+    for (auto block_index = ChunkOffset{0}; block_index < block_count; ++block_index) {
+      const auto block_begin = block_count == 1 ? ChunkOffset{0}
+                                                : static_cast<ChunkOffset>(uint64_t{block_index} *
+                                                                           (row_count - block_length) /
+                                                                           (block_count - 1));
+      for (auto chunk_offset = block_begin; chunk_offset < block_begin + block_length; ++chunk_offset) {
+        sample.emplace_back(value_at(chunk_offset));
+        if (chunk_offset == block_begin) continue;
+        ++neighbor_count;
+        value_change_count += !(sample[sample.size() - 1] == sample[sample.size() - 2]);
+      }
+    }
+    statistics.sampled_row_count = static_cast<ChunkOffset>(sample.size());
+
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      auto total_length = size_t{0};
+      for (const auto& value : sample) {
+        total_length += value.size();
+      }
+      statistics.average_string_length = static_cast<double>(total_length) / sample.size();
+    }
+
+    // Every value change within a block starts a new run.
+    const auto change_rate = neighbor_count == 0 ? 1.0 : static_cast<double>(value_change_count) / neighbor_count;
+    statistics.run_count = 1.0 + change_rate * (row_count - 1);
+
+    std::sort(sample.begin(), sample.end());
+    statistics.min_value = sample.front();
+    statistics.max_value = sample.back();
+
+    auto sample_distinct_count = size_t{0};
+    auto singleton_count = size_t{0};
+    for (auto begin = sample.cbegin(); begin != sample.cend();) {
+      const auto end = std::upper_bound(begin, sample.cend(), *begin);
+      ++sample_distinct_count;
+      singleton_count += std::distance(begin, end) == 1;
+      begin = end;
+    }
+
+    // GEE: values seen once in the sample stand for sqrt(row_count / sample_size) distinct values each, values seen
+    // more often are assumed to be frequent ones that were all seen.
+    const auto scale = std::sqrt(static_cast<double>(row_count) / statistics.sampled_row_count);
+    const auto estimate = scale * singleton_count + static_cast<double>(sample_distinct_count - singleton_count);
+    statistics.distinct_count =
+        std::clamp(estimate, static_cast<double>(sample_distinct_count), static_cast<double>(row_count));
+  });
+
+  return statistics;
+}
+
+EncodingType EncodingAdvisor::choose_encoding(const SegmentStatistics& statistics, const DataType data_type) const {
+  auto value_width = 0.0;
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    value_width = sizeof(ColumnDataType) + statistics.average_string_length;
+  });
+
+  const auto row_count = static_cast<double>(statistics.row_count);
+  const auto dictionary_size = statistics.distinct_count * value_width;
+  const auto attribute_vector_size = row_count * value_id_width(statistics.distinct_count);
+  const auto runs_size = statistics.run_count * (value_width + sizeof(ChunkOffset));
+
+  // Costs in the order of EncodingType
+  auto costs = std::array<double, 3>{};
+  if (_objective == EncodingObjective::MinMemory) {
+    costs = {row_count * value_width, dictionary_size + attribute_vector_size, runs_size};
+  } else {
+    // Scans compare the ValueIDs of dictionary segments after one binary search in the dictionary. Run-length
+    // segments are decoded into the batches of the scan, so they cost more than unencoded ones.
+    costs = {row_count * value_width, attribute_vector_size + std::log2(statistics.distinct_count + 1) * value_width,
+             runs_size + row_count * value_width};
+  }
+
+  // Unencoded wins ties, as it is the cheapest one to write and to read row by row.
+  const auto cheapest = std::min_element(costs.cbegin(), costs.cend());
+  return static_cast<EncodingType>(std::distance(costs.cbegin(), cheapest));
+}
+
+void EncodingAdvisor::encode_chunk(Chunk& chunk, const ChunkID chunk_id, const std::vector<DataType>& column_types) {
+  Assert(chunk.is_finalized(), "Only finalized chunks can be encoded");
+  Assert(column_types.size() == chunk.column_count(), "Number of column types does not match the chunk");
+
+  auto chunk_decisions = std::vector<EncodingDecision>{};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto data_type = column_types[column_id];
+    const auto segment = chunk.get_segment(column_id);
+
+    auto is_unencoded = false;
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      is_unencoded = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment) != nullptr;
+    });
+    if (!is_unencoded) continue;
+
+    const auto statistics = sample_segment(*segment, data_type);
+    const auto encoding_type = choose_encoding(statistics, data_type);
+    auto encoded_segment = segment;
+    if (encoding_type != EncodingType::Unencoded) {
+      encoded_segment = encode_segment(segment, data_type, encoding_type);
+      chunk.replace_segment(column_id, encoded_segment);
+    }
+
+    chunk_decisions.push_back({chunk_id, column_id, encoding_type, statistics, segment->estimate_memory_usage(),
+                               encoded_segment->estimate_memory_usage()});
+  }
+
+  const auto lock = std::lock_guard{_decisions_mutex};
+  _decisions.insert(_decisions.end(), chunk_decisions.begin(), chunk_decisions.end());
+}
+
+std::vector<EncodingDecision> EncodingAdvisor::decisions() const {
+  const auto lock = std::lock_guard{_decisions_mutex};
+  return _decisions;
+}
+
+double EncodingAdvisor::compression_ratio(const ColumnID column_id) const {
+  const auto lock = std::lock_guard{_decisions_mutex};
+  auto unencoded_memory_usage = size_t{0};
+  auto encoded_memory_usage = size_t{0};
+  for (const auto& decision : _decisions) {
+    if (decision.column_id != column_id) continue;
+    unencoded_memory_usage += decision.unencoded_memory_usage;
+    encoded_memory_usage += decision.encoded_memory_usage;
+  }
+  if (encoded_memory_usage == 0) return 1.0;
+  return static_cast<double>(unencoded_memory_usage) / encoded_memory_usage;
+}
+
+void EncodingAdvisor::print(std::ostream& stream, const std::vector<std::string>& column_names) const {
+  const auto all_decisions = decisions();
+  stream << "Encoding decisions (" << (_objective == EncodingObjective::MinMemory ? "min memory" : "min scan cost")
+         << ", " << all_decisions.size() << " segments):" << std::endl;
+
+  for (auto column_id = ColumnID{0}; column_id < column_names.size(); ++column_id) {
+    auto chunk_counts = std::map<EncodingType, size_t>{};
+    auto unencoded_memory_usage = size_t{0};
+    auto encoded_memory_usage = size_t{0};
+    for (const auto& decision : all_decisions) {
+      if (decision.column_id != column_id) continue;
+      ++chunk_counts[decision.encoding_type];
+      unencoded_memory_usage += decision.unencoded_memory_usage;
+      encoded_memory_usage += decision.encoded_memory_usage;
+    }
+    if (chunk_counts.empty()) continue;
+
+    stream << "  " << column_names[column_id] << ":";
+    for (const auto& [encoding_type, chunk_count] : chunk_counts) {
+      stream << " " << encoding_type << " x" << chunk_count;
+    }
+    stream << ", " << unencoded_memory_usage << " -> " << encoded_memory_usage << " bytes, ratio " << std::fixed
+           << std::setprecision(2) << compression_ratio(column_id) << std::defaultfloat << std::endl;
+  }
+}
+
+std::shared_ptr<BaseSegment> encode_segment(const std::shared_ptr<BaseSegment>& segment, const DataType data_type,
+                                            const EncodingType encoding_type) {
+  auto encoded_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    switch (encoding_type) {
+      case EncodingType::Unencoded: {
+        if (std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) {
+          encoded_segment = segment;
+          return;
+        }
+        auto values = std::vector<ColumnDataType>{};
+        values.reserve(segment->size());
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+          values.emplace_back(type_cast<ColumnDataType>((*segment)[chunk_offset]));
+        }
+        encoded_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+        return;
+      }
+      case EncodingType::Dictionary:
+        encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(segment);
+        return;
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<ColumnDataType>>(segment);
+        return;
+      case EncodingType::LZ4:
+        encoded_segment = std::make_shared<LZ4Segment<ColumnDataType>>(segment);
+        return;
+    }
+    Fail("Unknown encoding type");
+  });
+  return encoded_segment;
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// LZ4 is meant for cold chunks (see Table::compress_cold_chunk) and not chosen by the EncodingAdvisor.
+enum class EncodingType { Unencoded, Dictionary, RunLength, LZ4 };
+
+std::ostream& operator<<(std::ostream& stream, EncodingType encoding_type);
+
+// What the advisor optimizes for. MinMemory picks the encoding with the smallest footprint. MinScanCost picks the
+// encoding that a TableScan reads the fewest bytes of, e.g., a dictionary with narrow ValueIDs for a string column,
+// even if run-length encoding would be smaller.
+enum class EncodingObjective { MinMemory, MinScanCost };
+
+// Properties of a segment estimated from a sample of its rows.
+struct SegmentStatistics {
+  ChunkOffset row_count = 0;
+  ChunkOffset sampled_row_count = 0;
+  double distinct_count = 0.0;
+  double run_count = 0.0;
+  AllTypeVariant min_value;
+  AllTypeVariant max_value;
+  double average_string_length = 0.0;
+};
+
+// The encoding chosen for one segment and the memory usage before and after encoding it.
+struct EncodingDecision {
+  ChunkID chunk_id;
+  ColumnID column_id;
+  EncodingType encoding_type;
+  SegmentStatistics statistics;
+  size_t unencoded_memory_usage;
+  size_t encoded_memory_usage;
+};
+
+// Picks an encoding for each segment of a finalized chunk and applies it. Tables call the advisor whenever they
+// finalize a chunk if one is set, see Table::set_encoding_advisor.
+//
+// The segments are not encoded with every candidate to find the best one. Instead, the advisor reads a sample of
+// sample_size rows in a few contiguous blocks spread over the segment, estimates the number of distinct values (with
+// the GEE estimator by Charikar et al.), the number of runs, the value range, and the string lengths, and compares the
+// costs that follow from these for each encoding. All decisions are recorded, so that the achieved compression can
+// be checked per column.
+class EncodingAdvisor {
+ public:
+  explicit EncodingAdvisor(EncodingObjective objective = EncodingObjective::MinMemory,
+                           ChunkOffset sample_size = DEFAULT_SAMPLE_SIZE);
+
+  // Estimates the properties of a segment of the given type.
+  SegmentStatistics sample_segment(const BaseSegment& segment, DataType data_type) const;
+
+  // Returns the cheapest encoding under the objective for a segment with the given properties.
+  EncodingType choose_encoding(const SegmentStatistics& statistics, DataType data_type) const;
+
+  // Chooses an encoding for each segment of the chunk, replaces the segments with their encoded versions, and records
+  // the decisions. Segments that are already encoded are left as they are.
+  void encode_chunk(Chunk& chunk, ChunkID chunk_id, const std::vector<DataType>& column_types);
+
+  // Returns all decisions taken so far.
+  std::vector<EncodingDecision> decisions() const;
+
+  // Returns the memory usage of the column before encoding divided by that after encoding, over all chunks encoded so
+  // far. 1.0 if no chunk was encoded yet.
+  double compression_ratio(ColumnID column_id) const;
+
+  // Prints the chosen encodings and the compression ratio per column.
+  void print(std::ostream& stream, const std::vector<std::string>& column_names) const;
+
+  static constexpr auto DEFAULT_SAMPLE_SIZE = ChunkOffset{4'096};
+
+ protected:
+  const EncodingObjective _objective;
+  const ChunkOffset _sample_size;
+
+  std::vector<EncodingDecision> _decisions;
+  mutable std::mutex _decisions_mutex;
+};
+
+// Returns a segment with the values of the given one in the given encoding.
+std::shared_ptr<BaseSegment> encode_segment(const std::shared_ptr<BaseSegment>& segment, DataType data_type,
+                                            EncodingType encoding_type);
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#include "fixed_size_attribute_vector.hpp"
+
+#include <limits>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+FixedSizeAttributeVector<uintX_t>::FixedSizeAttributeVector(const size_t size) : _value_ids(size) {}
+
+template <typename uintX_t>
+ValueID FixedSizeAttributeVector<uintX_t>::get(const size_t i) const {
+  return ValueID{_value_ids.at(i)};
+}
+
+template <typename uintX_t>
+void FixedSizeAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  DebugAssert(value_id <= std::numeric_limits<uintX_t>::max(), "ValueID does not fit into the attribute vector");
+  _value_ids.at(i) = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+size_t FixedSizeAttributeVector<uintX_t>::size() const {
+  return _value_ids.size();
+}
+
+template <typename uintX_t>
+AttributeVectorWidth FixedSizeAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+const std::vector<uintX_t>& FixedSizeAttributeVector<uintX_t>::values() const {
+  return _value_ids;
+}
+
+template class FixedSizeAttributeVector<uint8_t>;
+template class FixedSizeAttributeVector<uint16_t>;
+template class FixedSizeAttributeVector<uint32_t>;
+
+}  // namespace opossum
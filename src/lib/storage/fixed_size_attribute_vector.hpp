@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+// FixedSizeAttributeVector stores ValueIDs in the smallest unsigned integer type that fits all of them, i.e.,
+// uint8_t, uint16_t, or uint32_t.
+template <typename uintX_t>
+class FixedSizeAttributeVector : public BaseAttributeVector {
+ public:
+  explicit FixedSizeAttributeVector(size_t size);
+
+  ValueID get(const size_t i) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  // Returns the ValueIDs in their compact representation. Scans use this to compare many ValueIDs at once instead of
+  // calling get() for each of them.
+  const std::vector<uintX_t>& values() const;
+
+ protected:
+  std::vector<uintX_t> _value_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision(precision) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLog precision must be between 4 and 18");
+  _registers.resize(size_t{1} << precision);
+}
+
+void HyperLogLog::insert(const uint64_t hash) {
+  const auto register_index = hash >> (64 - _precision);
+  // The bit below the remaining bits bounds the rank if they are all zero.
+  const auto remaining_bits = (hash << _precision) | (uint64_t{1} << (_precision - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+  _registers[register_index] = std::max(_registers[register_index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(_precision == other._precision, "Only sketches with the same precision can be merged");
+  for (auto register_index = size_t{0}; register_index < _registers.size(); ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    zero_register_count += rank == 0;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // The raw estimate is biased for small counts, where linear counting over the empty registers is more accurate.
+  // With 64-bit hashes, there is no correction needed for large counts.
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+  return raw_estimate;
+}
+
+double HyperLogLog::relative_standard_error() const { return 1.04 / std::sqrt(static_cast<double>(_registers.size())); }
+
+uint8_t HyperLogLog::precision() const { return _precision; }
+
+size_t HyperLogLog::memory_usage() const { return sizeof(*this) + _registers.size(); }
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+// A HyperLogLog sketch (Flajolet et al.) estimates the number of distinct values it has seen in a few KB, no matter
+// how many values there are. The hash of a value selects one of 2^precision registers, which keeps the longest run of
+// leading zeros among the remaining bits of the hashes it saw. The relative standard error is about
+// 1.04 / sqrt(2^precision), i.e., 1.6% for the default precision.
+//
+// Sketches are mergeable: The sketch of a union of sets is the register-wise maximum of the sketches of the sets.
+// Tables can build a sketch for each segment when a chunk is finalized (see Table::set_hyper_log_log_enabled), so
+// that the distinct count of a column is estimated by merging the sketches of its chunks instead of reading its values.
+class HyperLogLog {
+ public:
+  explicit HyperLogLog(uint8_t precision = DEFAULT_PRECISION);
+
+  // Takes the value_hash of a value.
+  void insert(uint64_t hash);
+
+  // Adds the values seen by the other sketch, which must have the same precision.
+  void merge(const HyperLogLog& other);
+
+  double estimate() const;
+
+  // The standard error of the estimate relative to the true distinct count.
+  double relative_standard_error() const;
+
+  uint8_t precision() const;
+  size_t memory_usage() const;
+
+  static constexpr auto DEFAULT_PRECISION = uint8_t{12};
+
+ protected:
+  uint8_t _precision;
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,139 @@
+#include "lz4_segment.hpp"
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "decompression_cache.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+LZ4Segment<T>::LZ4Segment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _size(base_segment->size()), _cache_key(DecompressionCache::next_key()) {
+  auto values = std::vector<T>{};
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment)) {
+    values = value_segment->values();
+  } else {
+    values.reserve(_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+      values.emplace_back(type_cast<T>((*base_segment)[chunk_offset]));
+    }
+  }
+
+  auto serialized_values = std::vector<char>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto lengths = std::vector<uint32_t>{};
+    lengths.reserve(values.size());
+    auto total_length = size_t{0};
+    for (const auto& value : values) {
+      lengths.emplace_back(static_cast<uint32_t>(value.size()));
+      total_length += value.size();
+    }
+    serialized_values.resize(sizeof(uint32_t) * lengths.size() + total_length);
+    auto* characters = serialized_values.data() + sizeof(uint32_t) * lengths.size();
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      std::memcpy(serialized_values.data() + sizeof(uint32_t) * index, &lengths[index], sizeof(uint32_t));
+      std::copy(values[index].cbegin(), values[index].cend(), characters);
+      characters += values[index].size();
+    }
+  } else {
+    serialized_values.resize(sizeof(T) * values.size());
+    if (!values.empty()) std::memcpy(serialized_values.data(), values.data(), serialized_values.size());
+  }
+  _uncompressed_size = serialized_values.size();
+
+  auto block_buffer = std::vector<char>(LZ4_compressBound(static_cast<int>(BLOCK_SIZE)));
+  for (auto block_begin = size_t{0}; block_begin < _uncompressed_size; block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, _uncompressed_size - block_begin);
+    const auto compressed_size =
+        LZ4_compress_default(serialized_values.data() + block_begin, block_buffer.data(),
+                             static_cast<int>(block_size), static_cast<int>(block_buffer.size()));
+    Assert(compressed_size > 0, "LZ4 compression failed");
+    _compressed_data.insert(_compressed_data.end(), block_buffer.begin(), block_buffer.begin() + compressed_size);
+    _block_ends.emplace_back(_compressed_data.size());
+  }
+  _compressed_data.shrink_to_fit();
+  _block_ends.shrink_to_fit();
+}
+
+template <typename T>
+LZ4Segment<T>::~LZ4Segment() {
+  DecompressionCache::get().erase(_cache_key);
+}
+
+template <typename T>
+AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) const {
+  return decompress()->values().at(chunk_offset);
+}
+
+template <typename T>
+void LZ4Segment<T>::append(const AllTypeVariant&) {
+  Fail("LZ4 segments are immutable");
+}
+
+template <typename T>
+void LZ4Segment<T>::shrink_to_fit() {}
+
+template <typename T>
+ChunkOffset LZ4Segment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::estimate_memory_usage() const {
+  return _compressed_data.size() + sizeof(size_t) * _block_ends.size();
+}
+
+template <typename T>
+size_t LZ4Segment<T>::uncompressed_size() const {
+  return _uncompressed_size;
+}
+
+template <typename T>
+std::shared_ptr<const ValueSegment<T>> LZ4Segment<T>::decompress() const {
+  const auto segment = DecompressionCache::get().get_or_decompress(_cache_key, [&]() { return _decompress(); });
+  return std::static_pointer_cast<const ValueSegment<T>>(segment);
+}
+
+template <typename T>
+std::shared_ptr<const ValueSegment<T>> LZ4Segment<T>::_decompress() const {
+  auto serialized_values = std::vector<char>(_uncompressed_size);
+  auto block_begin = size_t{0};
+  for (auto block_index = size_t{0}; block_index < _block_ends.size(); ++block_index) {
+    const auto compressed_begin = block_index == 0 ? size_t{0} : _block_ends[block_index - 1];
+    const auto block_size = std::min(BLOCK_SIZE, _uncompressed_size - block_begin);
+    const auto compressed_size = static_cast<int>(_block_ends[block_index] - compressed_begin);
+    const auto decompressed_size =
+        LZ4_decompress_safe(_compressed_data.data() + compressed_begin, serialized_values.data() + block_begin,
+                            compressed_size, static_cast<int>(block_size));
+    Assert(decompressed_size == static_cast<int>(block_size), "LZ4 decompression failed");
+    block_begin += block_size;
+  }
+
+  auto values = std::vector<T>(_size);
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto* characters = serialized_values.data() + sizeof(uint32_t) * _size;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+      auto length = uint32_t{0};
+      std::memcpy(&length, serialized_values.data() + sizeof(uint32_t) * chunk_offset, sizeof(uint32_t));
+      values[chunk_offset].assign(characters, length);
+      characters += length;
+    }
+  } else {
+    if (_size > 0) std::memcpy(values.data(), serialized_values.data(), _uncompressed_size);
+  }
+  return std::make_shared<const ValueSegment<T>>(std::move(values));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(LZ4Segment);
+
+}  // namespace opossum
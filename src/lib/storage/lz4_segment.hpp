@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// LZ4Segment keeps the values of a rarely accessed segment compressed with LZ4. The values are serialized (strings as
+// their lengths followed by their characters) and compressed in independent blocks of BLOCK_SIZE bytes.
+//
+// Reading a value decompresses the whole segment into a ValueSegment, which is kept in the DecompressionCache. Thus,
+// only the first access after the segment was evicted from the cache pays for decompressing it, and scans read the
+// decoded values like those of any other ValueSegment. LZ4Segments are immutable; they are created from a full
+// segment, see Table::compress_cold_chunk.
+template <typename T>
+class LZ4Segment : public BaseSegment {
+ public:
+  // Creates an LZ4 segment from the values of the given segment.
+  explicit LZ4Segment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  ~LZ4Segment() override;
+
+  // return the value at a certain position. This decompresses the segment unless it is cached.
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // LZ4 segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // LZ4 segments are created with their final size
+  void shrink_to_fit() override;
+
+  ChunkOffset size() const override;
+
+  // returns the size of the compressed data, not including the decompressed segment in the DecompressionCache
+  size_t estimate_memory_usage() const override;
+
+  // returns the number of bytes of the serialized values before compressing them
+  size_t uncompressed_size() const;
+
+  // Returns the decompressed values, from the DecompressionCache if possible
+  std::shared_ptr<const ValueSegment<T>> decompress() const;
+
+  static constexpr auto BLOCK_SIZE = size_t{64} * 1024;
+
+ protected:
+  std::shared_ptr<const ValueSegment<T>> _decompress() const;
+
+  ChunkOffset _size;
+  size_t _uncompressed_size;
+  std::vector<char> _compressed_data;
+
+  // The offset of the end of each block in _compressed_data
+  std::vector<size_t> _block_ends;
+
+  const uint64_t _cache_key;
+};
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#include "mvcc_data.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MvccData::MvccData(const ChunkOffset capacity) : tids(capacity), begin_cids(capacity), end_cids(capacity) {}
+
+ChunkOffset MvccData::size() const { return _size.load(std::memory_order_acquire); }
+
+void MvccData::append_row(const CommitID begin_commit_id, const TransactionID transaction_id) {
+  const auto chunk_offset = _size.load(std::memory_order_relaxed);
+  Assert(chunk_offset < capacity(), "MvccData is full. Its capacity is " + std::to_string(capacity()));
+
+  tids[chunk_offset] = transaction_id;
+  begin_cids[chunk_offset] = begin_commit_id;
+  end_cids[chunk_offset] = MAX_COMMIT_ID;
+
+  // Release the entries (and the values the caller appended to the segments before) to readers.
+  _size.store(chunk_offset + 1, std::memory_order_release);
+}
+
+ChunkOffset MvccData::capacity() const { return static_cast<ChunkOffset>(tids.size()); }
+
+}  // namespace opossum
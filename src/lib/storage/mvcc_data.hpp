@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Multi-version concurrency control information for the rows of a chunk, stored column-wise.
+//
+// For every row, it holds the ID of the transaction that currently locks the row (i.e., inserts or deletes it), the
+// ID of the commit that made the row visible (begin), and the ID of the commit that deleted it (end). A row is
+// visible to a transaction if it was committed before the transaction's snapshot and not deleted before it, see
+// Validate. All entries are atomics so that readers can check visibility while writers change them.
+//
+// The vectors are allocated for the full capacity of the chunk upfront, as vectors of atomics cannot grow. Writers
+// publish new rows by increasing size() after initializing their entries.
+class MvccData : private Noncopyable {
+ public:
+  explicit MvccData(ChunkOffset capacity);
+
+  // Returns the number of rows whose entries were initialized. Readers must not look at rows beyond it.
+  ChunkOffset size() const;
+
+  // Initializes the entries of the next row and publishes it. Not thread-safe, writers must be serialized.
+  void append_row(CommitID begin_commit_id, TransactionID transaction_id);
+
+  ChunkOffset capacity() const;
+
+  std::vector<std::atomic<TransactionID>> tids;
+  std::vector<std::atomic<CommitID>> begin_cids;
+  std::vector<std::atomic<CommitID>> end_cids;
+
+ protected:
+  std::atomic<ChunkOffset> _size{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "partition_schema.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+AbstractPartitionSchema::AbstractPartitionSchema(const ColumnID column_id, const DataType data_type)
+    : _column_id(column_id), _data_type(data_type) {}
+
+ColumnID AbstractPartitionSchema::column_id() const { return _column_id; }
+
+HashPartitionSchema::HashPartitionSchema(const ColumnID column_id, const DataType data_type,
+                                         const PartitionID partition_count)
+    : AbstractPartitionSchema(column_id, data_type), _partition_count(partition_count) {
+  Assert(partition_count > 0, "Hash partitioning needs at least one partition");
+}
+
+PartitionID HashPartitionSchema::partition_count() const { return _partition_count; }
+
+PartitionID HashPartitionSchema::partition_of(const AllTypeVariant& key) const {
+  auto hash = uint64_t{0};
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    hash = value_hash(type_cast<ColumnDataType>(key));
+  });
+  return static_cast<PartitionID>(hash % _partition_count);
+}
+
+bool HashPartitionSchema::may_match(const PartitionID partition_id, const ScanType scan_type,
+                                    const AllTypeVariant& value) const {
+  return scan_type != ScanType::OpEquals || partition_of(value) == partition_id;
+}
+
+std::string HashPartitionSchema::description() const {
+  return "Hash (#" + std::to_string(_column_id) + ", " + std::to_string(_partition_count) + " partitions)";
+}
+
+RangePartitionSchema::RangePartitionSchema(const ColumnID column_id, const DataType data_type,
+                                           std::vector<AllTypeVariant> boundaries)
+    : AbstractPartitionSchema(column_id, data_type), _boundaries(std::move(boundaries)) {
+  Assert(_boundaries.size() < std::numeric_limits<PartitionID::base_type>::max(), "Too many range boundaries");
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    for (auto index = size_t{1}; index < _boundaries.size(); ++index) {
+      Assert(type_cast<ColumnDataType>(_boundaries[index - 1]) < type_cast<ColumnDataType>(_boundaries[index]),
+             "Range boundaries must be strictly ascending");
+    }
+  });
+}
+
+PartitionID RangePartitionSchema::partition_count() const {
+  return static_cast<PartitionID>(_boundaries.size() + 1);
+}
+
+PartitionID RangePartitionSchema::partition_of(const AllTypeVariant& key) const {
+  auto partition_id = PartitionID{0};
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto typed_key = type_cast<ColumnDataType>(key);
+    const auto boundary = std::upper_bound(
+        _boundaries.begin(), _boundaries.end(), typed_key,
+        [](const auto& value, const auto& boundary) { return value < type_cast<ColumnDataType>(boundary); });
+    partition_id = static_cast<PartitionID>(boundary - _boundaries.begin());
+  });
+  return partition_id;
+}
+
+bool RangePartitionSchema::may_match(const PartitionID partition_id, const ScanType scan_type,
+                                     const AllTypeVariant& value) const {
+  auto may_match = true;
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto typed_value = type_cast<ColumnDataType>(value);
+
+    // The keys of the partition lie in [lower_bound, upper_bound), where missing bounds are unlimited.
+    const auto has_lower_bound = partition_id > 0;
+    const auto has_upper_bound = partition_id < _boundaries.size();
+    const auto lower_bound =
+        has_lower_bound ? type_cast<ColumnDataType>(_boundaries[partition_id - 1]) : ColumnDataType{};
+    const auto upper_bound = has_upper_bound ? type_cast<ColumnDataType>(_boundaries[partition_id]) : ColumnDataType{};
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        may_match = (!has_lower_bound || lower_bound <= typed_value) && (!has_upper_bound || typed_value < upper_bound);
+        break;
+      case ScanType::OpNotEquals:
+      case ScanType::OpLike:
+      case ScanType::OpNotLike:
+        may_match = true;
+        break;
+      case ScanType::OpLessThan:
+        may_match = !has_lower_bound || lower_bound < typed_value;
+        break;
+      case ScanType::OpLessThanEquals:
+        may_match = !has_lower_bound || lower_bound <= typed_value;
+        break;
+      case ScanType::OpGreaterThan:
+      case ScanType::OpGreaterThanEquals:
+        may_match = !has_upper_bound || typed_value < upper_bound;
+        break;
+    }
+  });
+  return may_match;
+}
+
+std::string RangePartitionSchema::description() const {
+  auto stream = std::stringstream{};
+  stream << "Range (#" << _column_id << ", boundaries";
+  for (const auto& boundary : _boundaries) {
+    stream << " " << boundary;
+  }
+  stream << ")";
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Describes how the rows of a table are assigned to partitions by the value of a key column, see
+// Table::create_hash_partitioning and Table::create_range_partitioning. Keys are given as AllTypeVariants and
+// converted to the type of the key column, so a schema is only consulted once per row or chunk, not per value scanned.
+class AbstractPartitionSchema : private Noncopyable {
+ public:
+  AbstractPartitionSchema(ColumnID column_id, DataType data_type);
+  virtual ~AbstractPartitionSchema() = default;
+
+  ColumnID column_id() const;
+
+  virtual PartitionID partition_count() const = 0;
+
+  // Returns the partition that holds the rows with the given key.
+  virtual PartitionID partition_of(const AllTypeVariant& key) const = 0;
+
+  // Returns false if no key of the partition can satisfy `key scan_type value`, so that scans can skip its chunks.
+  virtual bool may_match(PartitionID partition_id, ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  virtual std::string description() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+  const DataType _data_type;
+};
+
+// Spreads the keys evenly over the partitions by their value_hash, which keeps partitions balanced for any key
+// distribution but only allows equality predicates to skip partitions.
+class HashPartitionSchema : public AbstractPartitionSchema {
+ public:
+  HashPartitionSchema(ColumnID column_id, DataType data_type, PartitionID partition_count);
+
+  PartitionID partition_count() const override;
+  PartitionID partition_of(const AllTypeVariant& key) const override;
+  bool may_match(PartitionID partition_id, ScanType scan_type, const AllTypeVariant& value) const override;
+  std::string description() const override;
+
+ protected:
+  const PartitionID _partition_count;
+};
+
+// Assigns the keys to ranges delimited by ascending boundaries: With n boundaries, there are n + 1 partitions, and
+// partition p holds the keys in [boundaries[p - 1], boundaries[p]). The first partition has no lower bound, the last
+// none upper bound. Equality and range predicates skip the partitions that do not overlap with them.
+class RangePartitionSchema : public AbstractPartitionSchema {
+ public:
+  RangePartitionSchema(ColumnID column_id, DataType data_type, std::vector<AllTypeVariant> boundaries);
+
+  PartitionID partition_count() const override;
+  PartitionID partition_of(const AllTypeVariant& key) const override;
+  bool may_match(PartitionID partition_id, ScanType scan_type, const AllTypeVariant& value) const override;
+  std::string description() const override;
+
+ protected:
+  const std::vector<AllTypeVariant> _boundaries;
+};
+
+}  // namespace opossum
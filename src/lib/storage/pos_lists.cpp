@@ -0,0 +1,221 @@
+#include "pos_lists.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RowIDPosList::RowIDPosList(PosList positions) : _positions(std::move(positions)) {
+  if (_positions.empty()) return;
+  for (auto index = size_t{1}; index < _positions.size(); ++index) {
+    if (_positions[index].chunk_id != _positions[0].chunk_id ||
+        _positions[index].chunk_offset <= _positions[index - 1].chunk_offset) {
+      return;
+    }
+  }
+  _ordered_chunk_id = _positions[0].chunk_id;
+}
+
+size_t RowIDPosList::size() const { return _positions.size(); }
+
+RowID RowIDPosList::operator[](const size_t index) const { return _positions[index]; }
+
+void RowIDPosList::copy_positions(const size_t begin, const size_t count, RowID* out) const {
+  std::copy_n(_positions.cbegin() + begin, count, out);
+}
+
+std::optional<ChunkID> RowIDPosList::ordered_chunk_id() const { return _ordered_chunk_id; }
+
+std::optional<RowID> RowIDPosList::contiguous_begin(const size_t begin, const size_t count) const {
+  if (!_ordered_chunk_id || count == 0) return std::nullopt;
+  // The offsets are strictly ascending, so they are consecutive if the first and the last are count - 1 apart.
+  const auto& first = _positions[begin];
+  if (_positions[begin + count - 1].chunk_offset - first.chunk_offset != count - 1) return std::nullopt;
+  return first;
+}
+
+size_t RowIDPosList::estimate_memory_usage() const { return sizeof(RowID) * _positions.size(); }
+
+const PosList& RowIDPosList::positions() const { return _positions; }
+
+EntireChunkPosList::EntireChunkPosList(const ChunkID chunk_id, const ChunkOffset size)
+    : _chunk_id(chunk_id), _size(size) {}
+
+size_t EntireChunkPosList::size() const { return _size; }
+
+RowID EntireChunkPosList::operator[](const size_t index) const {
+  return RowID{_chunk_id, static_cast<ChunkOffset>(index)};
+}
+
+void EntireChunkPosList::copy_positions(const size_t begin, const size_t count, RowID* out) const {
+  for (auto index = size_t{0}; index < count; ++index) {
+    out[index] = RowID{_chunk_id, static_cast<ChunkOffset>(begin + index)};
+  }
+}
+
+std::optional<ChunkID> EntireChunkPosList::ordered_chunk_id() const { return _chunk_id; }
+
+std::optional<RowID> EntireChunkPosList::contiguous_begin(const size_t begin, const size_t count) const {
+  if (count == 0) return std::nullopt;
+  return RowID{_chunk_id, static_cast<ChunkOffset>(begin)};
+}
+
+size_t EntireChunkPosList::estimate_memory_usage() const { return sizeof(*this); }
+
+RangePosList::RangePosList(const ChunkID chunk_id, std::vector<Run> runs, const size_t size)
+    : _chunk_id(chunk_id), _runs(std::move(runs)), _size(size) {
+  DebugAssert(_runs.empty() || _runs.front().index == 0, "The first run has to start at the first position");
+}
+
+size_t RangePosList::size() const { return _size; }
+
+RowID RangePosList::operator[](const size_t index) const {
+  const auto& run = _runs[_run_index(index)];
+  return RowID{_chunk_id, static_cast<ChunkOffset>(run.chunk_offset + (index - run.index))};
+}
+
+void RangePosList::copy_positions(const size_t begin, const size_t count, RowID* out) const {
+  if (count == 0) return;
+  const auto end = begin + count;
+  auto index = begin;
+  for (auto run_index = _run_index(begin); index < end; ++run_index) {
+    const auto& run = _runs[run_index];
+    const auto run_end = std::min(end, run_index + 1 < _runs.size() ? size_t{_runs[run_index + 1].index} : _size);
+    for (; index < run_end; ++index) {
+      *out++ = RowID{_chunk_id, static_cast<ChunkOffset>(run.chunk_offset + (index - run.index))};
+    }
+  }
+}
+
+std::optional<ChunkID> RangePosList::ordered_chunk_id() const { return _chunk_id; }
+
+std::optional<RowID> RangePosList::contiguous_begin(const size_t begin, const size_t count) const {
+  if (count == 0) return std::nullopt;
+  const auto run_index = _run_index(begin);
+  const auto run_end = run_index + 1 < _runs.size() ? size_t{_runs[run_index + 1].index} : _size;
+  if (begin + count > run_end) return std::nullopt;
+  const auto& run = _runs[run_index];
+  return RowID{_chunk_id, static_cast<ChunkOffset>(run.chunk_offset + (begin - run.index))};
+}
+
+size_t RangePosList::estimate_memory_usage() const { return sizeof(Run) * _runs.size(); }
+
+const std::vector<RangePosList::Run>& RangePosList::runs() const { return _runs; }
+
+size_t RangePosList::_run_index(const size_t index) const {
+  const auto run = std::upper_bound(_runs.cbegin(), _runs.cend(), index,
+                                    [](const size_t value, const Run& run) { return value < run.index; });
+  return static_cast<size_t>(run - _runs.cbegin()) - 1;
+}
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets)
+    : _chunk_id(chunk_id), _size(chunk_offsets.size()) {
+  if (chunk_offsets.empty()) return;
+  DebugAssert(std::is_sorted(chunk_offsets.cbegin(), chunk_offsets.cend()), "Offsets have to be ascending");
+
+  _words.resize(chunk_offsets.back() / 64 + 1);
+  for (const auto chunk_offset : chunk_offsets) {
+    _words[chunk_offset / 64] |= uint64_t{1} << (chunk_offset % 64);
+  }
+  _ranks.reserve(_words.size());
+  auto rank = uint32_t{0};
+  for (const auto word : _words) {
+    _ranks.emplace_back(rank);
+    rank += static_cast<uint32_t>(__builtin_popcountll(word));
+  }
+}
+
+size_t BitmapPosList::size() const { return _size; }
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  const auto word_index = _word_index(index);
+  auto word = _words[word_index];
+  // Clears the set bits of the positions before the requested one in this word.
+  for (auto skipped = _ranks[word_index]; skipped < index; ++skipped) {
+    word &= word - 1;
+  }
+  return RowID{_chunk_id, static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word))};
+}
+
+void BitmapPosList::copy_positions(const size_t begin, const size_t count, RowID* out) const {
+  if (count == 0) return;
+  auto word_index = _word_index(begin);
+  auto word = _words[word_index];
+  for (auto skipped = _ranks[word_index]; skipped < begin; ++skipped) {
+    word &= word - 1;
+  }
+  for (auto index = size_t{0}; index < count; ++index) {
+    while (word == 0) word = _words[++word_index];
+    out[index] = RowID{_chunk_id, static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word))};
+    word &= word - 1;
+  }
+}
+
+std::optional<ChunkID> BitmapPosList::ordered_chunk_id() const { return _chunk_id; }
+
+std::optional<RowID> BitmapPosList::contiguous_begin(const size_t begin, const size_t count) const {
+  if (count == 0) return std::nullopt;
+  const auto first = (*this)[begin];
+  if ((*this)[begin + count - 1].chunk_offset - first.chunk_offset != count - 1) return std::nullopt;
+  return first;
+}
+
+size_t BitmapPosList::estimate_memory_usage() const {
+  return sizeof(uint64_t) * _words.size() + sizeof(uint32_t) * _ranks.size();
+}
+
+size_t BitmapPosList::_word_index(const size_t index) const {
+  return static_cast<size_t>(std::upper_bound(_ranks.cbegin(), _ranks.cend(), index) - _ranks.cbegin()) - 1;
+}
+
+std::shared_ptr<const BasePosList> make_pos_list(const ChunkID chunk_id,
+                                                 const std::vector<ChunkOffset>& chunk_offsets) {
+  if (chunk_offsets.empty()) return std::make_shared<RowIDPosList>(PosList{});
+
+  auto runs = std::vector<RangePosList::Run>{};
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    if (index == 0 || chunk_offsets[index] != chunk_offsets[index - 1] + 1) {
+      runs.emplace_back(RangePosList::Run{chunk_offsets[index], static_cast<uint32_t>(index)});
+    }
+  }
+  if (runs.size() == 1 && chunk_offsets.front() == 0) {
+    return std::make_shared<EntireChunkPosList>(chunk_id, static_cast<ChunkOffset>(chunk_offsets.size()));
+  }
+
+  const auto word_count = size_t{chunk_offsets.back() / 64 + 1};
+  const auto bitmap_size = word_count * (sizeof(uint64_t) + sizeof(uint32_t));
+  const auto range_size = runs.size() * sizeof(RangePosList::Run);
+  const auto row_id_size = chunk_offsets.size() * sizeof(RowID);
+
+  if (bitmap_size < range_size && bitmap_size < row_id_size) {
+    return std::make_shared<BitmapPosList>(chunk_id, chunk_offsets);
+  }
+  // Runs of single rows save nothing, but are slower to access than RowIDs.
+  if (range_size < row_id_size) return std::make_shared<RangePosList>(chunk_id, std::move(runs), chunk_offsets.size());
+
+  auto positions = PosList{};
+  positions.reserve(chunk_offsets.size());
+  for (const auto chunk_offset : chunk_offsets) {
+    positions.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+  return std::make_shared<RowIDPosList>(std::move(positions));
+}
+
+std::shared_ptr<const BasePosList> make_pos_list(PosList positions) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(positions.size());
+  for (const auto& row_id : positions) {
+    if (row_id.chunk_id != positions.front().chunk_id ||
+        (!chunk_offsets.empty() && row_id.chunk_offset <= chunk_offsets.back())) {
+      return std::make_shared<RowIDPosList>(std::move(positions));
+    }
+    chunk_offsets.emplace_back(row_id.chunk_offset);
+  }
+  return make_pos_list(positions.empty() ? ChunkID{0} : positions.front().chunk_id, chunk_offsets);
+}
+
+}  // namespace opossum
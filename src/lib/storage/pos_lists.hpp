@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RowIDPosList stores each position as a RowID. It is the only representation for positions that span several
+// chunks or are not ordered, e.g., the result of a sort.
+class RowIDPosList : public BasePosList {
+ public:
+  explicit RowIDPosList(PosList positions);
+
+  size_t size() const final;
+  RowID operator[](const size_t index) const final;
+  void copy_positions(const size_t begin, const size_t count, RowID* out) const final;
+  std::optional<ChunkID> ordered_chunk_id() const final;
+  std::optional<RowID> contiguous_begin(const size_t begin, const size_t count) const final;
+  size_t estimate_memory_usage() const final;
+
+  const PosList& positions() const;
+
+ protected:
+  const PosList _positions;
+  std::optional<ChunkID> _ordered_chunk_id;
+};
+
+// EntireChunkPosList references the first size rows of a chunk without storing them, e.g., when a filter matches
+// all rows of a chunk.
+class EntireChunkPosList : public BasePosList {
+ public:
+  EntireChunkPosList(const ChunkID chunk_id, const ChunkOffset size);
+
+  size_t size() const final;
+  RowID operator[](const size_t index) const final;
+  void copy_positions(const size_t begin, const size_t count, RowID* out) const final;
+  std::optional<ChunkID> ordered_chunk_id() const final;
+  std::optional<RowID> contiguous_begin(const size_t begin, const size_t count) const final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ChunkID _chunk_id;
+  const ChunkOffset _size;
+};
+
+// RangePosList stores runs of consecutive rows of one chunk, e.g., for a filter on a sorted or clustered column.
+// Each run takes 8 bytes regardless of its length.
+class RangePosList : public BasePosList {
+ public:
+  // A run of consecutive rows that starts at chunk_offset. Its first row is the position at index of the list.
+  struct Run {
+    ChunkOffset chunk_offset;
+    uint32_t index;
+  };
+
+  // The runs have to be ascending and must not overlap.
+  RangePosList(const ChunkID chunk_id, std::vector<Run> runs, const size_t size);
+
+  size_t size() const final;
+  RowID operator[](const size_t index) const final;
+  void copy_positions(const size_t begin, const size_t count, RowID* out) const final;
+  std::optional<ChunkID> ordered_chunk_id() const final;
+  std::optional<RowID> contiguous_begin(const size_t begin, const size_t count) const final;
+  size_t estimate_memory_usage() const final;
+
+  const std::vector<Run>& runs() const;
+
+ protected:
+  // Returns the index of the run that contains the position at the given index
+  size_t _run_index(const size_t index) const;
+
+  const ChunkID _chunk_id;
+  const std::vector<Run> _runs;
+  const size_t _size;
+};
+
+// BitmapPosList stores one bit per row of a chunk, which is the densest representation for filters that match a
+// large, scattered fraction of the rows. For random access, it keeps the number of set bits before each word.
+class BitmapPosList : public BasePosList {
+ public:
+  // The offsets have to be ascending.
+  BitmapPosList(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets);
+
+  size_t size() const final;
+  RowID operator[](const size_t index) const final;
+  void copy_positions(const size_t begin, const size_t count, RowID* out) const final;
+  std::optional<ChunkID> ordered_chunk_id() const final;
+  std::optional<RowID> contiguous_begin(const size_t begin, const size_t count) const final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Returns the index of the word that contains the position at the given index
+  size_t _word_index(const size_t index) const;
+
+  const ChunkID _chunk_id;
+  std::vector<uint64_t> _words;
+  std::vector<uint32_t> _ranks;
+  size_t _size = 0;
+};
+
+// Returns the representation of the ascending offsets of a chunk that takes the least memory
+std::shared_ptr<const BasePosList> make_pos_list(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets);
+
+// Returns the representation of the positions that takes the least memory. Only positions that reference a single
+// chunk in ascending order are stored in another representation than RowIDPosList.
+std::shared_ptr<const BasePosList> make_pos_list(PosList positions);
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#include "reference_segment.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "pos_lists.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const BasePosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _pos_list->size(), "Offset " + std::to_string(chunk_offset) + " is out of range");
+  const auto row_id = (*_pos_list)[chunk_offset];
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+void ReferenceSegment::append(const AllTypeVariant&) { Fail("ReferenceSegment is immutable"); }
+
+ChunkOffset ReferenceSegment::size() const { return static_cast<ChunkOffset>(_pos_list->size()); }
+
+void ReferenceSegment::shrink_to_fit() {}
+
+size_t ReferenceSegment::estimate_memory_usage() const { return _pos_list->estimate_memory_usage(); }
+
+const std::shared_ptr<const BasePosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+Chunk create_reference_chunk(const std::shared_ptr<const Table>& table, const PosList& positions) {
+  auto chunk = Chunk{};
+  const auto& first_chunk = table->get_chunk(positions.empty() ? ChunkID{0} : positions.front().chunk_id);
+  const auto direct_pos_list = make_pos_list(positions);
+  auto resolved_pos_lists = std::map<std::shared_ptr<const BasePosList>, std::shared_ptr<const BasePosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto reference_segment =
+        first_chunk.column_count() == 0
+            ? nullptr
+            : std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk.get_segment(column_id));
+    if (!reference_segment) {
+      chunk.add_segment(std::make_shared<ReferenceSegment>(table, column_id, direct_pos_list));
+      continue;
+    }
+
+    // Consecutive positions usually lie in the same chunk, whose position list is only looked up once.
+    auto& resolved_pos_list = resolved_pos_lists[reference_segment->pos_list()];
+    if (!resolved_pos_list) {
+      auto resolved_positions = PosList{};
+      resolved_positions.reserve(positions.size());
+      auto input_chunk_id = ChunkID{0};
+      auto input_pos_list = std::shared_ptr<const BasePosList>{};
+      for (const auto& row_id : positions) {
+        if (!input_pos_list || row_id.chunk_id != input_chunk_id) {
+          input_chunk_id = row_id.chunk_id;
+          const auto segment = table->get_chunk(input_chunk_id).get_segment(column_id);
+          DebugAssert(std::dynamic_pointer_cast<const ReferenceSegment>(segment),
+                      "All chunks of a table must consist of the same kind of segments");
+          input_pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+        }
+        resolved_positions.emplace_back((*input_pos_list)[row_id.chunk_offset]);
+      }
+      resolved_pos_list = make_pos_list(std::move(resolved_positions));
+    }
+    chunk.add_segment(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                         reference_segment->referenced_column_id(), resolved_pos_list));
+  }
+  return chunk;
+}
+
+}  // namespace opossum
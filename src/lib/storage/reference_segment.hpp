@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_pos_list.hpp"
+#include "base_segment.hpp"
+#include "chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment.
+// The positions can be stored in any representation of BasePosList.
+class ReferenceSegment : public BaseSegment {
+ public:
+  // creates a reference segment
+  // the parameters specify the positions and the referenced segment
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const BasePosList> pos);
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  void append(const AllTypeVariant&) override;
+
+  ChunkOffset size() const override;
+
+  // reference segments never grow, so there is nothing to release
+  void shrink_to_fit() override;
+
+  // returns the memory used by the position list, which might be shared with other segments
+  size_t estimate_memory_usage() const override;
+
+  const std::shared_ptr<const BasePosList> pos_list() const;
+  const std::shared_ptr<const Table> referenced_table() const;
+  ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const BasePosList> _pos_list;
+};
+
+// Creates a chunk of ReferenceSegments that point to the given rows of the table, e.g., for the result of an
+// operator. If the table consists of ReferenceSegments itself, the chunk references the tables they reference, so
+// that references are never nested. Columns that share a position list in the table share one in the chunk, too.
+Chunk create_reference_chunk(const std::shared_ptr<const Table>& table, const PosList& positions);
+
+}  // namespace opossum
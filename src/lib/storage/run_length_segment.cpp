@@ -0,0 +1,79 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto segment_size = base_segment->size();
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    auto value = value_segment ? value_segment->values()[chunk_offset] : type_cast<T>((*base_segment)[chunk_offset]);
+    if (_values.empty() || !(value == _values.back())) {
+      _values.emplace_back(std::move(value));
+      _end_positions.emplace_back(chunk_offset);
+    } else {
+      _end_positions.back() = chunk_offset;
+    }
+  }
+
+  _values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  return get(chunk_offset);
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Offset " + std::to_string(chunk_offset) + " is out of range");
+  const auto run = std::lower_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offset);
+  return _values[std::distance(_end_positions.cbegin(), run)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  Fail("Run-length segments are immutable");
+}
+
+template <typename T>
+void RunLengthSegment<T>::shrink_to_fit() {}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  return _end_positions.empty() ? 0 : _end_positions.back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(ChunkOffset) * _end_positions.size();
+  for (const auto& value : _values) {
+    memory_usage += value_memory_usage(value);
+  }
+  return memory_usage;
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+
+namespace opossum {
+
+// RunLengthSegment stores each run of equal consecutive values only once, together with the offset of the last row
+// of the run. It pays off for columns that are sorted or clustered by their values, e.g., dates in a table that is
+// appended in chronological order. Like DictionarySegments, run-length segments are immutable and created from a
+// full segment.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // Creates a run-length segment from the values of the given segment.
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position. This searches the run containing the position.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // run-length segments are created with their final size
+  void shrink_to_fit() override;
+
+  // return the number of entries
+  ChunkOffset size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // Returns the value of each run
+  const std::vector<T>& values() const;
+
+  // Returns the offset of the last row of each run, in ascending order
+  const std::vector<ChunkOffset>& end_positions() const;
+
+ protected:
+  std::vector<T> _values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "logging/write_ahead_log.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -17,16 +18,27 @@ StorageManager& StorageManager::get() {
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   Assert(!has_table(name), "Table " + name + " exists already.");
+  if (WriteAheadLog::get().is_open()) WriteAheadLog::get().log_create_table(name, *table);
+  table->increase_version();
   _tables[name] = table;
 }
 
+void StorageManager::clone_table(const std::string& source_name, const std::string& target_name) {
+  Assert(has_table(source_name), "Cannot clone non-existing table " + source_name);
+  add_table(target_name, get_table(source_name)->snapshot());
+}
+
 void StorageManager::drop_table(const std::string& name) {
   Assert(has_table(name), "Cannot drop non-existing table " + name);
+  if (WriteAheadLog::get().is_open()) WriteAheadLog::get().log_drop_table(*_tables[name]);
+  _tables[name]->increase_version();
   _tables.erase(name);
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
 
+uint64_t StorageManager::table_version(const std::string& name) const { return get_table(name)->version(); }
+
 bool StorageManager::has_table(const std::string& name) const { return _tables.find(name) != _tables.end(); }
 
 std::vector<std::string> StorageManager::table_names() const {
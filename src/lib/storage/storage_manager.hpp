@@ -21,12 +21,20 @@ class StorageManager : private Noncopyable {
   // adds a table to the storage manager
   void add_table(const std::string& name, std::shared_ptr<Table> table);
 
+  // Adds a snapshot of the source table under the target name, which shares the finalized chunks of the source, see
+  // Table::snapshot. Both tables can be modified independently afterwards, e.g., for a what-if analysis.
+  void clone_table(const std::string& source_name, const std::string& target_name);
+
   // removes the table from the storage manger
   void drop_table(const std::string& name);
 
   // returns the table instance with the given name
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
+  // Returns the version of the table with the given name, which changes with every modification, see Table::version.
+  // Adding and dropping a table change its version, too.
+  uint64_t table_version(const std::string& name) const;
+
   // returns whether the storage manager holds a table with the given name
   bool has_table(const std::string& name) const;
 
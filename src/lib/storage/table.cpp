@@ -1,14 +1,27 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "binary_serialization.hpp"
+#include "bloom_filter.hpp"
+#include "buffer_manager.hpp"
+#include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "hyper_log_log.hpp"
+#include "lz4_segment.hpp"
+#include "mvcc_data.hpp"
+#include "partition_schema.hpp"
+#include "reference_segment.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
@@ -17,42 +30,590 @@
 
 namespace opossum {
 
-Table::Table(const ChunkOffset target_chunk_size) {
+namespace {
+
+std::atomic<uint64_t> next_table_version{1};
+
+// Calls function(index) for each index in [0, count) on up to one thread per core and rethrows the first exception.
+template <typename Function>
+void for_each_index_in_parallel(const size_t count, const Function& function) {
+  const auto worker_count = std::max(size_t{1}, std::min<size_t>(std::thread::hardware_concurrency(), count));
+  auto next_index = std::atomic<size_t>{0};
+  auto exceptions = std::vector<std::exception_ptr>(worker_count);
+  const auto work = [&](const size_t worker_id) {
+    try {
+      for (auto index = next_index++; index < count; index = next_index++) {
+        function(index);
+      }
+    } catch (...) {
+      exceptions[worker_id] = std::current_exception();
+    }
+  };
+
+  auto threads = std::vector<std::thread>{};
+  for (auto worker_id = size_t{1}; worker_id < worker_count; ++worker_id) {
+    threads.emplace_back(work, worker_id);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
+bool consists_of_value_segments(const Chunk& chunk, const std::vector<DataType>& column_types) {
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    auto is_value_segment = false;
+    resolve_data_type(column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      is_value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(chunk.get_segment(column_id).get());
+    });
+    if (!is_value_segment) return false;
+  }
+  return true;
+}
+
+// Rows may still be appended to open chunks, so they cannot be shared with a snapshot. Only ValueSegments grow, other
+// segments are immutable and shared.
+std::shared_ptr<Chunk> copy_open_chunk(const Chunk& chunk, const std::vector<DataType>& column_types) {
+  auto copy = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    resolve_data_type(column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        auto values = value_segment->values();
+        copy->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      } else {
+        copy->add_segment(segment);
+      }
+    });
+  }
+  if (chunk.partition_id()) copy->set_partition_id(*chunk.partition_id());
+  return copy;
+}
+
+}  // namespace
+
+Table::Table(const ChunkOffset target_chunk_size, const UseMvcc use_mvcc) {
+  Assert(use_mvcc == UseMvcc::No || target_chunk_size <= MAX_MVCC_CHUNK_SIZE,
+         "Target chunk size of MVCC tables must not exceed " + std::to_string(MAX_MVCC_CHUNK_SIZE));
   _target_chunk_size = target_chunk_size;
-  _chunks.push_back(std::make_shared<Chunk>());
+  _use_mvcc = use_mvcc;
+  increase_version();
+  _chunks.push_back(_create_chunk());
 }
 
-void Table::_add_segment_to_chunk(std::shared_ptr<Chunk>& chunk, const std::string& type) {
-  resolve_data_type(type, [&](const auto data_type_t) {
+void Table::_add_segment_to_chunk(std::shared_ptr<Chunk>& chunk, const DataType data_type) {
+  resolve_data_type(data_type, [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
-    const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>();
+    auto values = std::vector<ColumnDataType>{};
+    if (_use_mvcc == UseMvcc::Yes) values.reserve(_target_chunk_size);
+    const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
     chunk->add_segment(value_segment);
   });
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
+std::shared_ptr<Chunk> Table::_create_chunk() {
+  auto chunk = std::make_shared<Chunk>();
+  for (const auto data_type : _column_types) {
+    _add_segment_to_chunk(chunk, data_type);
+  }
+  if (_use_mvcc == UseMvcc::Yes) chunk->set_mvcc_data(std::make_shared<MvccData>(_target_chunk_size));
+  return chunk;
+}
+
+void Table::add_column(const std::string& name, const DataType data_type) {
   Assert(!row_count(), "add_column must be called before adding entries");
+  Assert(_log_name.empty(), "Columns cannot be added to tables that are logged");
+  _column_names.push_back(name);
+  _column_types.push_back(data_type);
+  _name_id_mapping[name] = static_cast<ColumnID>(_column_names.size() - 1);
+  _add_segment_to_chunk(_chunks.back(), data_type);
+  increase_version();
+}
+
+void Table::add_column(const std::string& name, const std::string& type) {
+  add_column(name, data_type_from_string(type));
+}
+
+void Table::add_column_definition(const std::string& name, const DataType data_type) {
+  Assert(!row_count(), "add_column_definition must be called before adding entries");
+  Assert(_log_name.empty(), "Columns cannot be added to tables that are logged");
   _column_names.push_back(name);
-  _column_types.push_back(type);
+  _column_types.push_back(data_type);
   _name_id_mapping[name] = static_cast<ColumnID>(_column_names.size() - 1);
-  _add_segment_to_chunk(_chunks.back(), type);
+  increase_version();
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
+  // Commit ID 0 precedes all snapshots, so the row is visible to every transaction.
+  _append(values, CommitID{0}, INVALID_TRANSACTION_ID);
+}
+
+RowID Table::append_uncommitted(const std::vector<AllTypeVariant>& values, const TransactionID transaction_id) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Uncommitted rows can only be appended to tables that use MVCC");
+  return _append(values, MAX_COMMIT_ID, transaction_id);
+}
+
+RowID Table::_append(const std::vector<AllTypeVariant>& values, const CommitID begin_commit_id,
+                     const TransactionID transaction_id) {
   DebugAssert(values.size() == column_count(), "Values have wrong size. Should be " + std::to_string(column_count()));
-  if (_chunks.back()->size() >= _target_chunk_size) {
+  auto row_id = RowID{};
+  auto log_sequence_number = LogSequenceNumber{0};
+  {
+    const auto append_lock = std::lock_guard{_append_mutex};
+
+    // Only writers modify the chunk list, so we can read it without holding _chunks_mutex. Partitioned tables have an
+    // open chunk for each partition, other tables append to their last chunk.
+    auto partition_id = std::optional<PartitionID>{};
+    auto open_chunk_id = std::optional<ChunkID>{static_cast<ChunkID>(_chunks.size() - 1)};
+    if (_partition_schema) {
+      partition_id = _partition_schema->partition_of(values[_partition_schema->column_id()]);
+      open_chunk_id = _open_chunk_ids[*partition_id];
+    }
+    if (!open_chunk_id || _chunks[*open_chunk_id]->is_finalized()) {
+      auto chunk = _create_chunk();
+      if (partition_id) chunk->set_partition_id(*partition_id);
+      const auto chunks_lock = std::unique_lock{_chunks_mutex};
+      _chunks.push_back(chunk);
+      open_chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+      if (partition_id) _open_chunk_ids[*partition_id] = open_chunk_id;
+    }
+
+    const auto chunk_id = *open_chunk_id;
+    auto& chunk = *_chunks[chunk_id];
+    const auto chunk_offset = chunk.size();
+    chunk.append(values);
+    if (_use_mvcc == UseMvcc::Yes) chunk.mvcc_data()->append_row(begin_commit_id, transaction_id);
+    row_id = RowID{chunk_id, chunk_offset};
+    increase_version();
+
+    // Rows of transactions are not logged, see WriteAheadLog.
+    if (!_log_name.empty() && transaction_id == INVALID_TRANSACTION_ID) {
+      log_sequence_number = WriteAheadLog::get().log_row(*this, values);
+    }
+
+    // As the segments of MVCC tables reserved exactly the target chunk size, finalizing does not reallocate them.
+    if (chunk.size() >= _target_chunk_size) {
+      chunk.finalize();
+      _on_chunk_finalized(chunk_id);
+    }
+  }
+
+  // Waiting for the log outside of the lock lets concurrent writers share a flush.
+  if (log_sequence_number) WriteAheadLog::get().wait_until_durable(log_sequence_number);
+  return row_id;
+}
+
+void Table::remove_chunk(const ChunkID chunk_id) {
+  const auto append_lock = std::lock_guard{_append_mutex};
+  // Only writers modify the chunk list, so we can read it without holding _chunks_mutex.
+  const auto chunk = _chunks.at(chunk_id);
+  Assert(chunk->is_finalized(), "Only finalized chunks can be removed");
+  Assert(chunk->invalid_row_count() == chunk->size(), "Only chunks without valid rows can be removed");
+
+  const auto empty_chunk = std::make_shared<Chunk>();
+  for (const auto data_type : _column_types) {
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      empty_chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>());
+    });
+  }
+  if (chunk->has_mvcc_data()) empty_chunk->set_mvcc_data(std::make_shared<MvccData>(0));
+  empty_chunk->set_cleanup_commit_id(chunk->cleanup_commit_id());
+  if (chunk->partition_id()) empty_chunk->set_partition_id(*chunk->partition_id());
+  empty_chunk->finalize();
+
+  // Readers that still hold the previous chunk, e.g., to check its cleanup commit ID, keep it alive. Its data is
+  // released once the last of them is done. Only then is it unregistered from the BufferManager, which it might need
+  // to reload its segments until that point.
+  {
+    const auto chunks_lock = std::unique_lock{_chunks_mutex};
+    _chunks[chunk_id] = empty_chunk;
+  }
+  increase_version();
+}
+
+void Table::compress_chunk(const ChunkID chunk_id) {
+  auto& chunk = get_chunk(chunk_id);
+  Assert(chunk.is_finalized(), "Only finalized chunks can be compressed");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = chunk.get_segment(column_id);
+      if (std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) return;
+      chunk.replace_segment(column_id, std::make_shared<DictionarySegment<ColumnDataType>>(segment));
+    });
+  }
+}
+
+void Table::compress_cold_chunk(const ChunkID chunk_id) {
+  auto& chunk = get_chunk(chunk_id);
+  Assert(chunk.is_finalized(), "Only finalized chunks can be compressed");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = chunk.get_segment(column_id);
+      if (std::dynamic_pointer_cast<LZ4Segment<ColumnDataType>>(segment)) return;
+      chunk.replace_segment(column_id, std::make_shared<LZ4Segment<ColumnDataType>>(segment));
+    });
+  }
+}
+
+void Table::emplace_chunk(Chunk chunk) {
+  Assert(chunk.column_count() == column_count(),
+         "Chunk has wrong column count. Should be " + std::to_string(column_count()));
+  Assert(!_partition_schema, "Chunks cannot be emplaced into partitioned tables, as they may hold several partitions");
+  auto append_lock = std::unique_lock{_append_mutex};
+
+  // Bulk-loaded chunks of MVCC tables are visible to all transactions. As their MvccData cannot grow, they are
+  // finalized right away.
+  if (_use_mvcc == UseMvcc::Yes && !chunk.has_mvcc_data()) {
+    const auto mvcc_data = std::make_shared<MvccData>(chunk.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      mvcc_data->append_row(CommitID{0}, INVALID_TRANSACTION_ID);
+    }
+    chunk.set_mvcc_data(mvcc_data);
+    if (!chunk.is_finalized()) chunk.finalize();
+  }
+
+  // Chunks finalized here are processed once readers can access the chunk list again.
+  auto finalized_chunk_ids = std::vector<ChunkID>{};
+  auto chunk_was_merged = false;
+  {
+    const auto chunks_lock = std::unique_lock{_chunks_mutex};
+    if (_chunks.size() == 1 && _chunks.back()->size() == 0) {
+      // Readers that hold the chunk via get_chunk_ptr can be detected, those that hold a reference cannot.
+      Assert(_chunks.back().use_count() == 1, "The empty first chunk cannot be replaced while it is being read");
+      _chunks.back() = std::make_shared<Chunk>(std::move(chunk));
+    } else if (_can_merge_into_last_chunk(chunk)) {
+      const auto filled_chunk_id = _merge_into_last_chunk(chunk);
+      if (filled_chunk_id) finalized_chunk_ids.emplace_back(*filled_chunk_id);
+      chunk_was_merged = true;
+    } else {
+      // No more rows will be appended to the previous chunk.
+      if (!_chunks.back()->is_finalized()) {
+        _chunks.back()->finalize();
+        finalized_chunk_ids.emplace_back(_chunks.size() - 1);
+      }
+      _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+    }
+
+    auto& emplaced_chunk = *_chunks.back();
+    if (emplaced_chunk.size() >= _target_chunk_size && !emplaced_chunk.is_finalized()) emplaced_chunk.finalize();
+    if (emplaced_chunk.is_finalized()) finalized_chunk_ids.emplace_back(_chunks.size() - 1);
+  }
+
+  // Merged rows are logged as the chunk they arrived in, which recovery emplaces again.
+  increase_version();
+  auto log_sequence_number = LogSequenceNumber{0};
+  if (!_log_name.empty()) {
+    log_sequence_number = WriteAheadLog::get().log_chunk(*this, chunk_was_merged ? chunk : *_chunks.back());
+  }
+
+  for (const auto chunk_id : finalized_chunk_ids) {
+    _on_chunk_finalized(chunk_id);
+  }
+
+  append_lock.unlock();
+  if (log_sequence_number) WriteAheadLog::get().wait_until_durable(log_sequence_number);
+}
+
+bool Table::_can_merge_into_last_chunk(const Chunk& chunk) const {
+  if (!_chunk_merging_enabled || chunk.is_finalized() || chunk.size() >= _target_chunk_size) return false;
+  const auto& last_chunk = *_chunks.back();
+  return !last_chunk.is_finalized() && chunk.column_count() > 0 && consists_of_value_segments(chunk, _column_types) &&
+         consists_of_value_segments(last_chunk, _column_types);
+}
+
+std::optional<ChunkID> Table::_merge_into_last_chunk(const Chunk& chunk) {
+  auto& last_chunk = *_chunks.back();
+  const auto fitting_row_count = std::min(chunk.size(), _target_chunk_size - last_chunk.size());
+  auto remaining_chunk = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto& values = static_cast<const ValueSegment<ColumnDataType>&>(*chunk.get_segment(column_id)).values();
+      const auto split = values.begin() + fitting_row_count;
+      auto& last_segment = static_cast<ValueSegment<ColumnDataType>&>(*last_chunk.get_segment(column_id));
+      last_segment.append_values(values.begin(), split);
+      remaining_chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::vector(split, values.end())));
+    });
+  }
+  if (fitting_row_count == chunk.size()) return std::nullopt;
+
+  last_chunk.finalize();
+  _chunks.push_back(remaining_chunk);
+  return static_cast<ChunkID>(_chunks.size() - 2);
+}
+
+void Table::repartition(const ChunkOffset target_chunk_size) {
+  Assert(target_chunk_size > 0, "Target chunk size must be positive");
+  Assert(_use_mvcc == UseMvcc::No, "Tables that use MVCC cannot be repartitioned, as transactions refer to rows by ID");
+  const auto append_lock = std::lock_guard{_append_mutex};
+  Assert(_log_name.empty(), "Logged tables cannot be repartitioned, as recovery would restore the previous chunks");
+  Assert(!_partition_schema, "Partitioned tables cannot be repartitioned, as their chunks follow the partitions");
+
+  // chunk_begins[chunk_id] is the position of the first row of a chunk within the table, the last entry is the
+  // row count.
+  const auto old_chunk_count = _chunks.size();
+  auto chunk_begins = std::vector<uint64_t>{0};
+  for (const auto& chunk : _chunks) {
+    chunk_begins.emplace_back(chunk_begins.back() + chunk->size());
+  }
+  const auto row_count = chunk_begins.back();
+  if (row_count == 0 || column_count() == 0) {
+    _target_chunk_size = target_chunk_size;
+    return;
+  }
+
+  // An old chunk is kept if it covers exactly the rows of a new chunk. All other old chunks are read as ValueSegments,
+  // decoding them once instead of once per new chunk they overlap.
+  const auto new_chunk_count = static_cast<size_t>((row_count + target_chunk_size - 1) / target_chunk_size);
+  auto kept_chunks = std::vector<std::shared_ptr<Chunk>>(new_chunk_count);
+  auto is_kept = std::vector<bool>(old_chunk_count);
+  for (auto old_chunk_id = size_t{0}; old_chunk_id < old_chunk_count; ++old_chunk_id) {
+    const auto begin = chunk_begins[old_chunk_id];
+    const auto end = chunk_begins[old_chunk_id + 1];
+    // Empty chunks do not cover any new chunk. At the end of the table, they would not even start one.
+    if (begin == end) continue;
+    const auto new_chunk_id = begin / target_chunk_size;
+    if (begin % target_chunk_size == 0 && end == std::min(row_count, (new_chunk_id + 1) * target_chunk_size)) {
+      kept_chunks[new_chunk_id] = _chunks[old_chunk_id];
+      is_kept[old_chunk_id] = true;
+    }
+  }
+
+  auto value_segments = std::vector<std::vector<std::shared_ptr<const BaseSegment>>>(old_chunk_count);
+  for_each_index_in_parallel(old_chunk_count, [&](const size_t old_chunk_id) {
+    const auto& chunk = *_chunks[old_chunk_id];
+    if (is_kept[old_chunk_id] || chunk.size() == 0) return;
+    for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      Assert(!std::dynamic_pointer_cast<const ReferenceSegment>(segment),
+             "Tables of operator results cannot be repartitioned");
+      resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if (std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+          value_segments[old_chunk_id].emplace_back(segment);
+        } else {
+          value_segments[old_chunk_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(materialize_values<ColumnDataType>(*segment)));
+        }
+      });
+    }
+  });
+
+  auto new_chunks = std::vector<std::shared_ptr<Chunk>>(new_chunk_count);
+  for_each_index_in_parallel(new_chunk_count, [&](const size_t new_chunk_id) {
+    if (kept_chunks[new_chunk_id]) {
+      new_chunks[new_chunk_id] = kept_chunks[new_chunk_id];
+      return;
+    }
+
+    const auto begin = new_chunk_id * target_chunk_size;
+    const auto end = std::min(row_count, begin + target_chunk_size);
+    const auto first_old_chunk_id = static_cast<size_t>(
+        std::upper_bound(chunk_begins.begin(), chunk_begins.end(), begin) - chunk_begins.begin() - 1);
     auto chunk = std::make_shared<Chunk>();
-    for (const std::string& type : _column_types) {
-      _add_segment_to_chunk(chunk, type);
+    for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+      resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        auto values = std::vector<ColumnDataType>{};
+        values.reserve(end - begin);
+        for (auto old_chunk_id = first_old_chunk_id; chunk_begins[old_chunk_id] < end; ++old_chunk_id) {
+          if (value_segments[old_chunk_id].empty()) continue;
+          const auto& old_values =
+              static_cast<const ValueSegment<ColumnDataType>&>(*value_segments[old_chunk_id][column_id]).values();
+          const auto old_begin = chunk_begins[old_chunk_id];
+          values.insert(values.end(), old_values.begin() + (std::max(begin, old_begin) - old_begin),
+                        old_values.begin() + (std::min(end, chunk_begins[old_chunk_id + 1]) - old_begin));
+        }
+        chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      });
     }
-    _chunks.push_back(chunk);
+    new_chunks[new_chunk_id] = chunk;
+  });
+
+  // Full chunks are finalized, the last one stays open for appends unless it was kept finalized.
+  auto finalized_chunk_ids = std::vector<ChunkID>{};
+  for (auto new_chunk_id = ChunkID{0}; new_chunk_id < new_chunk_count; ++new_chunk_id) {
+    auto& chunk = *new_chunks[new_chunk_id];
+    if (chunk.is_finalized() || chunk.size() < target_chunk_size) continue;
+    chunk.finalize();
+    finalized_chunk_ids.emplace_back(new_chunk_id);
+  }
+
+  {
+    const auto chunks_lock = std::unique_lock{_chunks_mutex};
+    std::swap(_chunks, new_chunks);
+    _target_chunk_size = target_chunk_size;
+  }
+  increase_version();
+
+  for (const auto chunk_id : finalized_chunk_ids) {
+    _on_chunk_finalized(chunk_id);
+  }
+}
+
+std::shared_ptr<Table> Table::snapshot() const {
+  Assert(_use_mvcc == UseMvcc::No, "Tables that use MVCC cannot be snapshotted, as deletes modify finalized chunks");
+  auto snapshot = std::make_shared<Table>(_target_chunk_size, _use_mvcc);
+
+  // Holding the append lock keeps writers from appending to the open chunks or adding chunks while they are copied.
+  const auto append_lock = std::lock_guard{_append_mutex};
+  snapshot->_column_names = _column_names;
+  snapshot->_column_types = _column_types;
+  snapshot->_name_id_mapping = _name_id_mapping;
+  snapshot->_encoding_advisor = _encoding_advisor;
+  snapshot->_bloom_filter_false_positive_rate = _bloom_filter_false_positive_rate;
+  snapshot->_hyper_log_log_enabled = _hyper_log_log_enabled;
+  snapshot->_chunk_merging_enabled = _chunk_merging_enabled;
+  snapshot->_partition_schema = _partition_schema;
+  snapshot->_open_chunk_ids = _open_chunk_ids;
+
+  snapshot->_chunks.clear();
+  snapshot->_chunks.reserve(_chunks.size());
+  for (const auto& chunk : _chunks) {
+    snapshot->_chunks.emplace_back(chunk->is_finalized() ? chunk : copy_open_chunk(*chunk, _column_types));
   }
-  _chunks.back()->append(values);
+  return snapshot;
 }
 
+void Table::create_hash_partitioning(const ColumnID column_id, const PartitionID partition_count) {
+  Assert(column_id < column_count(), "Partition key references non-existing column " + std::to_string(column_id));
+  _set_partition_schema(std::make_shared<HashPartitionSchema>(column_id, _column_types[column_id], partition_count));
+}
+
+void Table::create_range_partitioning(const ColumnID column_id, const std::vector<AllTypeVariant>& boundaries) {
+  Assert(column_id < column_count(), "Partition key references non-existing column " + std::to_string(column_id));
+  _set_partition_schema(std::make_shared<RangePartitionSchema>(column_id, _column_types[column_id], boundaries));
+}
+
+void Table::_set_partition_schema(const std::shared_ptr<const AbstractPartitionSchema>& partition_schema) {
+  const auto append_lock = std::lock_guard{_append_mutex};
+  Assert(row_count() == 0 && _chunks.size() == 1, "Tables must be partitioned before rows are added");
+  Assert(!_partition_schema, "Table is partitioned already");
+  Assert(_log_name.empty(), "Logged tables cannot be partitioned");
+
+  // The empty first chunk becomes the open chunk of the first partition.
+  _partition_schema = partition_schema;
+  _open_chunk_ids.assign(partition_schema->partition_count(), std::nullopt);
+  _chunks.front()->set_partition_id(PartitionID{0});
+  _open_chunk_ids.front() = ChunkID{0};
+}
+
+std::shared_ptr<const AbstractPartitionSchema> Table::partition_schema() const { return _partition_schema; }
+
+std::vector<ChunkID> Table::chunk_ids_of_partition(const PartitionID partition_id) const {
+  Assert(_partition_schema && partition_id < _partition_schema->partition_count(),
+         "Partition " + std::to_string(partition_id) + " does not exist");
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    if (_chunks[chunk_id]->partition_id() == partition_id) chunk_ids.emplace_back(chunk_id);
+  }
+  return chunk_ids;
+}
+
+void Table::set_chunk_merging_enabled(const bool enabled) {
+  const auto append_lock = std::lock_guard{_append_mutex};
+  _chunk_merging_enabled = enabled;
+}
+
+bool Table::chunk_merging_enabled() const { return _chunk_merging_enabled; }
+
+void Table::_on_chunk_finalized(const ChunkID chunk_id) {
+  const auto& chunk = _chunks[chunk_id];
+  // The sketches are built before encoding, as reading the values is cheapest from the unencoded segments.
+  if (_bloom_filter_false_positive_rate || _hyper_log_log_enabled) _build_segment_sketches(*chunk);
+  if (_encoding_advisor) _encoding_advisor->encode_chunk(*chunk, chunk_id, _column_types);
+
+  // Chunks of operator results only hold references, which are cheap and must stay valid as long as the result.
+  if (!BufferManager::get().is_enabled() || chunk->column_count() == 0) return;
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    if (std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) return;
+  }
+  BufferManager::get().register_chunk(chunk, _column_types);
+}
+
+void Table::set_encoding_advisor(const std::shared_ptr<EncodingAdvisor>& encoding_advisor) {
+  const auto append_lock = std::lock_guard{_append_mutex};
+  _encoding_advisor = encoding_advisor;
+}
+
+std::shared_ptr<EncodingAdvisor> Table::encoding_advisor() const { return _encoding_advisor; }
+
+void Table::_build_segment_sketches(Chunk& chunk) const {
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    // Result tables only reference the values of other tables, which have filters of their own.
+    if (std::dynamic_pointer_cast<const ReferenceSegment>(segment)) return;
+
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto values = materialize_values<ColumnDataType>(*segment);
+      auto hashes = std::vector<uint64_t>(values.size());
+      std::transform(values.begin(), values.end(), hashes.begin(), value_hash<ColumnDataType>);
+
+      if (_bloom_filter_false_positive_rate) {
+        // The number of rows bounds the number of distinct values. For keys, which profit most, both are equal.
+        auto bloom_filter = std::make_shared<BlockedBloomFilter>(hashes.size(), *_bloom_filter_false_positive_rate);
+        for (const auto hash : hashes) {
+          bloom_filter->insert(hash);
+        }
+        chunk.set_bloom_filter(column_id, bloom_filter);
+      }
+
+      if (_hyper_log_log_enabled) {
+        auto hyper_log_log = std::make_shared<HyperLogLog>();
+        for (const auto hash : hashes) {
+          hyper_log_log->insert(hash);
+        }
+        chunk.set_hyper_log_log(column_id, hyper_log_log);
+      }
+    });
+  }
+}
+
+void Table::set_bloom_filter_false_positive_rate(const std::optional<double> false_positive_rate) {
+  Assert(!false_positive_rate || (*false_positive_rate > 0.0 && *false_positive_rate < 1.0),
+         "False positive rate must be between 0 and 1");
+  const auto append_lock = std::lock_guard{_append_mutex};
+  _bloom_filter_false_positive_rate = false_positive_rate;
+}
+
+uint64_t Table::version() const { return _version; }
+
+void Table::increase_version() { _version = next_table_version++; }
+
+std::optional<double> Table::bloom_filter_false_positive_rate() const { return _bloom_filter_false_positive_rate; }
+
+void Table::set_hyper_log_log_enabled(const bool enabled) {
+  const auto append_lock = std::lock_guard{_append_mutex};
+  _hyper_log_log_enabled = enabled;
+}
+
+bool Table::hyper_log_log_enabled() const { return _hyper_log_log_enabled; }
+
 ColumnCount Table::column_count() const { return static_cast<ColumnCount>(_column_names.size()); }
 
+uint64_t Table::approx_valid_row_count() const {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  uint64_t row_count = 0L;
+  for (const auto& chunk : _chunks) {
+    row_count += chunk->size() - chunk->invalid_row_count();
+  }
+  return row_count;
+}
+
 uint64_t Table::row_count() const {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
   uint64_t row_count = 0L;
   for (const auto& chunk : _chunks) {
     row_count += chunk->size();
@@ -60,20 +621,44 @@ uint64_t Table::row_count() const {
   return row_count;
 }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  return static_cast<ChunkID>(_chunks.size());
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const { return _name_id_mapping.at(column_name); }
 
 ChunkOffset Table::target_chunk_size() const { return _target_chunk_size; }
 
+UseMvcc Table::uses_mvcc() const { return _use_mvcc; }
+
 const std::vector<std::string>& Table::column_names() const { return _column_names; }
 
 const std::string& Table::column_name(const ColumnID column_id) const { return _column_names.at(column_id); }
 
-const std::string& Table::column_type(const ColumnID column_id) const { return _column_types.at(column_id); }
+DataType Table::column_type(const ColumnID column_id) const { return _column_types.at(column_id); }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunks.at(chunk_id); }
+Chunk& Table::get_chunk(ChunkID chunk_id) {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  return *_chunks.at(chunk_id);
+}
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks.at(chunk_id); }
+const Chunk& Table::get_chunk(ChunkID chunk_id) const {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  return *_chunks.at(chunk_id);
+}
+
+std::shared_ptr<Chunk> Table::get_chunk_ptr(ChunkID chunk_id) const {
+  const auto chunks_lock = std::shared_lock{_chunks_mutex};
+  return _chunks.at(chunk_id);
+}
+
+std::shared_ptr<const Chunk> Table::get_chunk_snapshot(ChunkID chunk_id) const {
+  // Writers finalize chunks while holding the append lock as well.
+  const auto append_lock = std::lock_guard{_append_mutex};
+  const auto chunk = get_chunk_ptr(chunk_id);
+  if (chunk->is_finalized()) return chunk;
+  return copy_open_chunk(*chunk, _column_types);
+}
 
 }  // namespace opossum
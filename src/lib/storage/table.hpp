@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -12,21 +15,31 @@
 #include "base_segment.hpp"
 #include "chunk.hpp"
 
+#include "logging/write_ahead_log.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class AbstractPartitionSchema;
+class EncodingAdvisor;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
+//
+// Tables that use MVCC can be read and written concurrently: Writers are serialized by the table, readers only look
+// at rows published in the chunks' MvccData and do not take any lock while they process a chunk (see Validate). To
+// make this safe, the segments of MVCC tables reserve memory for the full target chunk size when a chunk is created
+// so that appends never reallocate values that readers might be accessing.
 class Table : private Noncopyable {
  public:
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
-  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  // MVCC tables allocate their chunks for the full target chunk size, which must not exceed MAX_MVCC_CHUNK_SIZE
+  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 const UseMvcc use_mvcc = UseMvcc::No);
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   ColumnCount column_count() const;
@@ -36,16 +49,73 @@ class Table : private Noncopyable {
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
   uint64_t row_count() const;
 
+  // Returns the number of rows minus those that were invalidated, i.e., deleted or rolled back. It is approximate, as
+  // it neither knows about uncommitted deletes nor about the snapshot of the caller.
+  uint64_t approx_valid_row_count() const;
+
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
+  // returns the chunk with the given id. The reference becomes invalid when the chunk is removed, see remove_chunk.
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Returns the chunk with the given id, which stays valid while it is held even if the chunk is removed. Used by
+  // readers that can run concurrently with the ChunkCompactor.
+  std::shared_ptr<Chunk> get_chunk_ptr(ChunkID chunk_id) const;
+
+  // Returns the chunk with the given id like get_chunk_ptr if it is finalized. Open chunks are copied while appends
+  // are blocked, as appending may reallocate their values, so the copy holds the rows of the chunk at that point. The
+  // copy does not have MvccData, i.e., it contains deleted and uncommitted rows as well.
+  std::shared_ptr<const Chunk> get_chunk_snapshot(ChunkID chunk_id) const;
+
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. As this invalidates references to it, the
+  // caller has to make sure that nobody reads the table while it adds its first chunk, e.g., by filling the table
+  // before it is handed out or added to the StorageManager.
+  // The previous last chunk is finalized, as are emplaced chunks that reach the target chunk size.
+  // If chunk merging is enabled, the rows of undersized chunks are appended to the last chunk instead.
   void emplace_chunk(Chunk chunk);
 
+  // Redistributes the rows into chunks of the new target chunk size, e.g., to split a table that was loaded into a
+  // single chunk so that operators can process it in parallel, or to merge thousands of tiny chunks. The new chunks are
+  // built in parallel from the typed values of the old ones. Old chunks that already cover the rows of a new chunk are
+  // kept as they are, including their encoding and sketches. The other new chunks are finalized (and encoded, if an
+  // advisor is set) once they are full; only the last one may stay open for appends.
+  // RowIDs change, so the caller has to make sure that nobody reads the table or references it from operator results.
+  // Tables that use MVCC or are logged cannot be repartitioned.
+  void repartition(ChunkOffset target_chunk_size);
+
+  // Returns a point-in-time copy of the table that is independent of later appends to either table. Finalized chunks
+  // never change their rows, so they are shared by pointer, including their encoding, sketches, and BufferManager
+  // frame. Only the chunks that are still open for appends, i.e., the last one or one per partition, are copied, so a
+  // snapshot costs time and memory proportional to the open chunks, not to the table. The copy takes over the schema,
+  // the partitioning, and the settings of the table, but is not logged.
+  // Tables that use MVCC cannot be snapshotted, as deletes modify the MvccData of finalized chunks. Transactions
+  // already read them at a consistent point in time.
+  std::shared_ptr<Table> snapshot() const;
+
+  // Enables merging undersized chunks passed to emplace_chunk into the last chunk, as long as the last chunk is open,
+  // i.e., not finalized, and both only consist of ValueSegments. Once the last chunk reaches the target chunk size, it
+  // is finalized and the remaining rows start a new chunk. Finalized and encoded chunks are never merged. This keeps
+  // tables that are loaded in small batches from ending up with thousands of tiny chunks. Disabled by default.
+  void set_chunk_merging_enabled(bool enabled);
+  bool chunk_merging_enabled() const;
+
+  // Releases the segments and MVCC data of a chunk whose rows were all invalidated, leaving an empty chunk in its
+  // place so that ChunkIDs stay stable. The caller has to make sure that no transaction can still see any of its rows
+  // and that all readers skip the chunk based on its cleanup commit ID, see ChunkCompactor. The empty chunk replaces
+  // the previous one in the chunk list, so readers that obtained the previous one via get_chunk_ptr keep it alive
+  // until they are done with it.
+  void remove_chunk(ChunkID chunk_id);
+
+  // Replaces the segments of a finalized chunk with DictionarySegments. Readers that are scanning the chunk keep
+  // working on the previous segments, so this can run while the table is in use.
+  void compress_chunk(ChunkID chunk_id);
+
+  // Replaces the segments of a finalized chunk that is rarely accessed with LZ4Segments. They take a fraction of the
+  // memory and are decompressed on access into the DecompressionCache.
+  void compress_cold_chunk(ChunkID chunk_id);
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
@@ -53,7 +123,7 @@ class Table : private Noncopyable {
   const std::string& column_name(const ColumnID column_id) const;
 
   // returns the column type of the nth column
-  const std::string& column_type(const ColumnID column_id) const;
+  DataType column_type(const ColumnID column_id) const;
 
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
@@ -63,23 +133,116 @@ class Table : private Noncopyable {
   // return the target chunk size (cannot exceed ChunkOffset (uint32_t))
   ChunkOffset target_chunk_size() const;
 
+  // returns whether the chunks of the table carry MvccData
+  UseMvcc uses_mvcc() const;
+
+  // Sets the advisor that encodes each chunk once it is finalized. The writer that fills a chunk pays for encoding
+  // it, readers keep working on the unencoded segments until they are replaced. Chunks finalized before the advisor
+  // was set are not encoded. nullptr (the default) disables encoding.
+  void set_encoding_advisor(const std::shared_ptr<EncodingAdvisor>& encoding_advisor);
+  std::shared_ptr<EncodingAdvisor> encoding_advisor() const;
+
+  // Enables building a BlockedBloomFilter for each segment once its chunk is finalized, sized for the given false
+  // positive rate. Equality scans use the filters to skip chunks that do not contain the value they look for, which
+  // helps where the values of a column are spread over all chunks, e.g., for keys. Chunks finalized before the rate
+  // was set get no filters. std::nullopt (the default) disables the filters.
+  void set_bloom_filter_false_positive_rate(std::optional<double> false_positive_rate);
+  std::optional<double> bloom_filter_false_positive_rate() const;
+
+  // Enables building a HyperLogLog sketch for each segment once its chunk is finalized, from which distinct counts are
+  // estimated without reading the values, see ApproximateAggregate. Disabled by default.
+  void set_hyper_log_log_enabled(bool enabled);
+  bool hyper_log_log_enabled() const;
+
   // adds a column to the end, i.e., right, of the table
   // this can only be done if the table does not yet have any entries, because we would otherwise have to deal
   // with default values
+  void add_column(const std::string& name, DataType data_type);
+
+  // same as above, but parses the type name, e.g., "int"
   void add_column(const std::string& name, const std::string& type);
 
-  // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // adds a column to the schema without creating segments for it, e.g., for operator results whose chunks are added
+  // via emplace_chunk
+  void add_column_definition(const std::string& name, DataType data_type);
+
+  // Partitions the table by the values of a key column, either into partition_count partitions by the hash of the key
+  // or into the ranges delimited by the ascending boundaries (see RangePartitionSchema). Each chunk holds the rows of
+  // exactly one partition, which it records as its partition ID, and rows are appended to an open chunk of their
+  // partition. Scans with predicates on the key skip the chunks of partitions that cannot contain matches, and
+  // operators can process the table partition by partition via chunk_ids_of_partition.
+  // Tables must be partitioned before rows are added. Chunks cannot be emplaced into partitioned tables, and
+  // partitioned tables cannot be logged, as the WriteAheadLog does not record the partitioning.
+  void create_hash_partitioning(ColumnID column_id, PartitionID partition_count);
+  void create_range_partitioning(ColumnID column_id, const std::vector<AllTypeVariant>& boundaries);
+
+  // Returns the partitioning of the table, or nullptr if it is not partitioned.
+  std::shared_ptr<const AbstractPartitionSchema> partition_schema() const;
+
+  // Returns the chunks that hold the rows of the partition in ascending order.
+  std::vector<ChunkID> chunk_ids_of_partition(PartitionID partition_id) const;
+
+  // inserts a row at the end of the table, finalizing the last chunk once it reaches the target chunk size
+  // in MVCC tables, the row is immediately visible to all transactions, as if it had been part of the initial load
+  // note this is slow and should be used for testing and loading purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // inserts a row that is locked by the given transaction and invisible to all other transactions until its begin
+  // commit ID is set, see Insert. Returns the position of the new row. Requires MVCC.
+  RowID append_uncommitted(const std::vector<AllTypeVariant>& values, const TransactionID transaction_id);
+
+  // Returns a number that changes whenever rows are added to or removed from the table, and when the table is added
+  // to or dropped from the StorageManager, which calls increase_version. Versions are unique across all tables, so a
+  // table that replaced another one under the same name never has the version of its predecessor. The ResultCache
+  // uses them to detect stale results.
+  uint64_t version() const;
+  void increase_version();
+
+  static constexpr auto MAX_MVCC_CHUNK_SIZE = ChunkOffset{1 << 20};
+
  protected:
+  friend class WriteAheadLog;
+
   ChunkOffset _target_chunk_size;
+  UseMvcc _use_mvcc;
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
-  std::vector<std::string> _column_types;
+  std::vector<DataType> _column_types;
   std::unordered_map<std::string, ColumnID> _name_id_mapping;
+  std::shared_ptr<EncodingAdvisor> _encoding_advisor;
+  std::optional<double> _bloom_filter_false_positive_rate;
+  bool _hyper_log_log_enabled = false;
+  bool _chunk_merging_enabled = false;
+
+  // The partitioning and, for each partition, the chunk that rows are appended to, if the table is partitioned
+  std::shared_ptr<const AbstractPartitionSchema> _partition_schema;
+  std::vector<std::optional<ChunkID>> _open_chunk_ids;
+  std::atomic<uint64_t> _version;
+
+  // Guards the chunk list, which readers only access briefly to look up a chunk.
+  mutable std::shared_mutex _chunks_mutex;
+
+  // Serializes writers and snapshots.
+  mutable std::mutex _append_mutex;
+
+  // The name under which appends are written to the WriteAheadLog, empty if the table is not logged, and the
+  // sequence number of the last record logged for the table. Both are guarded by _append_mutex.
+  std::string _log_name;
+  LogSequenceNumber _last_log_sequence_number = 0;
 
  private:
-  void _add_segment_to_chunk(std::shared_ptr<Chunk>& chunk, const std::string& type);
+  void _add_segment_to_chunk(std::shared_ptr<Chunk>& chunk, DataType data_type);
+  std::shared_ptr<Chunk> _create_chunk();
+  // Builds the Bloom filters and sketches of the chunk, encodes it, and hands it to the BufferManager, if these are
+  // enabled
+  void _on_chunk_finalized(ChunkID chunk_id);
+  void _build_segment_sketches(Chunk& chunk) const;
+  void _set_partition_schema(const std::shared_ptr<const AbstractPartitionSchema>& partition_schema);
+  // Used by emplace_chunk, both must be called with _append_mutex and _chunks_mutex held. Merging returns the ID of
+  // the previous last chunk if it was filled up and finalized, with the remaining rows starting a new chunk.
+  bool _can_merge_into_last_chunk(const Chunk& chunk) const;
+  std::optional<ChunkID> _merge_into_last_chunk(const Chunk& chunk);
+  RowID _append(const std::vector<AllTypeVariant>& values, const CommitID begin_commit_id,
+                const TransactionID transaction_id);
 };
 }  // namespace opossum
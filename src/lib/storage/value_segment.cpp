@@ -4,6 +4,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -12,6 +13,9 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   return _values.at(chunk_offset);
@@ -22,11 +26,35 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   _values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueSegment<T>::append_values(const typename std::vector<T>::const_iterator begin,
+                                    const typename std::vector<T>::const_iterator end) {
+  _values.insert(_values.end(), begin, end);
+}
+
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+void ValueSegment<T>::shrink_to_fit() {
+  _values.shrink_to_fit();
+}
+
+template <typename T>
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto memory_usage = size_t{0};
+    for (const auto& value : _values) {
+      memory_usage += value_memory_usage(value);
+    }
+    return memory_usage;
+  } else {
+    return sizeof(T) * _values.size();
+  }
+}
+
 template <typename T>
 const std::vector<T>& ValueSegment<T>::values() const {
   return _values;
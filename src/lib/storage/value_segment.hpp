@@ -13,15 +13,30 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // Takes ownership of already materialized values. This is the fastest way to fill a segment, as it neither goes
+  // through AllTypeVariant nor grows the vector step by step.
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // add a value to the end
   void append(const AllTypeVariant& val) final;
 
+  // Appends a range of values without going through AllTypeVariant, e.g., when chunks are merged.
+  void append_values(typename std::vector<T>::const_iterator begin, typename std::vector<T>::const_iterator end);
+
   // return the number of entries
   ChunkOffset size() const final;
 
+  // release the spare capacity of the value vector
+  void shrink_to_fit() final;
+
+  // returns the memory used by the values, not including spare capacity
+  size_t estimate_memory_usage() const final;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
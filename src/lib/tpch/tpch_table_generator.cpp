@@ -0,0 +1,453 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const std::unordered_map<TpchTable, std::string> tpch_table_names = {
+    {TpchTable::Part, "part"},         {TpchTable::PartSupp, "partsupp"}, {TpchTable::Supplier, "supplier"},
+    {TpchTable::Customer, "customer"}, {TpchTable::Orders, "orders"},     {TpchTable::LineItem, "lineitem"},
+    {TpchTable::Nation, "nation"},     {TpchTable::Region, "region"}};
+
+namespace {
+
+// Cardinalities as defined in Section 4.2.5 of the TPC-H specification.
+constexpr auto SUPPLIER_ROWS_PER_SCALE_FACTOR = size_t{10'000};
+constexpr auto CUSTOMER_ROWS_PER_SCALE_FACTOR = size_t{150'000};
+constexpr auto PART_ROWS_PER_SCALE_FACTOR = size_t{200'000};
+constexpr auto ORDER_ROWS_PER_SCALE_FACTOR = size_t{1'500'000};
+constexpr auto CLERKS_PER_SCALE_FACTOR = size_t{1'000};
+constexpr auto SUPPLIERS_PER_PART = int32_t{4};
+
+// Dates are handled as days since 1970-01-01. Orders are placed between STARTDATE and ENDDATE - 151 days, line items
+// shipped after CURRENT_DATE are still open.
+constexpr auto START_DATE = int32_t{8'035};    // 1992-01-01
+constexpr auto END_DATE = int32_t{10'591};     // 1998-12-31
+constexpr auto CURRENT_DATE = int32_t{9'298};  // 1995-06-17
+
+const auto region_names = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const auto nations = std::vector<std::pair<std::string, int32_t>>{
+    {"ALGERIA", 0}, {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1}, {"EGYPT", 4}, {"ETHIOPIA", 0}, {"FRANCE", 3},
+    {"GERMANY", 3}, {"INDIA", 2}, {"INDONESIA", 2}, {"IRAN", 4}, {"IRAQ", 4}, {"JAPAN", 2}, {"JORDAN", 4}, {"KENYA", 0},
+    {"MOROCCO", 0}, {"MOZAMBIQUE", 0}, {"PERU", 1}, {"CHINA", 2}, {"ROMANIA", 3}, {"SAUDI ARABIA", 4}, {"VIETNAM", 2},
+    {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+
+const auto market_segments = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto order_priorities = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto ship_instructions = std::vector<std::string>{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto ship_modes = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+const auto part_type_syllables = std::array<std::vector<std::string>, 3>{
+    std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"},
+    std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"},
+    std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"}};
+const auto container_syllables = std::array<std::vector<std::string>, 2>{
+    std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"},
+    std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"}};
+
+const auto part_name_words = std::vector<std::string>{
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush", "brown",
+    "burlywood", "chiffon", "chocolate", "coral", "cornflower", "cream", "cyan", "dark", "deep", "dim", "dodger",
+    "drab", "firebrick", "forest", "frosted", "gainsboro", "ghost", "goldenrod", "green", "grey", "honeydew", "hot",
+    "indian", "ivory", "khaki", "lace", "lavender", "lawn", "lemon", "light", "lime", "linen", "magenta", "maroon",
+    "medium", "metallic", "midnight", "mint", "misty", "moccasin", "navajo", "navy", "olive", "orange", "orchid",
+    "pale", "papaya", "peach", "peru", "pink", "plum", "powder", "puff", "purple", "red", "rose", "rosy", "royal",
+    "saddle", "salmon", "sandy", "seashell", "sienna", "sky", "slate", "smoke", "snow", "spring", "steel", "tan",
+    "thistle", "tomato", "turquoise", "violet", "wheat", "white", "yellow"};
+
+const auto comment_words = std::vector<std::string>{
+    "furiously", "sly", "careful", "blithely", "quickly", "fluffily", "slyly", "ironic", "final", "regular", "express",
+    "pending", "special", "unusual", "bold", "even", "silent", "packages", "requests", "accounts", "deposits", "foxes",
+    "ideas", "theodolites", "pinto", "beans", "instructions", "dependencies", "excuses", "platelets", "asymptotes",
+    "courts", "dolphins", "sleep", "wake", "are", "haggle", "nag", "use", "boost", "affix", "detect", "integrate",
+    "cajole", "among", "across", "about", "above", "after", "along"};
+
+// Converts days since 1970-01-01 to a "YYYY-MM-DD" string. See http://howardhinnant.github.io/date_algorithms.html.
+std::string format_date(const int32_t days_since_epoch) {
+  const auto shifted_days = days_since_epoch + 719'468;
+  const auto era = (shifted_days >= 0 ? shifted_days : shifted_days - 146'096) / 146'097;
+  const auto day_of_era = shifted_days - era * 146'097;
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36'524 - day_of_era / 146'096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+
+  auto buffer = std::array<char, 16>{};
+  std::snprintf(buffer.data(), buffer.size(), "%04d-%02d-%02d", year, month, day);
+  return buffer.data();
+}
+
+// Formats, e.g., "Customer#000000042".
+std::string format_key(const std::string& prefix, const int32_t key) {
+  auto buffer = std::array<char, 16>{};
+  std::snprintf(buffer.data(), buffer.size(), "%09d", key);
+  return prefix + "#" + buffer.data();
+}
+
+// Random draws used by all tables. Each table owns one instance so that tables can be generated independently.
+class RandomGenerator {
+ public:
+  explicit RandomGenerator(const uint32_t seed) : _engine(seed) {}
+
+  int32_t integer(const int32_t min, const int32_t max) {
+    return std::uniform_int_distribution<int32_t>{min, max}(_engine);
+  }
+
+  // Decimal with two digits after the point, drawn uniformly from [min, max].
+  float decimal(const float min, const float max) {
+    return static_cast<float>(integer(static_cast<int32_t>(min * 100), static_cast<int32_t>(max * 100))) / 100.0f;
+  }
+
+  const std::string& element(const std::vector<std::string>& list) {
+    return list[integer(0, static_cast<int32_t>(list.size()) - 1)];
+  }
+
+  std::string alphanumeric(const int32_t min_length, const int32_t max_length) {
+    static constexpr auto characters =
+        std::string_view{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,"};
+    auto result = std::string(integer(min_length, max_length), ' ');
+    for (auto& character : result) {
+      character = characters[integer(0, characters.size() - 1)];
+    }
+    return result;
+  }
+
+  std::string text(const int32_t min_words, const int32_t max_words) {
+    auto result = element(comment_words);
+    const auto word_count = integer(min_words, max_words);
+    for (auto word_index = int32_t{1}; word_index < word_count; ++word_index) {
+      result += " " + element(comment_words);
+    }
+    return result;
+  }
+
+  std::string phone(const int32_t nation_key) {
+    return std::to_string(nation_key + 10) + "-" + std::to_string(integer(100, 999)) + "-" +
+           std::to_string(integer(100, 999)) + "-" + std::to_string(integer(1000, 9999));
+  }
+
+ private:
+  std::mt19937 _engine;
+};
+
+// Collects rows in one typed vector per column and hands them to the table as soon as a chunk is full.
+template <typename... DataTypes>
+class TableBuilder {
+ public:
+  TableBuilder(const std::array<std::string, sizeof...(DataTypes)>& column_names, const ChunkOffset chunk_size,
+               const size_t expected_row_count)
+      : _table(std::make_shared<Table>(chunk_size)),
+        _chunk_size(chunk_size),
+        _reserved_size(std::min(static_cast<size_t>(chunk_size), expected_row_count)) {
+    auto column_types = std::array<DataType, sizeof...(DataTypes)>{data_type_from_type<DataTypes>()...};
+    for (auto column_id = ColumnID{0}; column_id < column_names.size(); ++column_id) {
+      _table->add_column(column_names[column_id], column_types[column_id]);
+    }
+    _reserve();
+  }
+
+  void append_row(DataTypes... values) {
+    _append_values(std::index_sequence_for<DataTypes...>{}, std::move(values)...);
+    if (++_chunk_row_count == _chunk_size) {
+      _emplace_chunk();
+    }
+  }
+
+  std::shared_ptr<Table> finish() {
+    if (_chunk_row_count > 0) {
+      _emplace_chunk();
+    }
+    return _table;
+  }
+
+ private:
+  template <size_t... Indices>
+  void _append_values(std::index_sequence<Indices...>, DataTypes&&... values) {
+    (std::get<Indices>(_columns).push_back(std::move(values)), ...);
+  }
+
+  void _emplace_chunk() {
+    auto chunk = Chunk{};
+    std::apply(
+        [&](auto&... columns) {
+          (chunk.add_segment(std::make_shared<ValueSegment<DataTypes>>(std::move(columns))), ...);
+        },
+        _columns);
+    _table->emplace_chunk(std::move(chunk));
+
+    _columns = {};
+    _chunk_row_count = 0;
+    _reserve();
+  }
+
+  void _reserve() {
+    std::apply([&](auto&... columns) { (columns.reserve(_reserved_size), ...); }, _columns);
+  }
+
+  std::shared_ptr<Table> _table;
+  const ChunkOffset _chunk_size;
+  const size_t _reserved_size;
+  std::tuple<std::vector<DataTypes>...> _columns;
+  ChunkOffset _chunk_row_count{0};
+};
+
+// Offsets to the user-provided seed, one per table.
+enum TableSeed : uint32_t { RegionSeed, NationSeed, SupplierSeed, CustomerSeed, PartSeed, PartSuppSeed, OrdersSeed };
+
+// Price of a part as defined in Section 4.2.3 of the TPC-H specification.
+float retail_price(const int32_t part_key) {
+  return static_cast<float>(90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1000)) / 100.0f;
+}
+
+// Key of the supplier_index-th of the four suppliers of a part, see Section 4.2.3 of the TPC-H specification.
+int32_t supplier_key(const int32_t part_key, const int32_t supplier_index, const int32_t supplier_count) {
+  return static_cast<int32_t>(
+             (part_key + supplier_index * (supplier_count / 4 + (part_key - 1) / supplier_count)) % supplier_count) +
+         1;
+}
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size, const uint32_t seed)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _seed(seed) {
+  Assert(scale_factor > 0.0f, "Scale factor must be positive");
+  Assert(chunk_size > 0, "Chunk size must be positive");
+}
+
+std::unordered_map<TpchTable, std::shared_ptr<Table>> TpchTableGenerator::generate() const {
+  auto tables = std::unordered_map<TpchTable, std::shared_ptr<Table>>{};
+  tables[TpchTable::Region] = _generate_region();
+  tables[TpchTable::Nation] = _generate_nation();
+  tables[TpchTable::Supplier] = _generate_supplier();
+  tables[TpchTable::Customer] = _generate_customer();
+  tables[TpchTable::Part] = _generate_part();
+  tables[TpchTable::PartSupp] = _generate_partsupp();
+  std::tie(tables[TpchTable::Orders], tables[TpchTable::LineItem]) = _generate_orders_and_lineitems();
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  auto& storage_manager = StorageManager::get();
+  for (const auto& [tpch_table, table] : generate()) {
+    storage_manager.add_table(tpch_table_names.at(tpch_table), table);
+  }
+}
+
+size_t TpchTableGenerator::_scaled_row_count(const size_t rows_per_scale_factor) const {
+  return std::max(size_t{1}, static_cast<size_t>(std::llround(static_cast<double>(rows_per_scale_factor) *
+                                                               static_cast<double>(_scale_factor))));
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_region() const {
+  auto random = RandomGenerator{_seed + RegionSeed};
+  auto builder = TableBuilder<int32_t, std::string, std::string>{
+      {"r_regionkey", "r_name", "r_comment"}, _chunk_size, region_names.size()};
+
+  for (auto region_key = int32_t{0}; region_key < static_cast<int32_t>(region_names.size()); ++region_key) {
+    builder.append_row(region_key, region_names[region_key], random.text(4, 12));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_nation() const {
+  auto random = RandomGenerator{_seed + NationSeed};
+  auto builder = TableBuilder<int32_t, std::string, int32_t, std::string>{
+      {"n_nationkey", "n_name", "n_regionkey", "n_comment"}, _chunk_size, nations.size()};
+
+  for (auto nation_key = int32_t{0}; nation_key < static_cast<int32_t>(nations.size()); ++nation_key) {
+    const auto& [name, region_key] = nations[nation_key];
+    builder.append_row(nation_key, name, region_key, random.text(4, 12));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_supplier() const {
+  auto random = RandomGenerator{_seed + SupplierSeed};
+  const auto row_count = _scaled_row_count(SUPPLIER_ROWS_PER_SCALE_FACTOR);
+  auto builder = TableBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string>{
+      {"s_suppkey", "s_name", "s_address", "s_nationkey", "s_phone", "s_acctbal", "s_comment"},
+      _chunk_size,
+      row_count};
+
+  for (auto supplier_key = int32_t{1}; supplier_key <= static_cast<int32_t>(row_count); ++supplier_key) {
+    const auto nation_key = random.integer(0, static_cast<int32_t>(nations.size()) - 1);
+    builder.append_row(supplier_key, format_key("Supplier", supplier_key), random.alphanumeric(10, 40), nation_key,
+                       random.phone(nation_key), random.decimal(-999.99f, 9999.99f), random.text(4, 12));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_customer() const {
+  auto random = RandomGenerator{_seed + CustomerSeed};
+  const auto row_count = _scaled_row_count(CUSTOMER_ROWS_PER_SCALE_FACTOR);
+  auto builder =
+      TableBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string, std::string>{
+          {"c_custkey", "c_name", "c_address", "c_nationkey", "c_phone", "c_acctbal", "c_mktsegment", "c_comment"},
+          _chunk_size,
+          row_count};
+
+  for (auto customer_key = int32_t{1}; customer_key <= static_cast<int32_t>(row_count); ++customer_key) {
+    const auto nation_key = random.integer(0, static_cast<int32_t>(nations.size()) - 1);
+    builder.append_row(customer_key, format_key("Customer", customer_key), random.alphanumeric(10, 40), nation_key,
+                       random.phone(nation_key), random.decimal(-999.99f, 9999.99f), random.element(market_segments),
+                       random.text(4, 12));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part() const {
+  auto random = RandomGenerator{_seed + PartSeed};
+  const auto row_count = _scaled_row_count(PART_ROWS_PER_SCALE_FACTOR);
+  auto builder = TableBuilder<int32_t, std::string, std::string, std::string, std::string, int32_t, std::string, float,
+                              std::string>{{"p_partkey", "p_name", "p_mfgr", "p_brand", "p_type", "p_size",
+                                            "p_container", "p_retailprice", "p_comment"},
+                                           _chunk_size,
+                                           row_count};
+
+  for (auto part_key = int32_t{1}; part_key <= static_cast<int32_t>(row_count); ++part_key) {
+    auto name = random.element(part_name_words);
+    for (auto word_index = 1; word_index < 5; ++word_index) {
+      name += " " + random.element(part_name_words);
+    }
+    const auto manufacturer = random.integer(1, 5);
+    const auto brand = manufacturer * 10 + random.integer(1, 5);
+    const auto type = random.element(part_type_syllables[0]) + " " + random.element(part_type_syllables[1]) + " " +
+                      random.element(part_type_syllables[2]);
+    const auto container = random.element(container_syllables[0]) + " " + random.element(container_syllables[1]);
+
+    builder.append_row(part_key, std::move(name), "Manufacturer#" + std::to_string(manufacturer),
+                       "Brand#" + std::to_string(brand), type, random.integer(1, 50), container,
+                       retail_price(part_key), random.text(1, 4));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_partsupp() const {
+  auto random = RandomGenerator{_seed + PartSuppSeed};
+  const auto part_count = static_cast<int32_t>(_scaled_row_count(PART_ROWS_PER_SCALE_FACTOR));
+  const auto supplier_count = static_cast<int32_t>(_scaled_row_count(SUPPLIER_ROWS_PER_SCALE_FACTOR));
+  auto builder = TableBuilder<int32_t, int32_t, int32_t, float, std::string>{
+      {"ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost", "ps_comment"},
+      _chunk_size,
+      static_cast<size_t>(part_count * SUPPLIERS_PER_PART)};
+
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    for (auto supplier_index = int32_t{0}; supplier_index < SUPPLIERS_PER_PART; ++supplier_index) {
+      builder.append_row(part_key, supplier_key(part_key, supplier_index, supplier_count), random.integer(1, 9999),
+                         random.decimal(1.0f, 1000.0f), random.text(4, 12));
+    }
+  }
+  return builder.finish();
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::_generate_orders_and_lineitems() const {
+  auto random = RandomGenerator{_seed + OrdersSeed};
+  const auto order_count = _scaled_row_count(ORDER_ROWS_PER_SCALE_FACTOR);
+  const auto customer_count = static_cast<int32_t>(_scaled_row_count(CUSTOMER_ROWS_PER_SCALE_FACTOR));
+  const auto part_count = static_cast<int32_t>(_scaled_row_count(PART_ROWS_PER_SCALE_FACTOR));
+  const auto supplier_count = static_cast<int32_t>(_scaled_row_count(SUPPLIER_ROWS_PER_SCALE_FACTOR));
+  const auto clerk_count = static_cast<int32_t>(_scaled_row_count(CLERKS_PER_SCALE_FACTOR));
+
+  auto orders_builder = TableBuilder<int32_t, int32_t, std::string, float, std::string, std::string, std::string,
+                                     int32_t, std::string>{{"o_orderkey", "o_custkey", "o_orderstatus", "o_totalprice",
+                                                            "o_orderdate", "o_orderpriority", "o_clerk",
+                                                            "o_shippriority", "o_comment"},
+                                                           _chunk_size,
+                                                           order_count};
+
+  // On average, an order has four line items.
+  auto lineitem_builder = TableBuilder<int32_t, int32_t, int32_t, int32_t, float, float, float, float, std::string,
+                                       std::string, std::string, std::string, std::string, std::string, std::string,
+                                       std::string>{
+      {"l_orderkey", "l_partkey", "l_suppkey", "l_linenumber", "l_quantity", "l_extendedprice", "l_discount", "l_tax",
+       "l_returnflag", "l_linestatus", "l_shipdate", "l_commitdate", "l_receiptdate", "l_shipinstruct", "l_shipmode",
+       "l_comment"},
+      _chunk_size,
+      order_count * 4};
+
+  // Formatting dates is comparatively expensive, so all strings that can occur are created upfront.
+  auto date_strings = std::vector<std::string>{};
+  date_strings.reserve(END_DATE - START_DATE + 1);
+  for (auto date = START_DATE; date <= END_DATE; ++date) {
+    date_strings.emplace_back(format_date(date));
+  }
+  const auto date_string = [&](const int32_t date) -> const std::string& { return date_strings[date - START_DATE]; };
+
+  for (auto order_index = size_t{0}; order_index < order_count; ++order_index) {
+    // Only eight out of every 32 order keys are used (Section 4.2.3).
+    const auto order_key = static_cast<int32_t>((order_index / 8) * 32 + order_index % 8 + 1);
+
+    // Every third customer does not place any orders.
+    auto customer_key = random.integer(1, customer_count);
+    while (customer_key % 3 == 0 && customer_count > 2) {
+      customer_key = random.integer(1, customer_count);
+    }
+
+    const auto order_date = random.integer(START_DATE, END_DATE - 151);
+    const auto line_count = random.integer(1, 7);
+    auto total_price = 0.0f;
+    auto fulfilled_line_count = 0;
+
+    for (auto line_number = int32_t{1}; line_number <= line_count; ++line_number) {
+      const auto part_key = random.integer(1, part_count);
+      const auto quantity = static_cast<float>(random.integer(1, 50));
+      const auto extended_price = quantity * retail_price(part_key);
+      const auto discount = random.decimal(0.0f, 0.1f);
+      const auto tax = random.decimal(0.0f, 0.08f);
+      const auto ship_date = order_date + random.integer(1, 121);
+      const auto commit_date = order_date + random.integer(30, 90);
+      const auto receipt_date = ship_date + random.integer(1, 30);
+
+      auto return_flag = std::string{"N"};
+      if (receipt_date <= CURRENT_DATE) {
+        return_flag = random.integer(0, 1) ? "R" : "A";
+      }
+      const auto is_fulfilled = ship_date <= CURRENT_DATE;
+      fulfilled_line_count += is_fulfilled;
+      total_price += extended_price * (1.0f + tax) * (1.0f - discount);
+
+      lineitem_builder.append_row(order_key, part_key,
+                                  supplier_key(part_key, random.integer(0, SUPPLIERS_PER_PART - 1), supplier_count),
+                                  line_number, quantity, extended_price, discount, tax, std::move(return_flag),
+                                  is_fulfilled ? "F" : "O", date_string(ship_date), date_string(commit_date),
+                                  date_string(receipt_date), random.element(ship_instructions),
+                                  random.element(ship_modes), random.text(1, 4));
+    }
+
+    auto order_status = std::string{"P"};
+    if (fulfilled_line_count == line_count) {
+      order_status = "F";
+    } else if (fulfilled_line_count == 0) {
+      order_status = "O";
+    }
+
+    orders_builder.append_row(order_key, customer_key, std::move(order_status), total_price, date_string(order_date),
+                              random.element(order_priorities), format_key("Clerk", random.integer(1, clerk_count)),
+                              0, random.text(4, 12));
+  }
+
+  return {orders_builder.finish(), lineitem_builder.finish()};
+}
+
+}  // namespace opossum
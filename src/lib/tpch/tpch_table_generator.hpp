@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class TpchTable { Part, PartSupp, Supplier, Customer, Orders, LineItem, Nation, Region };
+
+extern const std::unordered_map<TpchTable, std::string> tpch_table_names;
+
+// Generates the eight TPC-H tables in-process, without going through .tbl files.
+//
+// The data follows the value distributions and cardinalities of the TPC-H specification (e.g., 150,000 customers and
+// 1,500,000 orders per scale factor) closely enough to run the benchmark queries, but it is not byte-identical to
+// the output of the official dbgen tool. Decimals are stored as float and dates as "YYYY-MM-DD" strings, as there
+// are no decimal or date types. Each table is drawn from its own random engine that is seeded with a fixed per-table
+// offset to the given seed, so the content of a table only depends on the seed and the scale factor.
+//
+// Rows are collected in typed vectors and handed over chunk by chunk via Table::emplace_chunk, so the generation
+// neither pays for AllTypeVariant conversions nor for growing segments row by row.
+class TpchTableGenerator {
+ public:
+  explicit TpchTableGenerator(float scale_factor, ChunkOffset chunk_size = DEFAULT_CHUNK_SIZE, uint32_t seed = 42);
+
+  // Creates all tables. The table names are those of the TPC-H specification, e.g., "lineitem".
+  std::unordered_map<TpchTable, std::shared_ptr<Table>> generate() const;
+
+  // Creates all tables and adds them to the StorageManager under their TPC-H names.
+  void generate_and_store() const;
+
+  static constexpr auto DEFAULT_CHUNK_SIZE = ChunkOffset{100'000};
+
+ protected:
+  std::shared_ptr<Table> _generate_region() const;
+  std::shared_ptr<Table> _generate_nation() const;
+  std::shared_ptr<Table> _generate_supplier() const;
+  std::shared_ptr<Table> _generate_customer() const;
+  std::shared_ptr<Table> _generate_part() const;
+  std::shared_ptr<Table> _generate_partsupp() const;
+
+  // Orders and line items are generated together, as the order status and total price depend on the line items.
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> _generate_orders_and_lineitems() const;
+
+  // Number of rows of a table whose cardinality grows linearly with the scale factor, but at least one row.
+  size_t _scaled_row_count(size_t rows_per_scale_factor) const;
+
+  const float _scale_factor;
+  const ChunkOffset _chunk_size;
+  const uint32_t _seed;
+};
+
+}  // namespace opossum
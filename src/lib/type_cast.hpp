@@ -1,58 +1,128 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <boost/hana/contains.hpp>
-#include <boost/hana/integral_constant.hpp>
-#include <boost/hana/not_equal.hpp>
-#include <boost/hana/size.hpp>
-#include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 namespace hana = boost::hana;
 
-namespace detail {
-
-// Returns the index of type T in an Iterable
-template <typename Sequence, typename T>
-constexpr auto index_of(Sequence const& sequence, T const& element) {
-  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
-  return decltype(size)::value;
-}
-
-}  // namespace detail
-
 // Retrieves the value stored in an AllTypeVariant without conversion
 template <typename T>
 const T& get(const AllTypeVariant& value) {
   static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
-  return boost::get<T>(value);
+  return std::get<T>(value);
 }
 
-// cast methods - from variant to specific type
+namespace detail {
+
+// Converts a number to another numeric type. Floating-point values are truncated when they are converted to integral
+// types. Returns nullopt if the target type cannot represent the value.
+template <typename T, typename Source>
+std::optional<T> convert_number(const Source value) {
+  if constexpr (std::is_integral_v<T> && std::is_integral_v<Source>) {
+    if (!std::in_range<T>(value)) return std::nullopt;
+  } else if constexpr (std::is_integral_v<T>) {
+    // -2^digits and 2^digits are exact in floating-point types, and NaN fails both comparisons.
+    const auto truncated = std::trunc(static_cast<double>(value));
+    const auto bound = std::ldexp(1.0, std::numeric_limits<T>::digits);
+    if (!(truncated >= -bound && truncated < bound)) return std::nullopt;
+    return static_cast<T>(truncated);
+  } else if constexpr (std::is_floating_point_v<Source> && sizeof(T) < sizeof(Source)) {
+    // Infinity and NaN are kept, but converting finite values beyond the range of T is undefined.
+    if (std::isfinite(value) && std::abs(value) > std::numeric_limits<T>::max()) return std::nullopt;
+  }
+  return static_cast<T>(value);
+}
 
-// Template specialization for everything but integral types
+// Parses a string that consists of nothing but a number, like "-17", "+3.5", or "1e6". Returns nullopt for other
+// strings and for numbers that T cannot represent. Unlike std::stod and lexical_cast, this does not depend on the
+// locale and does not throw.
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+std::optional<T> parse_number(std::string_view string) {
+  if (string.starts_with('+')) {
+    string.remove_prefix(1);
+    if (string.starts_with('-')) return std::nullopt;
+  }
+  auto value = T{};
+  const auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), value);
+  if (error != std::errc{} || end != string.data() + string.size()) return std::nullopt;
+  return value;
+}
 
-  return boost::lexical_cast<T>(value);
+// Prints a number without loss, with as few digits as possible
+template <typename T>
+std::string format_number(const T value) {
+  // Sufficient for the 20 characters of the lowest int64_t and the up to 24 characters of a double
+  auto buffer = std::array<char, 32>{};
+  const auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  DebugAssert(error == std::errc{}, "Buffer is too small for number");
+  return std::string(buffer.data(), end);
 }
 
-// Template specialization for integral types
+}  // namespace detail
+
+// Converts the value of an AllTypeVariant to T. Numbers are converted into each other, parsed from strings, and
+// printed into strings. Values that cannot be represented by T, such as "abc" or 2^40 for int32_t, are rejected with
+// an exception. Integral types also accept floating-point values, which are truncated, e.g., "3.7" becomes 3.
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+T type_cast(const AllTypeVariant& value) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  if (const auto* typed_value = std::get_if<T>(&value)) return *typed_value;
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::visit(
+        [](const auto& number) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(number)>, std::string>) {
+            return number;
+          } else {
+            return detail::format_number(number);
+          }
+        },
+        value);
+  } else {
+    auto result = std::optional<T>{};
+    if (const auto* string = std::get_if<std::string>(&value)) {
+      result = detail::parse_number<T>(*string);
+      if constexpr (std::is_integral_v<T>) {
+        if (!result) {
+          const auto floating_point = detail::parse_number<double>(*string);
+          if (floating_point) result = detail::convert_number<T>(*floating_point);
+        }
+      }
+    } else {
+      std::visit(
+          [&](const auto& number) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(number)>, std::string>) {
+              result = detail::convert_number<T>(number);
+            }
+          },
+          value);
+    }
+
+    if (!result) {
+      auto stream = std::stringstream{};
+      stream << "Cannot convert " << value << " to " << data_type_from_type<T>();
+      Fail(stream.str());
+    }
+    return *result;
   }
 }
 
+// Converts the value to a string, e.g., "3.5" for the float 3.5
+std::string to_string(const AllTypeVariant& value);
+
 }  // namespace opossum
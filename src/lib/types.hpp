@@ -32,12 +32,28 @@ STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(opossum::ColumnID::base_type, ColumnCount);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint16_t, PartitionID);
 
 namespace opossum {
 
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Returned by DictionarySegment::lower_bound and upper_bound if no value in the dictionary is large enough.
+constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+
+using CommitID = uint32_t;
+using TransactionID = uint32_t;
+
+// Rows that have not been committed yet have a begin commit ID of MAX_COMMIT_ID, rows that have not been deleted an
+// end commit ID of MAX_COMMIT_ID.
+constexpr CommitID MAX_COMMIT_ID = std::numeric_limits<CommitID>::max();
+
+// Rows that are not locked by any transaction carry this transaction ID. Real transaction IDs start at 1.
+constexpr TransactionID INVALID_TRANSACTION_ID = 0;
+
+enum class UseMvcc : bool { Yes = true, No = false };
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -52,7 +68,19 @@ struct RowID {
   }
 };
 
-enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+// OpLike and OpNotLike compare string columns with SQL LIKE patterns (see LikeMatcher).
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpLike,
+  OpNotLike
+};
+
+enum class OrderByMode { Ascending, Descending };
 
 using PosList = std::vector<RowID>;
 
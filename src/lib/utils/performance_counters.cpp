@@ -0,0 +1,90 @@
+#include "performance_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+
+namespace opossum {
+
+#ifdef __linux__
+
+namespace {
+
+int open_counter(const uint64_t config) {
+  auto attributes = perf_event_attr{};
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.type = PERF_TYPE_HARDWARE;
+  attributes.size = sizeof(attributes);
+  attributes.config = config;
+  attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+
+  // There is no glibc wrapper for perf_event_open. Measure the calling thread on any CPU.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+
+}  // namespace
+
+PerformanceCounters::PerformanceCounters() {
+  _file_descriptors[Cycles] = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+  _file_descriptors[Instructions] = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+  _file_descriptors[LLCMisses] = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+  _file_descriptors[BranchMisses] = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+PerformanceCounters::~PerformanceCounters() {
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor >= 0) close(file_descriptor);
+  }
+}
+
+void PerformanceCounters::start() {
+  for (const auto file_descriptor : _file_descriptors) {
+    if (file_descriptor < 0) continue;
+    ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+HardwareCounters PerformanceCounters::stop() {
+  auto values = std::array<std::optional<uint64_t>, CounterCount>{};
+  for (auto counter_index = size_t{0}; counter_index < CounterCount; ++counter_index) {
+    const auto file_descriptor = _file_descriptors[counter_index];
+    if (file_descriptor < 0) continue;
+
+    ioctl(file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+    auto value = uint64_t{0};
+    if (read(file_descriptor, &value, sizeof(value)) == sizeof(value)) {
+      values[counter_index] = value;
+    }
+  }
+  return HardwareCounters{values[Cycles], values[Instructions], values[LLCMisses], values[BranchMisses]};
+}
+
+#else
+
+PerformanceCounters::PerformanceCounters() { _file_descriptors.fill(-1); }
+
+PerformanceCounters::~PerformanceCounters() = default;
+
+void PerformanceCounters::start() {}
+
+HardwareCounters PerformanceCounters::stop() { return HardwareCounters{}; }
+
+#endif
+
+bool PerformanceCounters::available() const {
+  return std::any_of(_file_descriptors.cbegin(), _file_descriptors.cend(),
+                     [](const auto file_descriptor) { return file_descriptor >= 0; });
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Values read from the CPU's hardware performance counters. A counter is std::nullopt if it could not be opened,
+// e.g., because the platform does not support it or the process is not allowed to use it.
+struct HardwareCounters {
+  std::optional<uint64_t> cycles;
+  std::optional<uint64_t> instructions;
+  std::optional<uint64_t> llc_misses;
+  std::optional<uint64_t> branch_misses;
+};
+
+// Measures hardware counters of the calling thread through perf_event_open(2).
+//
+// This is only supported on Linux. Even there, the kernel might forbid the access (see
+// /proc/sys/kernel/perf_event_paranoid) or the (virtualized) CPU might not expose some counters. In these cases, the
+// affected counters are simply not reported and available() returns false if none of them could be opened. Only
+// user-space events are counted so that the default paranoid level of 2 suffices.
+class PerformanceCounters : private Noncopyable {
+ public:
+  PerformanceCounters();
+  ~PerformanceCounters();
+
+  // Returns whether at least one counter could be opened.
+  bool available() const;
+
+  // Resets and starts all counters.
+  void start();
+
+  // Stops all counters and returns the events counted since the last call to start().
+  HardwareCounters stop();
+
+ protected:
+  enum CounterIndex { Cycles, Instructions, LLCMisses, BranchMisses, CounterCount };
+
+  // File descriptors of the opened counters, -1 for counters that are not available.
+  std::array<int, CounterCount> _file_descriptors;
+};
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#include "timer.hpp"
+
+namespace opossum {
+
+Timer::Timer() : _begin(std::chrono::steady_clock::now()) {}
+
+std::chrono::nanoseconds Timer::lap() {
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _begin);
+  _begin = now;
+  return elapsed;
+}
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+
+namespace opossum {
+
+// Simple stopwatch based on the steady clock, e.g., for benchmarks and operator performance data.
+class Timer final {
+ public:
+  Timer();
+
+  // Returns the time elapsed since the construction or the last call to lap() and restarts the measurement.
+  std::chrono::nanoseconds lap();
+
+ private:
+  std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace opossum
@@ -0,0 +1,146 @@
+#include "tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace opossum {
+
+thread_local Tracer::WorkerAssignment Tracer::_worker_assignment;
+
+namespace {
+
+const char* category_name(const TraceCategory category) {
+  switch (category) {
+    case TraceCategory::Task:
+      return "task";
+    case TraceCategory::Operator:
+      return "operator";
+    case TraceCategory::Chunk:
+      return "chunk";
+  }
+  return "";
+}
+
+}  // namespace
+
+Tracer& Tracer::get() {
+  static auto instance = Tracer{};
+  return instance;
+}
+
+Tracer::Tracer() : _begin(std::chrono::steady_clock::now()) {}
+
+void Tracer::enable(const bool enabled) { _enabled = enabled; }
+
+void Tracer::record(const char* name, const TraceCategory category, const TracePhase phase,
+                    const std::optional<ChunkID> chunk_id) {
+  const auto timestamp = std::chrono::steady_clock::now() - _begin;
+  auto& worker = _worker();
+  const auto event_index = worker.event_count.load(std::memory_order_relaxed);
+
+  // Readers that see any of the following stores also see the event count of the slot's previous event, so that they
+  // can tell that the event they read might be torn (see events()).
+  std::atomic_thread_fence(std::memory_order_release);
+  auto& slot = worker.slots[event_index % EVENTS_PER_WORKER];
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.timestamp.store(std::chrono::nanoseconds{timestamp}.count(), std::memory_order_relaxed);
+  slot.chunk_id.store(chunk_id ? static_cast<ChunkID::base_type>(*chunk_id) : NO_CHUNK_ID, std::memory_order_relaxed);
+  slot.category.store(category, std::memory_order_relaxed);
+  slot.phase.store(phase, std::memory_order_relaxed);
+  worker.event_count.store(event_index + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> Tracer::events() const {
+  auto events = std::vector<TraceEvent>{};
+  const auto lock = std::lock_guard{_workers_mutex};
+  for (auto worker_id = size_t{0}; worker_id < _workers.size(); ++worker_id) {
+    const auto& worker = *_workers[worker_id];
+    const auto event_count = worker.event_count.load(std::memory_order_acquire);
+    const auto read_begin = std::max(worker.first_event_index.load(std::memory_order_relaxed),
+                                     event_count - std::min(event_count, EVENTS_PER_WORKER));
+    const auto worker_begin = events.size();
+    for (auto event_index = read_begin; event_index < event_count; ++event_index) {
+      const auto& slot = worker.slots[event_index % EVENTS_PER_WORKER];
+      const auto chunk_id = slot.chunk_id.load(std::memory_order_relaxed);
+      events.push_back({slot.name.load(std::memory_order_relaxed), slot.category.load(std::memory_order_relaxed),
+                        slot.phase.load(std::memory_order_relaxed),
+                        chunk_id == NO_CHUNK_ID ? std::nullopt : std::optional<ChunkID>{chunk_id}, worker_id,
+                        std::chrono::nanoseconds{slot.timestamp.load(std::memory_order_relaxed)}});
+    }
+
+    // The thread of the worker might have recorded events meanwhile. While the event with index n is written, the
+    // slot of the event n - EVENTS_PER_WORKER is overwritten, so only events after it are valid.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto next_event_index = worker.event_count.load(std::memory_order_relaxed);
+    const auto first_valid_index = next_event_index + 1 - std::min(next_event_index + 1, EVENTS_PER_WORKER);
+    if (first_valid_index > read_begin) {
+      const auto invalid_count = std::min(first_valid_index - read_begin, events.size() - worker_begin);
+      events.erase(events.begin() + static_cast<std::ptrdiff_t>(worker_begin),
+                   events.begin() + static_cast<std::ptrdiff_t>(worker_begin + invalid_count));
+    }
+  }
+  return events;
+}
+
+void Tracer::write_chrome_trace(std::ostream& stream) const {
+  const auto events = this->events();
+  auto worker_count = size_t{0};
+  {
+    const auto lock = std::lock_guard{_workers_mutex};
+    worker_count = _workers.size();
+  }
+
+  // Timestamps are given in microseconds. The names are written without escaping, as they are identifiers.
+  stream << "{\"traceEvents\":[";
+  auto separator = "\n";
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    stream << separator << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << worker_id
+           << R"(,"args":{"name":"Worker )" << worker_id << "\"}}";
+    separator = ",\n";
+  }
+  stream << std::fixed << std::setprecision(3);
+  for (const auto& event : events) {
+    stream << separator << R"({"name":")" << event.name << R"(","cat":")" << category_name(event.category)
+           << R"(","ph":")" << (event.phase == TracePhase::Begin ? 'B' : 'E') << R"(","pid":1,"tid":)"
+           << event.worker_id << R"(,"ts":)" << static_cast<double>(event.timestamp.count()) / 1'000.0;
+    if (event.chunk_id) stream << R"(,"args":{"chunk_id":)" << *event.chunk_id << "}";
+    stream << "}";
+  }
+  stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Tracer::reset() {
+  enable(false);
+  const auto lock = std::lock_guard{_workers_mutex};
+  for (const auto& worker : _workers) {
+    worker->first_event_index.store(worker->event_count.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+}
+
+Tracer::Worker& Tracer::_worker() {
+  if (_worker_assignment.worker) return *_worker_assignment.worker;
+
+  const auto lock = std::lock_guard{_workers_mutex};
+  auto worker = std::find_if(_workers.begin(), _workers.end(), [](const auto& worker) {
+    return !worker->is_assigned.load(std::memory_order_acquire);
+  });
+  if (worker == _workers.end()) {
+    _workers.emplace_back(std::make_unique<Worker>());
+    worker = std::prev(_workers.end());
+  }
+  (*worker)->is_assigned.store(true, std::memory_order_relaxed);
+  _worker_assignment.worker = worker->get();
+  return **worker;
+}
+
+Tracer::WorkerAssignment::~WorkerAssignment() {
+  if (worker) worker->is_assigned.store(false, std::memory_order_release);
+}
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Kinds of spans, shown as categories in the trace viewer
+enum class TraceCategory : uint8_t { Task, Operator, Chunk };
+
+enum class TracePhase : uint8_t { Begin, End };
+
+struct TraceEvent {
+  const char* name;
+  TraceCategory category;
+  TracePhase phase;
+  std::optional<ChunkID> chunk_id;
+  // Threads record into workers, see Tracer. Spans of the same worker never overlap unless they are nested.
+  size_t worker_id;
+  // Since the construction of the Tracer
+  std::chrono::nanoseconds timestamp;
+};
+
+// The Tracer is a singleton that records when tasks, operators, and the chunks processed by them begin and end, so
+// that the timeline of a parallel query can be inspected, e.g., to see whether workers are idle or imbalanced.
+//
+// Each thread that records events gets a worker, a ring buffer of EVENTS_PER_WORKER slots that retains the latest
+// events. Only this thread writes to it, so recording needs neither locks nor read-modify-write operations. When a
+// thread exits, its worker is handed to the next thread that starts recording, so that short-lived threads do not
+// accumulate buffers. Events can be read at any time; events that are overwritten while they are read are dropped.
+//
+// Tracing is disabled by default, in which case a TraceScope only loads a flag.
+class Tracer : private Noncopyable {
+ public:
+  static Tracer& get();
+
+  static void enable(bool enabled);
+  static bool enabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  // Records an event on the worker of the calling thread, regardless of whether tracing is enabled. The name has to
+  // stay valid until the events are read, e.g., a string literal or the name() of an operator.
+  void record(const char* name, TraceCategory category, TracePhase phase,
+              std::optional<ChunkID> chunk_id = std::nullopt);
+
+  // Returns the retained events of all workers, ordered by worker and time
+  std::vector<TraceEvent> events() const;
+
+  // Writes the retained events in the JSON format of Chrome's trace_event, which chrome://tracing and
+  // ui.perfetto.dev display as a timeline with one row per worker.
+  void write_chrome_trace(std::ostream& stream) const;
+
+  // Disables tracing and drops all events, used especially in tests
+  void reset();
+
+  static constexpr auto EVENTS_PER_WORKER = size_t{1} << 15;
+
+  Tracer(Tracer&&) = delete;
+
+ protected:
+  Tracer();
+
+  // The fields are atomics, so that events can be read while they are overwritten. Relaxed accesses to them compile
+  // to plain loads and stores.
+  struct Slot {
+    std::atomic<const char*> name;
+    std::atomic<int64_t> timestamp;
+    std::atomic<ChunkID::base_type> chunk_id;
+    std::atomic<TraceCategory> category;
+    std::atomic<TracePhase> phase;
+  };
+
+  struct Worker {
+    std::array<Slot, EVENTS_PER_WORKER> slots;
+    // Number of events ever recorded. The event with index i is stored in slots[i % EVENTS_PER_WORKER].
+    std::atomic<uint64_t> event_count{0};
+    // Events before this index were dropped by reset()
+    std::atomic<uint64_t> first_event_index{0};
+    // Whether a thread records into this worker
+    std::atomic_bool is_assigned{false};
+  };
+
+  // Releases the worker of a thread when the thread exits, so that the next thread can take it over
+  struct WorkerAssignment {
+    ~WorkerAssignment();
+    Worker* worker = nullptr;
+  };
+
+  // Returns the worker of the calling thread, assigning one on the first call
+  Worker& _worker();
+
+  static thread_local WorkerAssignment _worker_assignment;
+
+  static constexpr auto NO_CHUNK_ID = ChunkID::base_type{std::numeric_limits<ChunkID::base_type>::max()};
+
+  inline static std::atomic_bool _enabled{false};
+
+  const std::chrono::steady_clock::time_point _begin;
+
+  // Workers are never deallocated, so that threads can hold pointers to them without synchronization.
+  mutable std::mutex _workers_mutex;
+  std::vector<std::unique_ptr<Worker>> _workers;
+};
+
+// Records the begin of a span when it is constructed and the end when it is destroyed, if tracing was enabled at
+// construction.
+class TraceScope : private Noncopyable {
+ public:
+  explicit TraceScope(const char* name, const TraceCategory category,
+                      const std::optional<ChunkID> chunk_id = std::nullopt) {
+    if (!Tracer::enabled()) return;
+    _name = name;
+    _category = category;
+    _chunk_id = chunk_id;
+    Tracer::get().record(_name, _category, TracePhase::Begin, _chunk_id);
+  }
+
+  ~TraceScope() {
+    if (_name) Tracer::get().record(_name, _category, TracePhase::End, _chunk_id);
+  }
+
+ protected:
+  const char* _name = nullptr;
+  TraceCategory _category = TraceCategory::Task;
+  std::optional<ChunkID> _chunk_id;
+};
+
+}  // namespace opossum
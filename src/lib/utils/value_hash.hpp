@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace opossum {
+
+// Hashes a value for probabilistic data structures such as Bloom filters and HyperLogLog sketches, which need all
+// bits of the hash to be uniformly distributed. std::hash is the identity for integers in libstdc++, so its result is
+// mixed with the finalizer of MurmurHash3 to spread consecutive keys over all bits.
+template <typename T>
+uint64_t value_hash(const T& value) {
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
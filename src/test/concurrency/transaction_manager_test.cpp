@@ -0,0 +1,51 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+
+namespace opossum {
+
+class TransactionManagerTest : public BaseTest {};
+
+TEST_F(TransactionManagerTest, HandsOutTransactionIDs) {
+  auto& manager = TransactionManager::get();
+  const auto first_context = manager.new_transaction_context();
+  const auto second_context = manager.new_transaction_context();
+
+  EXPECT_NE(first_context->transaction_id(), INVALID_TRANSACTION_ID);
+  EXPECT_NE(first_context->transaction_id(), second_context->transaction_id());
+}
+
+TEST_F(TransactionManagerTest, CommitAdvancesSnapshot) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.last_commit_id(), 0u);
+
+  const auto context = manager.new_transaction_context();
+  const auto concurrent_context = manager.new_transaction_context();
+  EXPECT_EQ(context->snapshot_commit_id(), 0u);
+
+  context->commit();
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context->commit_id(), 1u);
+  EXPECT_EQ(manager.last_commit_id(), 1u);
+
+  // Snapshots are taken when transactions start.
+  EXPECT_EQ(concurrent_context->snapshot_commit_id(), 0u);
+  EXPECT_EQ(manager.new_transaction_context()->snapshot_commit_id(), 1u);
+}
+
+TEST_F(TransactionManagerTest, RollbackDoesNotCommit) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  context->rollback();
+
+  EXPECT_EQ(context->phase(), TransactionPhase::RolledBack);
+  EXPECT_EQ(manager.last_commit_id(), 0u);
+  EXPECT_THROW(context->commit(), std::exception);
+  EXPECT_THROW(context->commit_id(), std::exception);
+}
+
+}  // namespace opossum
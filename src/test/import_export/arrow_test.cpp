@@ -0,0 +1,193 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/import_export/arrow.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/lz4_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class ArrowTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "double");
+    _table->add_column("c", "string");
+    for (auto row = 0; row < 6; ++row) {
+      _table->append({row, row * 1.5, std::string(row, 'x')});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ArrowTest, ExportValueSegments) {
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  ASSERT_EQ(schema.n_children, 3);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema.children[0]->name}, "a");
+  EXPECT_EQ(std::string{schema.children[1]->format}, "g");
+  EXPECT_EQ(std::string{schema.children[2]->format}, "u");
+  EXPECT_EQ(schema.children[2]->flags & ARROW_FLAG_NULLABLE, 0);
+
+  EXPECT_EQ(array.length, 4);
+  ASSERT_EQ(array.n_children, 3);
+  EXPECT_EQ(array.children[0]->length, 4);
+  EXPECT_EQ(array.children[0]->null_count, 0);
+  EXPECT_EQ(array.children[0]->buffers[0], nullptr);
+
+  // Fixed-width values are shared with the segment.
+  const auto segment = _table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto& values = std::static_pointer_cast<ValueSegment<int32_t>>(segment)->values();
+  EXPECT_EQ(array.children[0]->buffers[1], values.data());
+  EXPECT_EQ(static_cast<const double*>(array.children[1]->buffers[1])[3], 4.5);
+
+  // Strings are converted to offsets and data.
+  ASSERT_EQ(array.children[2]->n_buffers, 3);
+  const auto* offsets = static_cast<const int32_t*>(array.children[2]->buffers[1]);
+  const auto* data = static_cast<const char*>(array.children[2]->buffers[2]);
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[4], 6);
+  EXPECT_EQ(std::string(data + offsets[3], data + offsets[4]), "xxx");
+
+  array.release(&array);
+  schema.release(&schema);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST_F(ArrowTest, ExportedArrayKeepsSegmentsAlive) {
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{1}, &array, &schema);
+  _table.reset();
+
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[1], 5);
+
+  // Consumers may move a child out and release it on its own.
+  auto child = *array.children[0];
+  array.children[0]->release = nullptr;
+  array.release(&array);
+  EXPECT_EQ(static_cast<const int32_t*>(child.buffers[1])[0], 4);
+  child.release(&child);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowTest, CopyOpenChunks) {
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{1}, &array, &schema);
+
+  // Appending to the chunk might reallocate its values, so they are not shared.
+  const auto segment = _table->get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+  EXPECT_NE(array.children[0]->buffers[1], std::static_pointer_cast<ValueSegment<int32_t>>(segment)->values().data());
+  _table->append({6, 9.0, "x"});
+  _table->append({7, 10.5, "y"});
+
+  EXPECT_EQ(array.length, 2);
+  EXPECT_EQ(array.children[0]->length, 2);
+  EXPECT_EQ(static_cast<const int32_t*>(array.children[0]->buffers[1])[1], 5);
+  EXPECT_EQ(static_cast<const double*>(array.children[1]->buffers[1])[0], 6.0);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowTest, ExportDictionarySegments) {
+  _table->compress_chunk(ChunkID{0});
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+
+  const auto& column_schema = *schema.children[2];
+  EXPECT_EQ(std::string{column_schema.format}, "C");
+  EXPECT_TRUE(column_schema.flags & ARROW_FLAG_DICTIONARY_ORDERED);
+  ASSERT_NE(column_schema.dictionary, nullptr);
+  EXPECT_EQ(std::string{column_schema.dictionary->format}, "u");
+
+  const auto& column_array = *array.children[0];
+  ASSERT_NE(column_array.dictionary, nullptr);
+  const auto segment = std::static_pointer_cast<DictionarySegment<int32_t>>(
+      _table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  EXPECT_EQ(column_array.dictionary->buffers[1], segment->dictionary()->data());
+  EXPECT_EQ(static_cast<const uint8_t*>(column_array.buffers[1])[2], 2u);
+
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowTest, RoundTrip) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_cold_chunk(ChunkID{0});
+
+  auto schema = ArrowSchema{};
+  auto array = ArrowArray{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+  const auto imported_table = create_table_from_arrow_schema(schema, 4);
+  EXPECT_EQ(imported_table->column_names(), _table->column_names());
+  EXPECT_EQ(imported_table->column_type(ColumnID{2}), DataType::String);
+  import_arrow_record_batch(*imported_table, &array, &schema);
+  EXPECT_EQ(array.release, nullptr);
+
+  export_chunk_to_arrow(*_table, ChunkID{1}, &array, &schema);
+  import_arrow_record_batch(*imported_table, &array, &schema);
+  EXPECT_TABLE_EQ(imported_table, _table, true);
+}
+
+TEST_F(ArrowTest, ImportDictionaryEncodedArrays) {
+  _table->compress_chunk(ChunkID{0});
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+
+  const auto imported_table = create_table_from_arrow_schema(schema);
+  EXPECT_EQ(imported_table->column_type(ColumnID{0}), DataType::Int);
+  import_arrow_record_batch(*imported_table, &array, &schema);
+  EXPECT_EQ((*imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{1.5});
+  EXPECT_EQ((*imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{2}))[3], AllTypeVariant{"xxx"});
+}
+
+TEST_F(ArrowTest, ImportWithOffset) {
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+
+  // Slice the record batch to its rows 1 and 2.
+  array.offset = 1;
+  array.length = 2;
+  const auto imported_table = create_table_from_arrow_schema(schema);
+  import_arrow_record_batch(*imported_table, &array, &schema);
+  EXPECT_EQ(imported_table->row_count(), 2u);
+  EXPECT_EQ((*imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[0], AllTypeVariant{1});
+  EXPECT_EQ((*imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{2}))[1], AllTypeVariant{"xx"});
+}
+
+TEST_F(ArrowTest, RejectInvalidBatches) {
+  auto array = ArrowArray{};
+  auto schema = ArrowSchema{};
+  export_chunk_to_arrow(*_table, ChunkID{0}, &array, &schema);
+
+  auto other_table = Table{};
+  other_table.add_column("a", "int");
+  EXPECT_THROW(import_arrow_record_batch(other_table, &array, &schema), std::exception);
+
+  array.children[0]->null_count = 1;
+  const auto imported_table = create_table_from_arrow_schema(schema);
+  EXPECT_THROW(import_arrow_record_batch(*imported_table, &array, &schema), std::exception);
+
+  // Failed imports leave releasing the batch to the caller.
+  array.release(&array);
+  schema.release(&schema);
+}
+
+}  // namespace opossum
@@ -1,10 +1,10 @@
 #include <cstdlib>
 #include <string>
 
-#include <boost/variant.hpp>
-
 #include "base_test.hpp"
 
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -31,10 +31,75 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactNumericalValue) {
 
   for (auto value_in : values) {
     const auto variant = AllTypeVariant{value_in};
-    const auto value_out = boost::get<TypeParam>(variant);
+    const auto value_out = get<TypeParam>(variant);
 
     ASSERT_EQ(value_in, value_out);
   }
 }
 
+TYPED_TEST(AllTypeVariantTest, TypeCastRoundTripsThroughStrings) {
+  if constexpr (!std::is_same_v<TypeParam, std::string>) {
+    for (const auto value : {std::numeric_limits<TypeParam>::lowest(), std::numeric_limits<TypeParam>::min(),
+                             std::numeric_limits<TypeParam>::max(), TypeParam{0}, TypeParam{17}}) {
+      const auto string = type_cast<std::string>(AllTypeVariant{value});
+      EXPECT_EQ(type_cast<TypeParam>(AllTypeVariant{string}), value) << string;
+    }
+  }
+}
+
+TYPED_TEST(AllTypeVariantTest, ResolveDataType) {
+  const auto data_type = data_type_from_type<TypeParam>();
+  EXPECT_EQ(data_type_from_string(data_type_to_string(data_type)), data_type);
+
+  auto resolved = false;
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ResolvedDataType = typename decltype(data_type_t)::type;
+    resolved = std::is_same_v<ResolvedDataType, TypeParam>;
+  });
+  EXPECT_TRUE(resolved);
+}
+
+TEST(TypeCastTest, ConvertsValues) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"-17"}), -17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"+17"}), 17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"3.7"}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"-3.7"}), -3);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"1e12"}), 1'000'000'000'000);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{42}}), 42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{2'147'483'647.9}), 2'147'483'647);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{2.5f}), 2);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{"0.1"}), 0.1f);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{"-2.5e-3"}), -2.5e-3);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{7}), 7.0);
+
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{-17}), "-17");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{3.5f}), "3.5");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1}), "0.1");
+  EXPECT_EQ(to_string(AllTypeVariant{int64_t{1} << 40}), "1099511627776");
+}
+
+TEST(TypeCastTest, RejectsValuesThatDoNotFit) {
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"abc"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{""}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"17abc"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{" 17"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"+-17"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"3000000000"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 40}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{2'147'483'648.0}), std::logic_error);
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{std::numeric_limits<double>::quiet_NaN()}), std::logic_error);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{"1e100"}), std::logic_error);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{1e100}), std::logic_error);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{-1e100}), std::logic_error);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{std::numeric_limits<double>::infinity()}),
+            std::numeric_limits<float>::infinity());
+}
+
+TEST(DataTypeTest, StringConversion) {
+  EXPECT_EQ(data_type_to_string(DataType::Int), "int");
+  EXPECT_EQ(data_type_to_string(DataType::String), "string");
+  EXPECT_EQ(data_type_from_string("long"), DataType::Long);
+  EXPECT_THROW(data_type_from_string("varchar"), std::exception);
+}
+
 }  // namespace opossum
@@ -0,0 +1,258 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/logging/write_ahead_log.hpp"
+#include "../lib/operators/delete.hpp"
+#include "../lib/operators/insert.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/pos_lists.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override { std::filesystem::remove_all(_directory); }
+
+  void TearDown() override {
+    _log.reset();
+    std::filesystem::remove_all(_directory);
+  }
+
+  static std::shared_ptr<Table> _create_table() {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    return table;
+  }
+
+  // Simulates a restart: The tables are lost and recovered from the directory.
+  void _restart(const Durability durability = Durability::Group) {
+    _log.close();
+    StorageManager::get().reset();
+    _log.reset();
+    _log.open(_directory, durability);
+  }
+
+  WriteAheadLog& _log = WriteAheadLog::get();
+  const std::filesystem::path _directory = std::filesystem::temp_directory_path() / "hyrise_write_ahead_log_test";
+};
+
+TEST_F(WriteAheadLogTest, RecoverAppendedRows) {
+  _log.open(_directory, Durability::Sync);
+  EXPECT_TRUE(_log.is_open());
+  StorageManager::get().add_table("t", _create_table());
+  auto expected_table = _create_table();
+  for (auto row = 0; row < 10; ++row) {
+    StorageManager::get().get_table("t")->append({row, std::to_string(row)});
+    expected_table->append({row, std::to_string(row)});
+  }
+  EXPECT_EQ(_log.record_count(), 11u);
+
+  _restart();
+  ASSERT_TRUE(StorageManager::get().has_table("t"));
+  const auto recovered_table = StorageManager::get().get_table("t");
+  EXPECT_TABLE_EQ(*recovered_table, *expected_table, true);
+  EXPECT_EQ(recovered_table->target_chunk_size(), 3u);
+  EXPECT_EQ(_log.replayed_record_count(), 11u);
+
+  // Recovered tables are logged, too.
+  recovered_table->append({10, "10"});
+  expected_table->append({10, "10"});
+  _restart();
+  EXPECT_TABLE_EQ(*StorageManager::get().get_table("t"), *expected_table, true);
+}
+
+TEST_F(WriteAheadLogTest, ReplayLogOverSnapshot) {
+  _log.open(_directory);
+  StorageManager::get().add_table("t", _create_table());
+  const auto table = StorageManager::get().get_table("t");
+  table->append({1, "one"});
+  table->append({2, "two"});
+  _log.checkpoint();
+
+  table->append({3, "three"});
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{4, 5}));
+  chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"four", "five"}));
+  table->emplace_chunk(std::move(chunk));
+
+  _restart();
+  const auto recovered_table = StorageManager::get().get_table("t");
+  EXPECT_EQ(recovered_table->row_count(), 5u);
+  EXPECT_EQ(recovered_table->chunk_count(), 2u);
+  EXPECT_EQ((*recovered_table->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[2], AllTypeVariant{"three"});
+  EXPECT_EQ((*recovered_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[1], AllTypeVariant{5});
+
+  // Only the records after the checkpoint were replayed.
+  EXPECT_EQ(_log.replayed_record_count(), 2u);
+}
+
+TEST_F(WriteAheadLogTest, CheckpointOnlyCommittedRows) {
+  _log.open(_directory);
+  const auto table = std::make_shared<Table>(3, UseMvcc::Yes);
+  table->add_column("a", "int");
+  StorageManager::get().add_table("t", table);
+  for (const auto value : {1, 2, 3, 4}) {
+    table->append({value});
+  }
+
+  const auto insert = [&](const std::shared_ptr<TransactionContext>& context, const int32_t value) {
+    auto values = std::make_shared<Table>();
+    values->add_column("a", "int");
+    values->append({value});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert_operator = std::make_shared<Insert>("t", table_wrapper);
+    insert_operator->set_transaction_context(context);
+    insert_operator->execute();
+  };
+
+  auto& transaction_manager = TransactionManager::get();
+  const auto committed_context = transaction_manager.new_transaction_context();
+  insert(committed_context, 5);
+  committed_context->commit();
+
+  const auto rolled_back_context = transaction_manager.new_transaction_context();
+  insert(rolled_back_context, 6);
+  rolled_back_context->rollback();
+
+  const auto running_context = transaction_manager.new_transaction_context();
+  insert(running_context, 7);
+
+  const auto delete_context = transaction_manager.new_transaction_context();
+  auto rows = std::make_shared<Table>();
+  rows->add_column_definition("a", DataType::Int);
+  auto chunk = Chunk{};
+  const auto pos_list = std::make_shared<RowIDPosList>(PosList{RowID{ChunkID{0}, 1}});
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list));
+  rows->emplace_chunk(std::move(chunk));
+  const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+  table_wrapper->execute();
+  const auto delete_operator = std::make_shared<Delete>("t", table_wrapper);
+  delete_operator->set_transaction_context(delete_context);
+  delete_operator->execute();
+  delete_context->commit();
+
+  // Recovered rows are visible to all transactions, so deleted, rolled back, and uncommitted rows must not be restored.
+  _log.checkpoint();
+  _restart();
+  const auto recovered_table = StorageManager::get().get_table("t");
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < recovered_table->chunk_count(); ++chunk_id) {
+    const auto& recovered_chunk = recovered_table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < recovered_chunk.size(); ++chunk_offset) {
+      values.emplace_back((*recovered_chunk.get_segment(ColumnID{0}))[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(values, (std::vector<AllTypeVariant>{1, 3, 4, 5}));
+  EXPECT_EQ(recovered_table->uses_mvcc(), UseMvcc::Yes);
+}
+
+TEST_F(WriteAheadLogTest, RecoverRowsOfAddedTables) {
+  _log.open(_directory);
+  StorageManager::get().add_table("t", _create_table());
+  const auto table = StorageManager::get().get_table("t");
+  for (auto row = 0; row < 5; ++row) {
+    table->append({row, std::to_string(row)});
+  }
+
+  // Tables that hold rows when they are added, such as clones, are logged with their rows.
+  StorageManager::get().clone_table("t", "clone");
+  const auto filled_table = _create_table();
+  filled_table->append({7, "seven"});
+  StorageManager::get().add_table("filled", filled_table);
+
+  _restart();
+  EXPECT_TABLE_EQ(*StorageManager::get().get_table("clone"), *table, true);
+  EXPECT_TABLE_EQ(*StorageManager::get().get_table("filled"), *filled_table, true);
+}
+
+TEST_F(WriteAheadLogTest, DropTable) {
+  _log.open(_directory);
+  StorageManager::get().add_table("t", _create_table());
+  StorageManager::get().add_table("u", _create_table());
+  StorageManager::get().get_table("t")->append({1, "one"});
+  StorageManager::get().drop_table("t");
+
+  _restart();
+  EXPECT_FALSE(StorageManager::get().has_table("t"));
+  EXPECT_TRUE(StorageManager::get().has_table("u"));
+}
+
+TEST_F(WriteAheadLogTest, IgnorePartiallyWrittenRecords) {
+  _log.open(_directory, Durability::Sync);
+  StorageManager::get().add_table("t", _create_table());
+  StorageManager::get().get_table("t")->append({1, "one"});
+  _log.close();
+
+  // A crash while the next record was written leaves only its beginning in the log.
+  {
+    auto log_file = std::ofstream{_directory / "wal.log", std::ios::binary | std::ios::app};
+    const auto partial_record = std::string{"\x20\x00\x00\x00\x03", 5};
+    log_file.write(partial_record.data(), partial_record.size());
+  }
+
+  _restart();
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 1u);
+}
+
+TEST_F(WriteAheadLogTest, GroupCommit) {
+  _log.open(_directory, Durability::Group);
+  StorageManager::get().add_table("t", _create_table());
+  const auto table = StorageManager::get().get_table("t");
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto row = 0; row < 100; ++row) {
+        table->append({thread_index, std::to_string(row)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(_log.record_count(), 401u);
+  EXPECT_LE(_log.flush_count(), 401u);
+  auto stream = std::ostringstream{};
+  _log.print(stream);
+  EXPECT_NE(stream.str().find("group"), std::string::npos);
+
+  _restart();
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 400u);
+}
+
+TEST_F(WriteAheadLogTest, AsyncDurability) {
+  _log.open(_directory, Durability::Async, std::chrono::milliseconds{1});
+  StorageManager::get().add_table("t", _create_table());
+  StorageManager::get().get_table("t")->append({1, "one"});
+
+  // Closing the log flushes the records that the flush thread did not write yet.
+  _restart(Durability::Async);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 1u);
+}
+
+TEST_F(WriteAheadLogTest, DoNotLogTablesAfterClose) {
+  _log.open(_directory);
+  StorageManager::get().add_table("t", _create_table());
+  _log.close();
+  StorageManager::get().get_table("t")->append({1, "one"});
+  EXPECT_EQ(_log.record_count(), 1u);
+  EXPECT_THROW(_log.flush(), std::exception);
+}
+
+}  // namespace opossum
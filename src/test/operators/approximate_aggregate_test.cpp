@@ -0,0 +1,134 @@
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/approximate_aggregate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsApproximateAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 100 chunks of 1'000 rows. a is the row number, b cycles through 5'000 values, c is a string.
+    _table = std::make_shared<Table>(1'000);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::Long);
+    _table->add_column("c", DataType::String);
+    _table->set_hyper_log_log_enabled(true);
+    for (auto row = 0; row < 100'000; ++row) {
+      _table->append({row, int64_t{(row * 7) % 5'000}, std::string{"s"}});
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<ApproximateAggregate> _aggregate(const ApproximateAggregateFunction aggregate_function,
+                                                   const ColumnID column_id, const SamplingOptions& sampling_options) {
+    const auto aggregate =
+        std::make_shared<ApproximateAggregate>(_table_wrapper, aggregate_function, column_id, sampling_options);
+    aggregate->execute();
+    return aggregate;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsApproximateAggregateTest, Count) {
+  const auto aggregate = _aggregate(ApproximateAggregateFunction::Count, ColumnID{0}, SamplingOptions{});
+  EXPECT_EQ(aggregate->result().estimate, 100'000.0);
+  EXPECT_EQ(aggregate->result().lower_bound, 100'000.0);
+  EXPECT_EQ(aggregate->performance_data().chunks_skipped, 100u);
+
+  const auto& output = *aggregate->get_output();
+  EXPECT_EQ(output.row_count(), 1u);
+  EXPECT_EQ(output.column_names(), (std::vector<std::string>{"estimate", "lower_bound", "upper_bound"}));
+}
+
+TEST_F(OperatorsApproximateAggregateTest, ExactWithoutSampling) {
+  const auto sampling_options = SamplingOptions{1.0, 1.0, 0.95, 42};
+  const auto sum = _aggregate(ApproximateAggregateFunction::Sum, ColumnID{0}, sampling_options);
+  EXPECT_EQ(sum->result().estimate, 99'999.0 * 100'000.0 / 2.0);
+  EXPECT_EQ(sum->result().lower_bound, sum->result().estimate);
+  EXPECT_EQ(sum->result().upper_bound, sum->result().estimate);
+  EXPECT_EQ(sum->result().sampled_row_count, 100'000u);
+  EXPECT_EQ(sum->performance_data().chunks_skipped, 0u);
+
+  const auto avg = _aggregate(ApproximateAggregateFunction::Avg, ColumnID{1}, sampling_options);
+  EXPECT_NEAR(avg->result().estimate, 2'499.5, 0.001);
+  EXPECT_NEAR(avg->result().upper_bound - avg->result().lower_bound, 0.0, 0.001);
+}
+
+TEST_F(OperatorsApproximateAggregateTest, SampledSumAndAvg) {
+  const auto exact_sum = 99'999.0 * 100'000.0 / 2.0;
+  auto covered_count = 0;
+  for (auto seed = uint32_t{0}; seed < 20; ++seed) {
+    const auto sum = _aggregate(ApproximateAggregateFunction::Sum, ColumnID{0}, SamplingOptions{0.2, 0.1, 0.95, seed});
+    const auto& result = sum->result();
+    EXPECT_EQ(result.sampled_chunk_count, 20u);
+    EXPECT_EQ(result.sampled_row_count, 2'000u);
+    EXPECT_EQ(sum->performance_data().chunks_skipped, 80u);
+    EXPECT_NEAR(result.estimate, exact_sum, exact_sum * 0.5);
+    EXPECT_LT(result.lower_bound, result.estimate);
+    covered_count += result.lower_bound <= exact_sum && exact_sum <= result.upper_bound;
+  }
+  // The 95% confidence interval should contain the exact sum in most runs.
+  EXPECT_GE(covered_count, 15);
+
+  const auto avg = _aggregate(ApproximateAggregateFunction::Avg, ColumnID{1}, SamplingOptions{0.2, 0.5, 0.99, 1});
+  EXPECT_NEAR(avg->result().estimate, 2'499.5, 100.0);
+  EXPECT_LT(avg->result().lower_bound, 2'499.5);
+  EXPECT_GT(avg->result().upper_bound, 2'499.5);
+
+  // With a single sampled chunk, the variance between the chunks is unknown.
+  const auto single_chunk =
+      _aggregate(ApproximateAggregateFunction::Sum, ColumnID{0}, SamplingOptions{0.001, 1.0, 0.95, 7});
+  EXPECT_EQ(single_chunk->result().sampled_chunk_count, 1u);
+  EXPECT_TRUE(std::isinf(single_chunk->result().upper_bound));
+}
+
+TEST_F(OperatorsApproximateAggregateTest, CountDistinct) {
+  for (auto row = 100'000; row < 100'500; ++row) {
+    _table->append({row, int64_t{(row * 7) % 5'000}, std::string{"s"}});
+  }
+
+  const auto distinct_count = _aggregate(ApproximateAggregateFunction::CountDistinct, ColumnID{1}, SamplingOptions{});
+  const auto& result = distinct_count->result();
+  EXPECT_NEAR(result.estimate, 5'000.0, 5'000.0 * 0.05);
+  EXPECT_LT(result.lower_bound, 5'000.0);
+  EXPECT_GT(result.upper_bound, 5'000.0);
+
+  // Only the last chunk is not finalized and has no sketch.
+  EXPECT_EQ(result.sampled_chunk_count, 1u);
+  EXPECT_EQ(distinct_count->performance_data().chunks_skipped, 100u);
+
+  // Results of other operators are sketched on the fly.
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10'000);
+  table_scan->execute();
+  const auto scan_distinct_count =
+      std::make_shared<ApproximateAggregate>(table_scan, ApproximateAggregateFunction::CountDistinct, ColumnID{0});
+  scan_distinct_count->execute();
+  EXPECT_NEAR(scan_distinct_count->result().estimate, 10'000.0, 10'000.0 * 0.05);
+  EXPECT_EQ(scan_distinct_count->result().sampled_row_count, 10'000u);
+}
+
+TEST_F(OperatorsApproximateAggregateTest, InvalidArguments) {
+  EXPECT_THROW(_aggregate(ApproximateAggregateFunction::Sum, ColumnID{2}, SamplingOptions{}), std::exception);
+  EXPECT_THROW(_aggregate(ApproximateAggregateFunction::Sum, ColumnID{3}, SamplingOptions{}), std::exception);
+  const auto sum = ApproximateAggregateFunction::Sum;
+  EXPECT_THROW(_aggregate(sum, ColumnID{0}, SamplingOptions{0.0, 1.0, 0.95, 7}), std::exception);
+  EXPECT_THROW(_aggregate(sum, ColumnID{0}, SamplingOptions{0.5, 1.5, 0.95, 7}), std::exception);
+
+  const auto aggregate =
+      std::make_shared<ApproximateAggregate>(_table_wrapper, ApproximateAggregateFunction::Avg, ColumnID{1});
+  EXPECT_EQ(aggregate->description(), "ApproximateAggregate (AVG(#1), 10% of chunks, 100% of rows)");
+  EXPECT_THROW(aggregate->result(), std::exception);
+}
+
+}  // namespace opossum
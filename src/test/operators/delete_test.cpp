@@ -0,0 +1,136 @@
+#include <memory>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/operators/delete.hpp"
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/insert.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/validate.hpp"
+#include "../lib/storage/pos_lists.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsDeleteTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+    _table->append({12345, 458.7f});
+    _table->append({123, 456.7f});
+    _table->append({1234, 457.7f});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // Returns an operator whose output references the given rows of the table.
+  std::shared_ptr<TableWrapper> _rows(const PosList& rows) {
+    const auto pos_list = std::make_shared<RowIDPosList>(rows);
+    auto table = std::make_shared<Table>();
+    auto chunk = Chunk{};
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      table->add_column_definition(_table->column_name(column_id), _table->column_type(column_id));
+      chunk.add_segment(std::make_shared<ReferenceSegment>(_table, column_id, pos_list));
+    }
+    table->emplace_chunk(std::move(chunk));
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Delete> _delete(const std::shared_ptr<TransactionContext>& context, const PosList& rows) {
+    const auto delete_operator = std::make_shared<Delete>("table", _rows(rows));
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    return delete_operator;
+  }
+
+  uint64_t _visible_row_count(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsDeleteTest, DeleteAndCommit) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  const auto concurrent_context = manager.new_transaction_context();
+
+  const auto delete_operator = _delete(context, {RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}});
+  EXPECT_FALSE(delete_operator->execute_failed());
+  EXPECT_EQ(_visible_row_count(context), 1u);
+  EXPECT_EQ(_visible_row_count(concurrent_context), 3u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+
+  context->commit();
+  EXPECT_EQ(_visible_row_count(concurrent_context), 3u);
+  EXPECT_EQ(_visible_row_count(manager.new_transaction_context()), 1u);
+  EXPECT_EQ(_table->row_count(), 3u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).invalid_row_count(), 1u);
+}
+
+TEST_F(OperatorsDeleteTest, Rollback) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  _delete(context, {RowID{ChunkID{0}, 0}});
+  context->rollback();
+
+  EXPECT_EQ(_visible_row_count(manager.new_transaction_context()), 3u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+}
+
+TEST_F(OperatorsDeleteTest, ConflictingDeletesFail) {
+  auto& manager = TransactionManager::get();
+  const auto first_context = manager.new_transaction_context();
+  const auto second_context = manager.new_transaction_context();
+
+  // The row is locked by the first transaction.
+  EXPECT_FALSE(_delete(first_context, {RowID{ChunkID{0}, 0}})->execute_failed());
+  EXPECT_TRUE(_delete(second_context, {RowID{ChunkID{0}, 0}})->execute_failed());
+  EXPECT_THROW(second_context->commit(), std::exception);
+  second_context->rollback();
+
+  // The row was deleted after the snapshot of the third transaction was taken.
+  const auto third_context = manager.new_transaction_context();
+  first_context->commit();
+  EXPECT_TRUE(_delete(third_context, {RowID{ChunkID{0}, 0}})->execute_failed());
+}
+
+TEST_F(OperatorsDeleteTest, DeleteOwnInsert) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+
+  auto values = std::make_shared<Table>();
+  values->add_column("a", "int");
+  values->add_column("b", "float");
+  values->append({1, 1.0f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(_visible_row_count(context), 4u);
+
+  EXPECT_FALSE(_delete(context, {RowID{ChunkID{1}, 1}})->execute_failed());
+  EXPECT_EQ(_visible_row_count(context), 3u);
+
+  context->commit();
+  EXPECT_EQ(_visible_row_count(manager.new_transaction_context()), 3u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsGetTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _test_table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("aNiceTestTable", _test_table);
+  }
+
+  std::shared_ptr<Table> _test_table;
+};
+
+TEST_F(OperatorsGetTableTest, GetOutput) {
+  auto get_table = std::make_shared<GetTable>("aNiceTestTable");
+  get_table->execute();
+
+  EXPECT_TABLE_EQ(get_table->get_output(), _test_table);
+}
+
+TEST_F(OperatorsGetTableTest, ThrowsUnknownTableName) {
+  auto get_table = std::make_shared<GetTable>("anUglyTestTable");
+
+  EXPECT_THROW(get_table->execute(), std::exception);
+}
+
+TEST_F(OperatorsGetTableTest, OperatorName) {
+  auto get_table = std::make_shared<GetTable>("aNiceTestTable");
+
+  EXPECT_EQ(get_table->name(), "GetTable");
+  EXPECT_EQ(get_table->description(), "GetTable (aNiceTestTable)");
+  EXPECT_EQ(get_table->table_name(), "aNiceTestTable");
+}
+
+TEST_F(OperatorsGetTableTest, ExecuteOnlyOnce) {
+  auto get_table = std::make_shared<GetTable>("aNiceTestTable");
+  get_table->execute();
+
+  EXPECT_THROW(get_table->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/operators/insert.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/mvcc_data.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsInsertTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _target_table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _target_table->add_column("a", "int");
+    _target_table->add_column("b", "float");
+    StorageManager::get().add_table("target", _target_table);
+
+    _values = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _values->execute();
+  }
+
+  std::shared_ptr<Table> _target_table;
+  std::shared_ptr<TableWrapper> _values;
+};
+
+TEST_F(OperatorsInsertTest, CommitPublishesRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("target", _values);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  EXPECT_EQ(_target_table->row_count(), 3u);
+  EXPECT_EQ(_target_table->chunk_count(), 2u);
+  const auto& mvcc_data = *_target_table->get_chunk(ChunkID{0}).mvcc_data();
+  EXPECT_EQ(mvcc_data.tids[0], context->transaction_id());
+  EXPECT_EQ(mvcc_data.begin_cids[0], MAX_COMMIT_ID);
+
+  context->commit();
+  EXPECT_EQ(mvcc_data.tids[0], INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data.begin_cids[0], context->commit_id());
+}
+
+TEST_F(OperatorsInsertTest, RollbackReleasesLocks) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("target", _values);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->rollback();
+
+  const auto& mvcc_data = *_target_table->get_chunk(ChunkID{1}).mvcc_data();
+  EXPECT_EQ(mvcc_data.tids[0], INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data.begin_cids[0], MAX_COMMIT_ID);
+}
+
+TEST_F(OperatorsInsertTest, RequiresTransaction) {
+  const auto insert = std::make_shared<Insert>("target", _values);
+  EXPECT_THROW(insert->execute(), std::exception);
+}
+
+TEST_F(OperatorsInsertTest, OperatorName) {
+  const auto insert = std::make_shared<Insert>("target", _values);
+  EXPECT_EQ(insert->name(), "Insert");
+  EXPECT_EQ(insert->description(), "Insert (target)");
+}
+
+}  // namespace opossum
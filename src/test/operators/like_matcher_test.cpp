@@ -0,0 +1,99 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan/like_matcher.hpp"
+
+namespace opossum {
+
+class OperatorsLikeMatcherTest : public BaseTest {};
+
+TEST_F(OperatorsLikeMatcherTest, PatternKinds) {
+  using PatternKind = LikeMatcher::PatternKind;
+  EXPECT_EQ(LikeMatcher{"abc"}.kind(), PatternKind::Exact);
+  EXPECT_EQ(LikeMatcher{""}.kind(), PatternKind::Exact);
+  EXPECT_EQ(LikeMatcher{"abc%"}.kind(), PatternKind::Prefix);
+  EXPECT_EQ(LikeMatcher{"%abc"}.kind(), PatternKind::Suffix);
+  EXPECT_EQ(LikeMatcher{"%abc%"}.kind(), PatternKind::Contains);
+  EXPECT_EQ(LikeMatcher{"%%abc%%"}.kind(), PatternKind::Contains);
+  EXPECT_EQ(LikeMatcher{"%"}.kind(), PatternKind::MatchAll);
+  EXPECT_EQ(LikeMatcher{"a_c"}.kind(), PatternKind::General);
+  EXPECT_EQ(LikeMatcher{"a%c"}.kind(), PatternKind::General);
+  EXPECT_EQ(LikeMatcher{"%a_c%"}.kind(), PatternKind::General);
+
+  EXPECT_EQ(LikeMatcher{"abc%d"}.prefix(), "abc");
+  EXPECT_EQ(LikeMatcher{"ab_c"}.prefix(), "ab");
+  EXPECT_EQ(LikeMatcher{"%abc"}.prefix(), "");
+}
+
+TEST_F(OperatorsLikeMatcherTest, Matches) {
+  const auto matches = [](const std::string& pattern, const std::string& value) { return LikeMatcher{pattern}(value); };
+
+  EXPECT_TRUE(matches("abc", "abc"));
+  EXPECT_FALSE(matches("abc", "abcd"));
+  EXPECT_TRUE(matches("", ""));
+  EXPECT_FALSE(matches("", "a"));
+
+  EXPECT_TRUE(matches("abc%", "abc"));
+  EXPECT_TRUE(matches("abc%", "abcdef"));
+  EXPECT_FALSE(matches("abc%", "xabc"));
+  EXPECT_TRUE(matches("%def", "abcdef"));
+  EXPECT_FALSE(matches("%def", "defx"));
+  EXPECT_TRUE(matches("%error%", "an error occurred"));
+  EXPECT_TRUE(matches("%error%", "error"));
+  EXPECT_FALSE(matches("%error%", "an erro occurred"));
+  EXPECT_TRUE(matches("%", ""));
+
+  EXPECT_TRUE(matches("a_c", "abc"));
+  EXPECT_FALSE(matches("a_c", "ac"));
+  EXPECT_FALSE(matches("a_c", "abbc"));
+  EXPECT_TRUE(matches("a%c", "ac"));
+  EXPECT_TRUE(matches("a%c", "abbbc"));
+  EXPECT_FALSE(matches("a%c", "abbbcd"));
+  EXPECT_FALSE(matches("ab%bc", "abc"));
+  EXPECT_TRUE(matches("ab%bc", "abbc"));
+  EXPECT_TRUE(matches("%a_c%x", "zzabcyyabdx"));
+  EXPECT_FALSE(matches("%a_c%x", "zzabdx"));
+  EXPECT_TRUE(matches("_%_", "ab"));
+  EXPECT_FALSE(matches("_%_", "a"));
+  EXPECT_TRUE(matches("%b%d%f%", "abcdef"));
+  EXPECT_FALSE(matches("%d%b%", "abcdef"));
+}
+
+TEST_F(OperatorsLikeMatcherTest, Contains) {
+  // Long values are searched in SIMD blocks, so the needle is placed at every position relative to a block, including
+  // positions where it crosses a block boundary or lies in the remainder after the last full block.
+  for (const auto& needle : std::initializer_list<std::string>{"x", "xy", "xyz", "xyzzy-xyzzy-xyzzy-xyzzy-xyzzy-xy"}) {
+    for (auto position = size_t{0}; position < 100; ++position) {
+      auto value = std::string(100 + needle.size(), 'x');
+      value.replace(position, needle.size(), needle);
+      // Near misses: the first and the last character of the needle match, but not the rest
+      for (auto near_miss = size_t{0}; near_miss + needle.size() < position; near_miss += needle.size() + 1) {
+        value[near_miss + needle.size() / 2] = '.';
+      }
+      EXPECT_TRUE(LikeMatcher::contains(value, needle)) << needle << " at " << position;
+    }
+  }
+
+  auto near_misses = std::string{};
+  for (auto repetition = 0; repetition < 50; ++repetition) {
+    near_misses += "xyz.y";
+  }
+  EXPECT_FALSE(LikeMatcher::contains(near_misses, "xyzzy"));
+  EXPECT_TRUE(LikeMatcher::contains(near_misses + "xyzzy", "xyzzy"));
+  EXPECT_FALSE(LikeMatcher::contains(std::string(200, 'a'), "ab"));
+  EXPECT_FALSE(LikeMatcher::contains("short", "longer than the value"));
+  EXPECT_TRUE(LikeMatcher::contains("anything", ""));
+}
+
+TEST_F(OperatorsLikeMatcherTest, PrefixUpperBound) {
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("abc"), "abd");
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("ab\xff"), "ac");
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("\xff\xff"), "");
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound(""), "");
+  EXPECT_LT(std::string{"ab\x7f"}, LikeMatcher::prefix_upper_bound("ab\x7f"));
+  EXPECT_LT(std::string{"ab\x7f\xff"}, LikeMatcher::prefix_upper_bound("ab\x7f"));
+}
+
+}  // namespace opossum
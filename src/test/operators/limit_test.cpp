@@ -0,0 +1,69 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", DataType::Int);
+    for (auto row = 0; row < 1'000; ++row) {
+      table->append({row});
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, StopsAfterRowCount) {
+  const auto limit = std::make_shared<Limit>(_table_wrapper, 250);
+  limit->execute();
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(output.row_count(), 250u);
+  EXPECT_EQ(output.chunk_count(), 3u);
+  EXPECT_EQ((*output.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[49], AllTypeVariant{249});
+  EXPECT_EQ(limit->performance_data().chunks_total, 10u);
+  EXPECT_EQ(limit->performance_data().chunks_skipped, 7u);
+}
+
+TEST_F(OperatorsLimitTest, RowCountExceedsInput) {
+  const auto limit = std::make_shared<Limit>(_table_wrapper, 5'000);
+  limit->execute();
+  EXPECT_EQ(limit->get_output()->row_count(), 1'000u);
+  EXPECT_EQ(limit->performance_data().chunks_skipped, 0u);
+
+  const auto empty_limit = std::make_shared<Limit>(_table_wrapper, 0);
+  empty_limit->execute();
+  EXPECT_EQ(empty_limit->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_limit->description(), "Limit (0)");
+}
+
+TEST_F(OperatorsLimitTest, LimitReferences) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 500);
+  table_scan->execute();
+  const auto top_k = std::make_shared<TopK>(table_scan, ColumnID{0}, OrderByMode::Descending, 100);
+  top_k->execute();
+  const auto limit = std::make_shared<Limit>(top_k, 2);
+  limit->execute();
+
+  const auto expected = std::make_shared<Table>();
+  expected->add_column("a", DataType::Int);
+  expected->append({999});
+  expected->append({998});
+  EXPECT_TABLE_EQ(limit->get_output(), expected, true);
+}
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/abstract_operator.hpp"
+#include "../lib/operators/operator_performance_data.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+#include "../lib/utils/performance_counters.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Passes its left input through and reports two phases and a skipped chunk.
+class PhaseReportingOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  const std::string& name() const override {
+    static const auto name = std::string{"PhaseReportingOperator"};
+    return name;
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    _performance_data.add_phase_duration("Build", std::chrono::nanoseconds{5});
+    _performance_data.add_phase_duration("Probe", std::chrono::nanoseconds{7});
+    _performance_data.add_phase_duration("Build", std::chrono::nanoseconds{3});
+    _performance_data.chunks_skipped = 1;
+    _performance_data.chunks_total = _left_input_table()->chunk_count();
+    return _left_input_table();
+  }
+};
+
+}  // namespace
+
+class OperatorPerformanceDataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { AbstractOperator::enable_hardware_counters(false); }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorPerformanceDataTest, NotExecuted) {
+  const auto table_operator = PhaseReportingOperator{_table_wrapper};
+  EXPECT_FALSE(table_operator.performance_data().executed);
+
+  auto stream = std::ostringstream{};
+  stream << table_operator.performance_data();
+  EXPECT_EQ(stream.str(), "not executed");
+}
+
+TEST_F(OperatorPerformanceDataTest, RowCountsAndPhases) {
+  auto table_operator = PhaseReportingOperator{_table_wrapper};
+  table_operator.execute();
+
+  const auto& performance_data = table_operator.performance_data();
+  EXPECT_TRUE(performance_data.executed);
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.left_input_row_count, 3u);
+  EXPECT_EQ(performance_data.right_input_row_count, 0u);
+  EXPECT_EQ(performance_data.output_row_count, 3u);
+  EXPECT_EQ(performance_data.chunks_skipped, 1u);
+  EXPECT_FALSE(performance_data.hardware_counters);
+
+  ASSERT_EQ(performance_data.phase_durations.size(), 2u);
+  EXPECT_EQ(performance_data.phase_durations[0].first, "Build");
+  EXPECT_EQ(performance_data.phase_durations[0].second, std::chrono::nanoseconds{8});
+  EXPECT_EQ(performance_data.phase_durations[1].first, "Probe");
+  EXPECT_EQ(performance_data.phase_durations[1].second, std::chrono::nanoseconds{7});
+}
+
+TEST_F(OperatorPerformanceDataTest, PrintPlan) {
+  auto table_operator = PhaseReportingOperator{_table_wrapper};
+  table_operator.execute();
+
+  auto stream = std::ostringstream{};
+  table_operator.print_plan(stream);
+  const auto plan = stream.str();
+
+  EXPECT_EQ(plan.find("[PhaseReportingOperator] "), 0u);
+  EXPECT_NE(plan.find("3 rows (3 in), 1 of 2 chunks skipped, Build: 8 ns, Probe: 7 ns"), std::string::npos);
+  EXPECT_NE(plan.find("\n  [TableWrapper] "), std::string::npos);
+}
+
+TEST_F(OperatorPerformanceDataTest, HardwareCounters) {
+  AbstractOperator::enable_hardware_counters(true);
+  EXPECT_TRUE(AbstractOperator::hardware_counters_enabled());
+
+  auto table_operator = PhaseReportingOperator{_table_wrapper};
+  table_operator.execute();
+
+  // Whether the counters can be read depends on the machine, but they are always reported if requested.
+  const auto& hardware_counters = table_operator.performance_data().hardware_counters;
+  ASSERT_TRUE(hardware_counters);
+  if (PerformanceCounters{}.available()) {
+    EXPECT_TRUE(hardware_counters->cycles || hardware_counters->instructions || hardware_counters->llc_misses ||
+                hardware_counters->branch_misses);
+  } else {
+    EXPECT_FALSE(hardware_counters->cycles);
+    EXPECT_FALSE(hardware_counters->instructions);
+  }
+
+  auto stream = std::ostringstream{};
+  stream << table_operator.performance_data();
+  EXPECT_NE(stream.str().find("cycles: "), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,156 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/approximate_aggregate.hpp"
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/result_cache.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", DataType::Int);
+    for (auto row = 0; row < 1'000; ++row) {
+      _table->append({row});
+    }
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  static std::shared_ptr<AbstractOperator> _make_plan(const int value) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    return std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, value);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsResultCacheTest, HitDoesNotExecute) {
+  auto& cache = ResultCache::get();
+  const auto first_plan = _make_plan(250);
+  const auto first_result = cache.execute(first_plan);
+  EXPECT_EQ(first_result->row_count(), 250u);
+  EXPECT_TRUE(first_plan->performance_data().executed);
+  EXPECT_EQ(cache.miss_count(), 1u);
+  EXPECT_EQ(cache.entry_count(), 1u);
+  EXPECT_GT(cache.size(), 0u);
+
+  // An identical plan built separately is answered from the cache.
+  const auto second_plan = _make_plan(250);
+  EXPECT_EQ(cache.execute(second_plan), first_result);
+  EXPECT_FALSE(second_plan->performance_data().executed);
+  EXPECT_FALSE(second_plan->left_input()->performance_data().executed);
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  // Different parameters are different plans.
+  EXPECT_EQ(cache.execute(_make_plan(100))->row_count(), 100u);
+  EXPECT_EQ(cache.miss_count(), 2u);
+  EXPECT_EQ(cache.entry_count(), 2u);
+}
+
+TEST_F(OperatorsResultCacheTest, FingerprintsAreExact) {
+  const auto table = std::make_shared<Table>(100);
+  table->add_column("a", DataType::Double);
+  table->append({1'000'000.6});
+  StorageManager::get().add_table("table_b", table);
+  const auto make_plan = [](const AllTypeVariant& value) {
+    return std::make_shared<TableScan>(std::make_shared<GetTable>("table_b"), ColumnID{0}, ScanType::OpLessThan, value);
+  };
+
+  // The descriptions of both plans are the same, as they round the values.
+  EXPECT_EQ(make_plan(1'000'000.5)->description(), make_plan(1'000'000.7)->description());
+  EXPECT_NE(ResultCache::plan_fingerprint(*make_plan(1'000'000.5)),
+            ResultCache::plan_fingerprint(*make_plan(1'000'000.7)));
+  EXPECT_NE(ResultCache::plan_fingerprint(*make_plan(5)), ResultCache::plan_fingerprint(*make_plan(5.0)));
+  EXPECT_NE(ResultCache::plan_fingerprint(*make_plan(5)), ResultCache::plan_fingerprint(*make_plan("5")));
+
+  auto& cache = ResultCache::get();
+  EXPECT_EQ(cache.execute(make_plan(1'000'000.5))->row_count(), 0u);
+  EXPECT_EQ(cache.execute(make_plan(1'000'000.7))->row_count(), 1u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, ModificationInvalidates) {
+  auto& cache = ResultCache::get();
+  EXPECT_EQ(cache.execute(_make_plan(2'000))->row_count(), 1'000u);
+
+  _table->append({5});
+  EXPECT_EQ(cache.execute(_make_plan(2'000))->row_count(), 1'001u);
+  EXPECT_EQ(cache.invalidation_count(), 1u);
+  EXPECT_EQ(cache.miss_count(), 2u);
+  EXPECT_EQ(cache.entry_count(), 1u);
+
+  // Replacing the table under the same name invalidates the entry, too.
+  StorageManager::get().drop_table("table_a");
+  const auto other_table = std::make_shared<Table>();
+  other_table->add_column("a", DataType::Int);
+  other_table->append({1});
+  StorageManager::get().add_table("table_a", other_table);
+  EXPECT_EQ(cache.execute(_make_plan(2'000))->row_count(), 1u);
+  EXPECT_EQ(cache.invalidation_count(), 2u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+}
+
+TEST_F(OperatorsResultCacheTest, UncacheablePlans) {
+  auto& cache = ResultCache::get();
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto limit = std::make_shared<Limit>(table_wrapper, 10);
+  EXPECT_EQ(cache.execute(limit)->row_count(), 10u);
+  EXPECT_FALSE(ResultCache::plan_fingerprint(*limit));
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto random_sample = std::make_shared<ApproximateAggregate>(get_table, ApproximateAggregateFunction::Sum,
+                                                                    ColumnID{0});
+  cache.execute(random_sample);
+  EXPECT_EQ(cache.entry_count(), 0u);
+  EXPECT_EQ(cache.miss_count(), 0u);
+
+  auto sampling_options = SamplingOptions{};
+  sampling_options.seed = 42;
+  const auto seeded_sample = std::make_shared<ApproximateAggregate>(
+      std::make_shared<GetTable>("table_a"), ApproximateAggregateFunction::Sum, ColumnID{0}, sampling_options);
+  cache.execute(seeded_sample);
+  EXPECT_EQ(cache.entry_count(), 1u);
+}
+
+TEST_F(OperatorsResultCacheTest, EvictsLeastRecentlyUsed) {
+  auto& cache = ResultCache::get();
+  cache.execute(_make_plan(300));
+  const auto entry_size = cache.size();
+  cache.set_capacity(entry_size * 5 / 2);
+
+  cache.execute(_make_plan(301));
+  cache.execute(_make_plan(300));
+  cache.execute(_make_plan(302));
+  EXPECT_EQ(cache.eviction_count(), 1u);
+  EXPECT_EQ(cache.entry_count(), 2u);
+  EXPECT_LE(cache.size(), cache.capacity());
+
+  // The plan with 301 was used least recently and was evicted.
+  cache.execute(_make_plan(300));
+  EXPECT_EQ(cache.hit_count(), 2u);
+  cache.execute(_make_plan(301));
+  EXPECT_EQ(cache.miss_count(), 4u);
+
+  // Results larger than the capacity are not cached.
+  cache.set_capacity(entry_size / 2);
+  EXPECT_EQ(cache.entry_count(), 0u);
+  EXPECT_EQ(cache.execute(_make_plan(300))->row_count(), 300u);
+  EXPECT_EQ(cache.entry_count(), 0u);
+
+  auto stream = std::stringstream{};
+  cache.print(stream);
+  EXPECT_NE(stream.str().find("0 results"), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,368 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/predicate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/partition_schema.hpp"
+#include "../lib/storage/pos_lists.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _int_float = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _int_float->execute();
+
+    // Spans several chunks and several batches per chunk.
+    auto table = std::make_shared<Table>(5'000);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Float);
+    table->add_column("c", DataType::String);
+    for (auto row = 0; row < 12'000; ++row) {
+      table->append({row, static_cast<float>(row % 100), std::string{row % 3 == 0 ? "x" : "z"}});
+    }
+    _large_table = std::make_shared<TableWrapper>(table);
+    _large_table->execute();
+  }
+
+  std::shared_ptr<const Table> _scan(const std::shared_ptr<const AbstractOperator>& input,
+                                     const std::shared_ptr<const Predicate>& predicate) {
+    const auto table_scan = std::make_shared<TableScan>(input, predicate);
+    table_scan->execute();
+    return table_scan->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _int_float;
+  std::shared_ptr<TableWrapper> _large_table;
+};
+
+TEST_F(OperatorsTableScanTest, SingleComparison) {
+  const auto table_scan = std::make_shared<TableScan>(_int_float, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  table_scan->execute();
+  EXPECT_TABLE_EQ(table_scan->get_output(), load_table("src/test/tables/int_float_filtered2.tbl", 1));
+
+  const auto expected = load_table("src/test/tables/int_float_filtered.tbl", 1);
+  EXPECT_TABLE_EQ(_scan(_int_float, Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 1234)), expected);
+  EXPECT_TABLE_EQ(_scan(_int_float, Predicate::between(ColumnID{1}, 457.0f, 458.0f)), expected);
+}
+
+TEST_F(OperatorsTableScanTest, AllScanTypes) {
+  const auto count = [&](const ScanType scan_type) {
+    return _scan(_large_table, Predicate::comparison(ColumnID{0}, scan_type, 6'000))->row_count();
+  };
+  EXPECT_EQ(count(ScanType::OpEquals), 1u);
+  EXPECT_EQ(count(ScanType::OpNotEquals), 11'999u);
+  EXPECT_EQ(count(ScanType::OpLessThan), 6'000u);
+  EXPECT_EQ(count(ScanType::OpLessThanEquals), 6'001u);
+  EXPECT_EQ(count(ScanType::OpGreaterThan), 5'999u);
+  EXPECT_EQ(count(ScanType::OpGreaterThanEquals), 6'000u);
+}
+
+TEST_F(OperatorsTableScanTest, CompositePredicates) {
+  // a > 5 AND b BETWEEN 10 AND 19 OR c <> 'z'
+  const auto predicate = Predicate::disjunction(
+      {Predicate::conjunction({Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 5),
+                               Predicate::between(ColumnID{1}, 10.0f, 19.0f)}),
+       Predicate::comparison(ColumnID{2}, ScanType::OpNotEquals, "z")});
+  const auto output = _scan(_large_table, predicate);
+
+  auto expected_row_count = uint64_t{0};
+  for (auto row = 0; row < 12'000; ++row) {
+    const auto b = row % 100;
+    if ((row > 5 && b >= 10 && b <= 19) || row % 3 == 0) ++expected_row_count;
+  }
+  EXPECT_EQ(output->row_count(), expected_row_count);
+
+  // The rows are returned in the order of the input.
+  auto previous_a = -1;
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto a = get<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+      const auto b = static_cast<int32_t>(get<float>((*chunk.get_segment(ColumnID{1}))[chunk_offset]));
+      EXPECT_TRUE((a > 5 && b >= 10 && b <= 19) || a % 3 == 0);
+      EXPECT_GT(a, previous_a);
+      previous_a = a;
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultShortCircuits) {
+  const auto predicate = Predicate::conjunction({Predicate::comparison(ColumnID{0}, ScanType::OpLessThan, 0),
+                                                 Predicate::comparison(ColumnID{2}, ScanType::OpEquals, "x")});
+  EXPECT_EQ(_scan(_large_table, predicate)->row_count(), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanReferences) {
+  const auto first_scan = std::make_shared<TableScan>(_large_table, ColumnID{2}, ScanType::OpEquals, "x");
+  first_scan->execute();
+
+  const auto output = _scan(first_scan, Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, 10.0f));
+  EXPECT_EQ(output->row_count(), 400u);
+
+  // The output references the original table rather than the output of the first scan.
+  const auto segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _large_table->get_output());
+}
+
+TEST_F(OperatorsTableScanTest, CompressesPositions) {
+  const auto pos_list = [](const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    return std::static_pointer_cast<const ReferenceSegment>(chunk.get_segment(ColumnID{0}))->pos_list();
+  };
+
+  // a > 1000 matches the rows [1001, 5000) of the first chunk and all rows of the others.
+  const auto ranges = _scan(_large_table, Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 1'000));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RangePosList>(pos_list(ranges, ChunkID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list(ranges, ChunkID{1})));
+
+  // Every third row
+  const auto bitmap = _scan(_large_table, Predicate::comparison(ColumnID{2}, ScanType::OpEquals, "x"));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(pos_list(bitmap, ChunkID{0})));
+
+  // One in 100 rows
+  const auto row_ids = _scan(_large_table, Predicate::comparison(ColumnID{1}, ScanType::OpEquals, 5.0f));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(pos_list(row_ids, ChunkID{0})));
+  EXPECT_EQ(row_ids->row_count(), 120u);
+
+  // Scans on compressed positions read the referenced values without expanding the positions.
+  const auto input = std::make_shared<TableWrapper>(ranges);
+  input->execute();
+  const auto output = _scan(input, Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, 10.0f));
+  EXPECT_EQ(output->row_count(), 1'099u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).get_segment(ColumnID{1})->operator[](0), AllTypeVariant{0.0f});
+
+  const auto bitmap_input = std::make_shared<TableWrapper>(bitmap);
+  bitmap_input->execute();
+  EXPECT_EQ(_scan(bitmap_input, Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, 10.0f))->row_count(), 400u);
+}
+
+TEST_F(OperatorsTableScanTest, Description) {
+  const auto predicate = Predicate::conjunction(
+      {Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 5),
+       Predicate::disjunction({Predicate::between(ColumnID{1}, 1, 3),
+                               Predicate::comparison(ColumnID{2}, ScanType::OpNotEquals, "z")})});
+  const auto table_scan = std::make_shared<TableScan>(_int_float, predicate);
+  EXPECT_EQ(table_scan->name(), "TableScan");
+  EXPECT_EQ(table_scan->description(), "TableScan (#0 > 5 AND (#1 BETWEEN 1 AND 3 OR #2 != z))");
+}
+
+TEST_F(OperatorsTableScanTest, ThrowsOnUnknownColumn) {
+  const auto table_scan = std::make_shared<TableScan>(_int_float, ColumnID{5}, ScanType::OpEquals, 1);
+  EXPECT_THROW(table_scan->execute(), std::exception);
+}
+
+TEST_F(OperatorsTableScanTest, ScanDictionarySegments) {
+  // Chunks 0 and 1 are finalized and encoded, chunk 2 still consists of value segments.
+  const auto table = std::const_pointer_cast<Table>(_large_table->get_output());
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+
+  const auto count = [&](const std::shared_ptr<const Predicate>& predicate) {
+    return _scan(_large_table, predicate)->row_count();
+  };
+  const auto compare = [&](const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) {
+    return count(Predicate::comparison(column_id, scan_type, value));
+  };
+
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpEquals, 6'000), 1u);
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpNotEquals, 6'000), 11'999u);
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpLessThan, 6'000), 6'000u);
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpLessThanEquals, 6'000), 6'001u);
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpGreaterThan, 6'000), 5'999u);
+  EXPECT_EQ(compare(ColumnID{0}, ScanType::OpGreaterThanEquals, 6'000), 6'000u);
+
+  // Values that are not part of the dictionary
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpEquals, 10.5f), 0u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpNotEquals, 10.5f), 12'000u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpLessThan, 10.5f), 1'320u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpGreaterThan, 10.5f), 10'680u);
+
+  // Values below and above all values of the dictionary, which match either all or no rows
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpLessThan, -1.0f), 0u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpGreaterThanEquals, -1.0f), 12'000u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpLessThanEquals, 99.0f), 12'000u);
+  EXPECT_EQ(compare(ColumnID{1}, ScanType::OpGreaterThan, 99.0f), 0u);
+  EXPECT_EQ(compare(ColumnID{2}, ScanType::OpNotEquals, "y"), 12'000u);
+
+  EXPECT_EQ(count(Predicate::between(ColumnID{1}, 9.5f, 19.0f)), 1'200u);
+  EXPECT_EQ(count(Predicate::between(ColumnID{1}, 19.0f, 9.5f)), 0u);
+
+  const auto predicate = Predicate::disjunction(
+      {Predicate::conjunction({Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 5),
+                               Predicate::between(ColumnID{1}, 10.0f, 19.0f)}),
+       Predicate::comparison(ColumnID{2}, ScanType::OpNotEquals, "z")});
+  auto expected_row_count = uint64_t{0};
+  for (auto row = 0; row < 12'000; ++row) {
+    const auto b = row % 100;
+    if ((row > 5 && b >= 10 && b <= 19) || row % 3 == 0) ++expected_row_count;
+  }
+  EXPECT_EQ(count(predicate), expected_row_count);
+
+  // References to dictionary segments are resolved, too.
+  const auto first_scan = std::make_shared<TableScan>(_large_table, ColumnID{2}, ScanType::OpEquals, "x");
+  first_scan->execute();
+  EXPECT_EQ(_scan(first_scan, Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, 10.0f))->row_count(), 400u);
+}
+
+TEST_F(OperatorsTableScanTest, LikePatterns) {
+  // Chunk 0 is dictionary-encoded, chunk 1 consists of value segments.
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("level", DataType::Int);
+  table->add_column("message", DataType::String);
+  const auto messages = std::vector<std::string>{"abc: connection error", "abd: ok", "xyz: error in abc", "abc"};
+  for (auto row = 0; row < 2'000; ++row) {
+    table->append({row % 5, messages[row % messages.size()] + " #" + std::to_string(row % 7)});
+  }
+  table->compress_chunk(ChunkID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto count = [&](const std::shared_ptr<const AbstractOperator>& input, const ScanType scan_type,
+                         const std::string& pattern) {
+    return _scan(input, Predicate::comparison(ColumnID{1}, scan_type, pattern))->row_count();
+  };
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "abc%"), 1'000u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpNotLike, "abc%"), 1'000u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "%error%"), 1'000u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "%#3"), 286u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "ab_: %"), 1'000u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "abc%error%"), 500u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "abc #0"), 72u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "%"), 2'000u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpNotLike, "%"), 0u);
+  EXPECT_EQ(count(table_wrapper, ScanType::OpLike, "%warning%"), 0u);
+
+  // Patterns on references
+  const auto first_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 0);
+  first_scan->execute();
+  EXPECT_EQ(count(first_scan, ScanType::OpLike, "%error%"), 200u);
+  EXPECT_EQ(count(first_scan, ScanType::OpNotLike, "%error%"), 200u);
+
+  EXPECT_EQ(Predicate::comparison(ColumnID{1}, ScanType::OpNotLike, "abc%")->description(), "#1 NOT LIKE abc%");
+  const auto int_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, "1%");
+  EXPECT_THROW(int_scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScanLZ4Segments) {
+  const auto table = std::const_pointer_cast<Table>(_large_table->get_output());
+  table->compress_cold_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+  table->compress_cold_chunk(ChunkID{1});
+
+  const auto predicate = Predicate::conjunction({Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 5),
+                                                 Predicate::between(ColumnID{1}, 10.0f, 19.0f)});
+  EXPECT_EQ(_scan(_large_table, predicate)->row_count(), 1'200u);
+
+  const auto first_scan = std::make_shared<TableScan>(_large_table, ColumnID{2}, ScanType::OpEquals, "x");
+  first_scan->execute();
+  EXPECT_EQ(_scan(first_scan, Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, 10.0f))->row_count(), 400u);
+}
+
+TEST_F(OperatorsTableScanTest, SkipChunksWithBloomFilters) {
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+  table->set_bloom_filter_false_positive_rate(0.001);
+  for (auto row = 0; row < 10'000; ++row) {
+    table->append({row * 7, std::to_string(row)});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto execute = [&](const std::shared_ptr<const Predicate>& predicate) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+    return table_scan;
+  };
+
+  // Only the chunk holding the value is scanned, except for rare false positives. The last chunk is not finalized
+  // and thus has no filters.
+  const auto equals = execute(Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 7 * 4'321));
+  EXPECT_EQ(equals->get_output()->row_count(), 1u);
+  EXPECT_EQ(equals->performance_data().chunks_total, 10u);
+  EXPECT_GE(equals->performance_data().chunks_skipped, 7u);
+
+  const auto between = execute(Predicate::between(ColumnID{1}, "4321", "4321"));
+  EXPECT_EQ(between->get_output()->row_count(), 1u);
+  EXPECT_GE(between->performance_data().chunks_skipped, 7u);
+
+  // A conjunction can skip a chunk if any child can, a disjunction only if all children can.
+  const auto conjunction = execute(Predicate::conjunction(
+      {Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 3),
+       Predicate::comparison(ColumnID{1}, ScanType::OpLessThan, "9")}));
+  EXPECT_EQ(conjunction->get_output()->row_count(), 0u);
+  EXPECT_GE(conjunction->performance_data().chunks_skipped, 8u);
+
+  const auto disjunction = execute(Predicate::disjunction(
+      {Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 0),
+       Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThan, 7 * 9'998)}));
+  EXPECT_EQ(disjunction->get_output()->row_count(), 2u);
+  EXPECT_EQ(disjunction->performance_data().chunks_skipped, 0u);
+
+  // Values that are not in the table at all skip every finalized chunk.
+  const auto missing = execute(Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 8));
+  EXPECT_EQ(missing->get_output()->row_count(), 0u);
+  EXPECT_GE(missing->performance_data().chunks_skipped, 8u);
+}
+
+TEST_F(OperatorsTableScanTest, SkipPartitions) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Int);
+  table->create_range_partitioning(ColumnID{0}, {1'000, 2'000, 3'000});
+  for (auto row = 0; row < 4'000; ++row) {
+    table->append({(row * 7) % 4'000, row});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto execute = [&](const std::shared_ptr<const Predicate>& predicate) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+    return table_scan;
+  };
+
+  // Each partition holds 1'000 rows in 10 chunks.
+  const auto less_than = execute(Predicate::comparison(ColumnID{0}, ScanType::OpLessThan, 1'500));
+  EXPECT_EQ(less_than->get_output()->row_count(), 1'500u);
+  EXPECT_EQ(less_than->performance_data().chunks_total, 40u);
+  EXPECT_EQ(less_than->performance_data().chunks_skipped, 20u);
+
+  const auto between = execute(Predicate::between(ColumnID{0}, 2'100, 2'200));
+  EXPECT_EQ(between->get_output()->row_count(), 101u);
+  EXPECT_EQ(between->performance_data().chunks_skipped, 30u);
+
+  // Predicates on other columns cannot skip partitions.
+  const auto other_column = execute(Predicate::comparison(ColumnID{1}, ScanType::OpEquals, 5));
+  EXPECT_EQ(other_column->get_output()->row_count(), 1u);
+  EXPECT_EQ(other_column->performance_data().chunks_skipped, 0u);
+
+  auto hash_table = std::make_shared<Table>(100);
+  hash_table->add_column("a", DataType::Int);
+  hash_table->create_hash_partitioning(ColumnID{0}, PartitionID{8});
+  for (auto row = 0; row < 4'000; ++row) {
+    hash_table->append({row});
+  }
+  const auto hash_table_wrapper = std::make_shared<TableWrapper>(hash_table);
+  hash_table_wrapper->execute();
+  const auto equals = std::make_shared<TableScan>(hash_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1'234);
+  equals->execute();
+  EXPECT_EQ(equals->get_output()->row_count(), 1u);
+  const auto partition_chunk_count =
+      hash_table->chunk_ids_of_partition(hash_table->partition_schema()->partition_of(1'234)).size();
+  EXPECT_EQ(equals->performance_data().chunks_skipped, hash_table->chunk_count() - partition_chunk_count);
+}
+
+}  // namespace opossum
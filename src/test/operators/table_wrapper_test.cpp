@@ -0,0 +1,28 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableWrapperTest : public BaseTest {
+ protected:
+  void SetUp() override { _test_table = load_table("src/test/tables/int_float.tbl", 2); }
+
+  std::shared_ptr<Table> _test_table;
+};
+
+TEST_F(OperatorsTableWrapperTest, GetOutput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_test_table);
+  EXPECT_EQ(table_wrapper->get_output(), nullptr);
+
+  table_wrapper->execute();
+  EXPECT_EQ(table_wrapper->get_output(), _test_table);
+  EXPECT_EQ(table_wrapper->name(), "TableWrapper");
+}
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/top_k.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The values of a are a permutation of 0..9'999, b repeats every 100 rows.
+    _table = std::make_shared<Table>(1'000);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::String);
+    for (auto row = 0; row < 10'000; ++row) {
+      _table->append({(row * 7'919) % 10'000, std::to_string(row % 100)});
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TopK> _top_k(const std::shared_ptr<const AbstractOperator>& input, const ColumnID column_id,
+                               const OrderByMode order_by_mode, const size_t k) {
+    const auto top_k = std::make_shared<TopK>(input, column_id, order_by_mode, k);
+    top_k->execute();
+    return top_k;
+  }
+
+  std::vector<AllTypeVariant> _column_values(const Table& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (chunk.column_count() == 0) continue;
+      const auto segment = chunk.get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        values.emplace_back((*segment)[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, Ascending) {
+  const auto output = _top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 100)->get_output();
+  ASSERT_EQ(output->row_count(), 100u);
+  const auto values = _column_values(*output, ColumnID{0});
+  for (auto index = 0; index < 100; ++index) {
+    EXPECT_EQ(values[index], AllTypeVariant{index});
+  }
+  const auto segment = output->get_chunk(ChunkID{0}).get_segment(ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ReferenceSegment>(segment));
+}
+
+TEST_F(OperatorsTopKTest, DescendingWithTies) {
+  // Rows with equal values keep the order of the input.
+  const auto output = _top_k(_table_wrapper, ColumnID{1}, OrderByMode::Descending, 150)->get_output();
+  ASSERT_EQ(output->row_count(), 150u);
+  const auto values = _column_values(*output, ColumnID{1});
+  const auto keys = _column_values(*output, ColumnID{0});
+  for (auto index = 0; index < 150; ++index) {
+    EXPECT_EQ(values[index], AllTypeVariant{std::string{index < 100 ? "99" : "98"}});
+  }
+  for (auto index = 0; index < 100; ++index) {
+    EXPECT_EQ(keys[index], AllTypeVariant{((index * 100 + 99) * 7'919) % 10'000});
+  }
+}
+
+TEST_F(OperatorsTopKTest, KExceedsRowCount) {
+  EXPECT_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 20'000)->get_output()->row_count(), 10'000u);
+  EXPECT_EQ(_top_k(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 0)->get_output()->row_count(), 0u);
+
+  const auto input = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  input->execute();
+  const auto output = _top_k(input, ColumnID{1}, OrderByMode::Descending, 5)->get_output();
+  EXPECT_EQ(_column_values(*output, ColumnID{0}), (std::vector<AllTypeVariant>{12345, 1234, 123}));
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksByDictionary) {
+  // Chunk i holds the values 1'000 * i to 1'000 * i + 999.
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  for (auto row = 0; row < 10'000; ++row) {
+    table->append({row});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 9; ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+  const auto input = std::make_shared<TableWrapper>(table);
+  input->execute();
+
+  // Depending on how the chunks are distributed over the threads, each thread might have to fill its heap first.
+  const auto top_k = _top_k(input, ColumnID{0}, OrderByMode::Ascending, 10);
+  EXPECT_EQ(_column_values(*top_k->get_output(), ColumnID{0}).back(), AllTypeVariant{9});
+  EXPECT_EQ(top_k->performance_data().chunks_total, 10u);
+  const auto worker_count = std::min(std::thread::hardware_concurrency(), 10u);
+  EXPECT_GE(top_k->performance_data().chunks_skipped + worker_count, 9u);
+}
+
+TEST_F(OperatorsTopKTest, ScanReferences) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, "42");
+  table_scan->execute();
+  const auto output = _top_k(table_scan, ColumnID{0}, OrderByMode::Descending, 3)->get_output();
+
+  auto expected = std::vector<int32_t>{};
+  for (auto row = 42; row < 10'000; row += 100) {
+    expected.emplace_back((row * 7'919) % 10'000);
+  }
+  std::sort(expected.rbegin(), expected.rend());
+  EXPECT_EQ(_column_values(*output, ColumnID{0}),
+            (std::vector<AllTypeVariant>{expected[0], expected[1], expected[2]}));
+
+  // The output references the table instead of the scan result.
+  const auto segment = output->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_EQ(std::dynamic_pointer_cast<const ReferenceSegment>(segment)->referenced_table(), _table);
+}
+
+TEST_F(OperatorsTopKTest, Description) {
+  const auto top_k = std::make_shared<TopK>(_table_wrapper, ColumnID{1}, OrderByMode::Descending, 10);
+  EXPECT_EQ(top_k->description(), "TopK (10 by #1 DESC)");
+  EXPECT_THROW(_top_k(_table_wrapper, ColumnID{2}, OrderByMode::Ascending, 1), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <memory>
+#include <utility>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/update.hpp"
+#include "../lib/operators/validate.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsUpdateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+    _table->append({12345, 458.7f});
+    StorageManager::get().add_table("table", _table);
+
+    _updated_values = std::make_shared<Table>();
+    _updated_values->add_column("a", "int");
+    _updated_values->add_column("b", "float");
+    _updated_values->append({1, 1.0f});
+  }
+
+  std::shared_ptr<const Table> _validate(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Update> _update(const std::shared_ptr<TransactionContext>& context) {
+    const auto rows_to_update = std::make_shared<TableWrapper>(_validate(context));
+    rows_to_update->execute();
+    const auto updated_values = std::make_shared<TableWrapper>(_updated_values);
+    updated_values->execute();
+
+    const auto update = std::make_shared<Update>("table", rows_to_update, updated_values);
+    update->set_transaction_context(context);
+    update->execute();
+    return update;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _updated_values;
+};
+
+TEST_F(OperatorsUpdateTest, ReplacesRows) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  EXPECT_FALSE(_update(context)->execute_failed());
+  context->commit();
+
+  const auto output = _validate(manager.new_transaction_context());
+  EXPECT_TABLE_EQ(output, _updated_values);
+  EXPECT_EQ(_table->row_count(), 2u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 1u);
+}
+
+TEST_F(OperatorsUpdateTest, UpdateTwiceInOneTransaction) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  EXPECT_FALSE(_update(context)->execute_failed());
+  EXPECT_FALSE(_update(context)->execute_failed());
+  EXPECT_EQ(_validate(context)->row_count(), 1u);
+  context->commit();
+
+  EXPECT_TABLE_EQ(_validate(manager.new_transaction_context()), _updated_values);
+  EXPECT_EQ(_table->approx_valid_row_count(), 1u);
+}
+
+TEST_F(OperatorsUpdateTest, ConcurrentUpdateFails) {
+  auto& manager = TransactionManager::get();
+  const auto first_context = manager.new_transaction_context();
+  const auto second_context = manager.new_transaction_context();
+
+  EXPECT_FALSE(_update(first_context)->execute_failed());
+  EXPECT_TRUE(_update(second_context)->execute_failed());
+  second_context->rollback();
+  first_context->commit();
+
+  EXPECT_TABLE_EQ(_validate(manager.new_transaction_context()), _updated_values);
+}
+
+}  // namespace opossum
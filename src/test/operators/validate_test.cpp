@@ -0,0 +1,131 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/insert.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/validate.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsValidateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+    _table->append({12345, 458.7f});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  void _insert(const std::shared_ptr<TransactionContext>& context, const std::shared_ptr<const Table>& values) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>("table", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+  }
+
+  std::shared_ptr<const Table> _validate(const std::shared_ptr<TransactionContext>& context,
+                                         const std::shared_ptr<const AbstractOperator>& input = nullptr) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(input ? input : get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsValidateTest, Visibility) {
+  auto& manager = TransactionManager::get();
+  const auto inserting_context = manager.new_transaction_context();
+  const auto concurrent_context = manager.new_transaction_context();
+  _insert(inserting_context, load_table("src/test/tables/int_float.tbl", 2));
+
+  // Uncommitted rows are only visible to the inserting transaction.
+  EXPECT_EQ(_validate(inserting_context)->row_count(), 4u);
+  EXPECT_EQ(_validate(concurrent_context)->row_count(), 1u);
+
+  inserting_context->commit();
+
+  // Transactions that started before the commit keep their snapshot.
+  EXPECT_EQ(_validate(concurrent_context)->row_count(), 1u);
+  EXPECT_EQ(_validate(manager.new_transaction_context())->row_count(), 4u);
+}
+
+TEST_F(OperatorsValidateTest, RolledBackRowsAreInvisible) {
+  auto& manager = TransactionManager::get();
+  {
+    const auto context = manager.new_transaction_context();
+    _insert(context, load_table("src/test/tables/int_float.tbl", 2));
+    // The context rolls back when it goes out of scope.
+  }
+  const auto output = _validate(manager.new_transaction_context());
+  EXPECT_EQ(output->row_count(), 1u);
+  EXPECT_EQ((*output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[0], AllTypeVariant{12345});
+}
+
+TEST_F(OperatorsValidateTest, ValidatesReferences) {
+  auto& manager = TransactionManager::get();
+  const auto context = manager.new_transaction_context();
+  _insert(context, load_table("src/test/tables/int_float.tbl", 2));
+
+  const auto own_rows = std::make_shared<TableWrapper>(_validate(context));
+  own_rows->execute();
+  EXPECT_EQ(_validate(context, own_rows)->row_count(), 4u);
+  EXPECT_EQ(_validate(manager.new_transaction_context(), own_rows)->row_count(), 1u);
+}
+
+TEST_F(OperatorsValidateTest, IsRowVisible) {
+  // Own uncommitted insert
+  EXPECT_TRUE(Validate::is_row_visible(2, 1, 2, MAX_COMMIT_ID, MAX_COMMIT_ID));
+  // Other transaction's uncommitted insert
+  EXPECT_FALSE(Validate::is_row_visible(2, 1, 3, MAX_COMMIT_ID, MAX_COMMIT_ID));
+  // Committed before and after the snapshot
+  EXPECT_TRUE(Validate::is_row_visible(2, 1, INVALID_TRANSACTION_ID, 1, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(2, 1, INVALID_TRANSACTION_ID, 2, MAX_COMMIT_ID));
+  // Deleted before and after the snapshot
+  EXPECT_FALSE(Validate::is_row_visible(2, 2, INVALID_TRANSACTION_ID, 1, 2));
+  EXPECT_TRUE(Validate::is_row_visible(2, 2, INVALID_TRANSACTION_ID, 1, 3));
+}
+
+TEST_F(OperatorsValidateTest, ConcurrentInsertsDoNotBlockReads) {
+  constexpr auto inserted_rows = 200;
+  auto inserting_done = std::atomic_bool{false};
+
+  auto writer = std::thread{[&]() {
+    auto values = std::make_shared<Table>();
+    values->add_column("a", "int");
+    values->add_column("b", "float");
+    values->append({1, 1.0f});
+    for (auto row = 0; row < inserted_rows; ++row) {
+      const auto context = TransactionManager::get().new_transaction_context();
+      _insert(context, values);
+      context->commit();
+    }
+    inserting_done = true;
+  }};
+
+  // Every snapshot sees exactly the rows of the transactions committed before it started.
+  while (!inserting_done) {
+    const auto context = TransactionManager::get().new_transaction_context();
+    EXPECT_EQ(_validate(context)->row_count(), context->snapshot_commit_id() + 1);
+  }
+  writer.join();
+
+  EXPECT_EQ(_validate(TransactionManager::get().new_transaction_context())->row_count(), inserted_rows + 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/limit.hpp"
+#include "../lib/operators/predicate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/server/client.hpp"
+#include "../lib/server/server.hpp"
+#include "../lib/server/wire_protocol.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class ServerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::String);
+    for (auto row = 0; row < 250; ++row) {
+      _table->append({row, "value " + std::to_string(row % 10)});
+    }
+    _table->compress_chunk(ChunkID{0});
+    StorageManager::get().add_table("table_a", _table);
+
+    _server = std::make_unique<Server>(_socket_path, 4);
+    _server->start();
+  }
+
+  void TearDown() override { _server.reset(); }
+
+  const std::filesystem::path _socket_path = std::filesystem::temp_directory_path() / "hyrise_server_test.sock";
+  std::shared_ptr<Table> _table;
+  std::unique_ptr<Server> _server;
+};
+
+TEST_F(ServerTest, StreamsChunks) {
+  auto client = Client{_socket_path};
+  auto chunk_sizes = std::vector<ChunkOffset>{};
+  const auto schema = client.query(QueryRequest{"table_a", nullptr, std::nullopt}, [&](const Table&, Chunk&& chunk) {
+    chunk_sizes.emplace_back(chunk.size());
+  });
+  EXPECT_EQ(chunk_sizes, (std::vector<ChunkOffset>{100, 100, 50}));
+  EXPECT_EQ(schema->column_names(), (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(schema->column_type(ColumnID{1}), DataType::String);
+  EXPECT_EQ(schema->row_count(), 0u);
+
+  EXPECT_TABLE_EQ(client.query(QueryRequest{"table_a", nullptr, std::nullopt}), _table, true);
+  EXPECT_TRUE(_server->is_running());
+  EXPECT_TRUE(std::filesystem::is_socket(_socket_path));
+}
+
+TEST_F(ServerTest, ScanAndLimit) {
+  const auto predicate = Predicate::conjunction(
+      {Predicate::comparison(ColumnID{0}, ScanType::OpGreaterThanEquals, 50),
+       Predicate::disjunction({Predicate::comparison(ColumnID{1}, ScanType::OpEquals, "value 3"),
+                               Predicate::between(ColumnID{0}, 200, 210)})});
+  const auto request = QueryRequest{"table_a", predicate, uint64_t{30}};
+  EXPECT_EQ(deserialize_query(serialize_query(request)).predicate->description(), predicate->description());
+
+  auto client = Client{_socket_path};
+  const auto result = client.query(request);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto table_scan = std::make_shared<TableScan>(get_table, predicate);
+  table_scan->execute();
+  const auto limit = std::make_shared<Limit>(table_scan, 30);
+  limit->execute();
+  EXPECT_EQ(result->row_count(), 30u);
+  EXPECT_TABLE_EQ(result, limit->get_output(), true);
+
+  EXPECT_EQ(client.query(QueryRequest{"table_a", predicate, uint64_t{0}})->row_count(), 0u);
+}
+
+TEST_F(ServerTest, ErrorKeepsConnectionUsable) {
+  auto client = Client{_socket_path};
+  EXPECT_THROW(client.query(QueryRequest{"table_b", nullptr, std::nullopt}), std::logic_error);
+  EXPECT_THROW(client.query(QueryRequest{"table_a", Predicate::comparison(ColumnID{5}, ScanType::OpEquals, 1),
+                                         std::nullopt}),
+               std::logic_error);
+  EXPECT_EQ(client.query(QueryRequest{"table_a", nullptr, uint64_t{10}})->row_count(), 10u);
+  EXPECT_EQ(_server->query_count(), 3u);
+}
+
+TEST_F(ServerTest, RejectMalformedQueries) {
+  const auto predicate = Predicate::disjunction(
+      {Predicate::comparison(ColumnID{1}, ScanType::OpLike, "value%"), Predicate::between(ColumnID{0}, 3, 7.5)});
+  const auto payload = serialize_query(QueryRequest{"table_a", predicate, uint64_t{10}});
+  EXPECT_EQ(deserialize_query(payload).predicate->description(), predicate->description());
+
+  // Frames that end early are rejected, wherever they are cut off.
+  for (auto size = size_t{0}; size < payload.size(); ++size) {
+    EXPECT_THROW(deserialize_query(payload.substr(0, size)), std::logic_error);
+  }
+
+  // A string cannot be longer than the rest of the frame.
+  auto oversized_string = payload;
+  oversized_string[3] = '\x7F';
+  EXPECT_THROW(deserialize_query(oversized_string), std::logic_error);
+
+  auto nested_predicate = Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 1);
+  for (auto depth = uint32_t{1}; depth < MAX_PREDICATE_DEPTH; ++depth) {
+    nested_predicate = Predicate::conjunction({nested_predicate});
+  }
+  EXPECT_NO_THROW(deserialize_query(serialize_query(QueryRequest{"table_a", nested_predicate, std::nullopt})));
+  nested_predicate = Predicate::conjunction({nested_predicate});
+  EXPECT_THROW(deserialize_query(serialize_query(QueryRequest{"table_a", nested_predicate, std::nullopt})),
+               std::logic_error);
+
+  const auto children = std::vector<std::shared_ptr<const Predicate>>(
+      MAX_PREDICATE_CHILD_COUNT + 1, Predicate::comparison(ColumnID{0}, ScanType::OpEquals, 1));
+  EXPECT_THROW(
+      deserialize_query(serialize_query(QueryRequest{"table_a", Predicate::disjunction(children), std::nullopt})),
+      std::logic_error);
+}
+
+TEST_F(ServerTest, ConcurrentClients) {
+  constexpr auto client_count = 8;
+  constexpr auto queries_per_client = 20;
+  auto failed_query_count = std::atomic<int>{0};
+  auto threads = std::vector<std::thread>{};
+  for (auto client_index = 0; client_index < client_count; ++client_index) {
+    threads.emplace_back([&, client_index]() {
+      auto client = Client{_socket_path};
+      for (auto query_index = 0; query_index < queries_per_client; ++query_index) {
+        const auto value = client_index * queries_per_client + query_index;
+        const auto result = client.query(
+            QueryRequest{"table_a", Predicate::comparison(ColumnID{0}, ScanType::OpLessThan, value), std::nullopt});
+        if (result->row_count() != static_cast<uint64_t>(std::min(value, 250))) ++failed_query_count;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(failed_query_count, 0);
+  EXPECT_EQ(_server->query_count(), static_cast<uint64_t>(client_count * queries_per_client));
+  EXPECT_EQ(_server->connection_count(), static_cast<uint64_t>(client_count));
+}
+
+TEST_F(ServerTest, Stop) {
+  auto client = Client{_socket_path};
+  EXPECT_EQ(client.query(QueryRequest{"table_a", nullptr, std::nullopt})->row_count(), 250u);
+
+  _server->stop();
+  EXPECT_FALSE(_server->is_running());
+  EXPECT_FALSE(std::filesystem::exists(_socket_path));
+  EXPECT_THROW(client.query(QueryRequest{"table_a", nullptr, std::nullopt}), std::logic_error);
+  EXPECT_THROW(Client{_socket_path}, std::logic_error);
+
+  // The server can be started again.
+  _server->start();
+  EXPECT_EQ(Client{_socket_path}.query(QueryRequest{"table_a", nullptr, uint64_t{5}})->row_count(), 5u);
+}
+
+}  // namespace opossum
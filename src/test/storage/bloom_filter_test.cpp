@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BlockedBloomFilter{10'000, 0.01};
+  for (auto value = 0; value < 10'000; ++value) {
+    bloom_filter.insert(value_hash(value));
+  }
+  for (auto value = 0; value < 10'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(value_hash(value)));
+  }
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  for (const auto false_positive_rate : {0.1, 0.01, 0.001}) {
+    auto bloom_filter = BlockedBloomFilter{20'000, false_positive_rate};
+    for (auto value = 0; value < 20'000; ++value) {
+      bloom_filter.insert(value_hash(value));
+    }
+
+    auto false_positive_count = 0;
+    const auto probe_count = 200'000;
+    for (auto value = 20'000; value < 20'000 + probe_count; ++value) {
+      false_positive_count += bloom_filter.may_contain(value_hash(value));
+    }
+    EXPECT_LT(static_cast<double>(false_positive_count) / probe_count, false_positive_rate * 1.2);
+  }
+}
+
+TEST_F(StorageBloomFilterTest, Sizing) {
+  const auto small = BlockedBloomFilter{1'000, 0.1};
+  const auto large = BlockedBloomFilter{1'000, 0.001};
+  EXPECT_LT(small.memory_usage(), large.memory_usage());
+  EXPECT_LT(small.hash_function_count(), large.hash_function_count());
+  EXPECT_EQ(BlockedBloomFilter(0, 0.01).hash_function_count(), 7u);
+
+  EXPECT_THROW(BlockedBloomFilter(10, 0.0), std::exception);
+  EXPECT_THROW(BlockedBloomFilter(10, 1.0), std::exception);
+}
+
+TEST_F(StorageBloomFilterTest, BuiltForFinalizedChunks) {
+  auto table = Table{3};
+  table.add_column("a", DataType::Int);
+  table.add_column("b", DataType::String);
+  table.append({1, "one"});
+  table.set_bloom_filter_false_positive_rate(0.01);
+  EXPECT_EQ(table.bloom_filter_false_positive_rate(), 0.01);
+  for (auto value = 2; value <= 7; ++value) {
+    table.append({value, std::to_string(value)});
+  }
+
+  ASSERT_EQ(table.chunk_count(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    ASSERT_TRUE(chunk.bloom_filter(ColumnID{0}));
+    ASSERT_TRUE(chunk.bloom_filter(ColumnID{1}));
+  }
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).bloom_filter(ColumnID{0})->may_contain(value_hash(int32_t{1})));
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).bloom_filter(ColumnID{1})->may_contain(value_hash(std::string{"3"})));
+  EXPECT_TRUE(table.get_chunk(ChunkID{1}).bloom_filter(ColumnID{0})->may_contain(value_hash(int32_t{5})));
+  EXPECT_FALSE(table.get_chunk(ChunkID{2}).bloom_filter(ColumnID{0}));
+
+  // The filters survive encoding.
+  table.compress_chunk(ChunkID{0});
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).bloom_filter(ColumnID{0}));
+
+  table.set_bloom_filter_false_positive_rate(std::nullopt);
+  table.append({8, "8"});
+  table.append({9, "9"});
+  EXPECT_FALSE(table.get_chunk(ChunkID{2}).bloom_filter(ColumnID{0}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,148 @@
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _buffer_manager.set_memory_budget(size_t{1} << 40);
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 1'000; ++row) {
+      _table->append({row, "value_" + std::to_string(row)});
+    }
+  }
+
+  BufferManager& _buffer_manager = BufferManager::get();
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageBufferManagerTest, ManageFinalizedChunks) {
+  EXPECT_TRUE(_buffer_manager.is_enabled());
+  EXPECT_EQ(_buffer_manager.managed_chunk_count(), 10u);
+  EXPECT_EQ(_buffer_manager.resident_chunk_count(), 10u);
+  EXPECT_EQ(_buffer_manager.eviction_count(), 0u);
+  EXPECT_GT(_buffer_manager.resident_memory_usage(), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}).is_buffer_managed());
+
+  // The open chunk at the end is not managed.
+  _table->append({1'000, "value_1000"});
+  EXPECT_FALSE(_table->get_chunk(ChunkID{10}).is_buffer_managed());
+
+  // Destroying the table stops managing its chunks.
+  _table.reset();
+  EXPECT_EQ(_buffer_manager.managed_chunk_count(), 0u);
+  EXPECT_EQ(_buffer_manager.resident_memory_usage(), 0u);
+}
+
+TEST_F(StorageBufferManagerTest, EvictAndReload) {
+  const auto memory_usage = _buffer_manager.resident_memory_usage();
+  _buffer_manager.set_memory_budget(memory_usage / 4);
+  EXPECT_LE(_buffer_manager.resident_memory_usage(), memory_usage / 4);
+  EXPECT_GE(_buffer_manager.eviction_count(), 7u);
+  EXPECT_EQ(_table->row_count(), 1'000u);
+
+  // Evicted chunks are reloaded transparently.
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto& chunk = _table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto row = static_cast<int32_t>(chunk_id * 100 + chunk_offset);
+      EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{row});
+      EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{"value_" + std::to_string(row)});
+    }
+  }
+  EXPECT_GT(_buffer_manager.reload_count(), 0u);
+  EXPECT_LE(_buffer_manager.resident_memory_usage(), memory_usage / 4);
+
+  auto stream = std::ostringstream{};
+  _buffer_manager.print(stream);
+  EXPECT_NE(stream.str().find("evictions"), std::string::npos);
+}
+
+TEST_F(StorageBufferManagerTest, DoNotEvictPinnedChunks) {
+  const auto pinned_segment = _table->get_chunk(ChunkID{3}).get_segment(ColumnID{1});
+  _buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(_buffer_manager.resident_chunk_count(), 1u);
+  EXPECT_EQ(_buffer_manager.eviction_count(), 9u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3}).get_segment(ColumnID{1}), pinned_segment);
+  EXPECT_EQ(_buffer_manager.reload_count(), 0u);
+}
+
+TEST_F(StorageBufferManagerTest, ReloadRemovedChunksWhileTheyAreRead) {
+  _buffer_manager.set_memory_budget(0);
+  auto chunk = _table->get_chunk_ptr(ChunkID{2});
+  chunk->increase_invalid_row_count(100);
+  _table->remove_chunk(ChunkID{2});
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2}).is_buffer_managed());
+
+  // The reader that still holds the removed chunk can reload it.
+  const auto segment = chunk->get_segment(ColumnID{1});
+  ASSERT_TRUE(segment);
+  EXPECT_EQ((*segment)[7], AllTypeVariant{"value_207"});
+  EXPECT_EQ(_buffer_manager.managed_chunk_count(), 10u);
+
+  chunk.reset();
+  EXPECT_EQ(_buffer_manager.managed_chunk_count(), 9u);
+}
+
+TEST_F(StorageBufferManagerTest, AccountForReplacedSegments) {
+  // Repeated values take less memory once they are encoded.
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = 0; row < 200; ++row) {
+    table->append({row % 2, std::string(20, 'x')});
+  }
+  const auto memory_usage = _buffer_manager.resident_memory_usage();
+  table->compress_chunk(ChunkID{0});
+  const auto dictionary_memory_usage = _buffer_manager.resident_memory_usage();
+  EXPECT_LT(dictionary_memory_usage, memory_usage);
+  table->compress_cold_chunk(ChunkID{1});
+  EXPECT_LT(_buffer_manager.resident_memory_usage(), dictionary_memory_usage);
+
+  // The memory usage of the encoded segments is released with their chunks.
+  table.reset();
+  _table.reset();
+  EXPECT_EQ(_buffer_manager.resident_memory_usage(), 0u);
+}
+
+TEST_F(StorageBufferManagerTest, RestoreEncodings) {
+  _table->compress_chunk(ChunkID{2});
+  _buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(_buffer_manager.resident_chunk_count(), 0u);
+
+  const auto segment = _table->get_chunk(ChunkID{2}).get_segment(ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(segment));
+  EXPECT_EQ((*segment)[5], AllTypeVariant{std::string{"value_205"}});
+  EXPECT_EQ(_buffer_manager.reload_count(), 1u);
+}
+
+TEST_F(StorageBufferManagerTest, SpillFiles) {
+  const auto spill_directory = std::filesystem::temp_directory_path() / "hyrise_buffer_manager_test";
+  _buffer_manager.set_spill_directory(spill_directory);
+  _buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator{spill_directory}, {}), 10);
+
+  // Evicting a chunk again does not write it again, and files are removed once the chunks are no longer managed.
+  _table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  _buffer_manager.set_memory_budget(0);
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator{spill_directory}, {}), 10);
+
+  _table.reset();
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator{spill_directory}, {}), 0);
+  std::filesystem::remove_all(spill_directory);
+}
+
+}  // namespace opossum
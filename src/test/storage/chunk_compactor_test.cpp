@@ -0,0 +1,249 @@
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/concurrency/transaction_context.hpp"
+#include "../lib/concurrency/transaction_manager.hpp"
+#include "../lib/operators/delete.hpp"
+#include "../lib/operators/get_table.hpp"
+#include "../lib/operators/insert.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/operators/validate.hpp"
+#include "../lib/storage/chunk_compactor.hpp"
+#include "../lib/storage/mvcc_data.hpp"
+#include "../lib/storage/pos_lists.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageChunkCompactorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    for (auto value = 0; value < 8; ++value) {
+      _table->append({value});
+    }
+    StorageManager::get().add_table("table", _table);
+  }
+
+  void _delete_rows(const PosList& rows) {
+    const auto pos_list = std::make_shared<RowIDPosList>(rows);
+    auto table = std::make_shared<Table>();
+    table->add_column_definition("a", DataType::Int);
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+    table->emplace_chunk(std::move(chunk));
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto delete_operator = std::make_shared<Delete>("table", table_wrapper);
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    context->commit();
+  }
+
+  std::shared_ptr<const Table> _validate(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageChunkCompactorTest, MovesValidRowsAndRemovesChunk) {
+  _delete_rows({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (const auto value : {3, 5, 6, 7}) {
+    expected->append({value});
+  }
+
+  // A transaction that started before the compaction still sees the old rows.
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  auto compactor = ChunkCompactor{0.5};
+  EXPECT_EQ(compactor.run_once(), 1u);
+  EXPECT_NE(_table->get_chunk(ChunkID{0}).cleanup_commit_id(), MAX_COMMIT_ID);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1}).cleanup_commit_id(), MAX_COMMIT_ID);
+  EXPECT_EQ(_table->approx_valid_row_count(), 4u);
+  EXPECT_TABLE_EQ(_validate(TransactionManager::get().new_transaction_context()), expected);
+
+  // The chunk's data is only released once no transaction can see it anymore.
+  compactor.run_once();
+  EXPECT_EQ(compactor.removed_chunk_count(), 0u);
+  EXPECT_TABLE_EQ(_validate(old_context), expected);
+  old_context.reset();
+
+  compactor.run_once();
+  EXPECT_EQ(compactor.removed_chunk_count(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).size(), 0u);
+  EXPECT_EQ(_table->row_count(), 5u);
+  EXPECT_TABLE_EQ(_validate(TransactionManager::get().new_transaction_context()), expected);
+}
+
+TEST_F(StorageChunkCompactorTest, ValidatesReferencesToRemovedChunks) {
+  // The scan references the rows of the chunk before it is compacted and removed.
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  const auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  table_scan->execute();
+
+  _delete_rows({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}});
+  auto compactor = ChunkCompactor{0.5};
+  EXPECT_EQ(compactor.run_once(), 1u);
+  compactor.run_once();
+  ASSERT_EQ(compactor.removed_chunk_count(), 1u);
+
+  // The moved row is not part of the scan's result, and the rows of the removed chunk are not visible anymore.
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  for (const auto value : {5, 6, 7}) {
+    expected->append({value});
+  }
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ(validate->get_output(), expected);
+
+  // Deleting them conflicts with the transaction that deleted them before.
+  const auto delete_operator = std::make_shared<Delete>("table", table_scan);
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+  EXPECT_TRUE(delete_operator->execute_failed());
+  context->rollback();
+}
+
+TEST_F(StorageChunkCompactorTest, RespectsThreshold) {
+  _delete_rows({RowID{ChunkID{0}, 0}});
+
+  auto compactor = ChunkCompactor{0.5};
+  EXPECT_EQ(compactor.run_once(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).cleanup_commit_id(), MAX_COMMIT_ID);
+}
+
+TEST_F(StorageChunkCompactorTest, SkipsLockedChunks) {
+  _delete_rows({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}});
+
+  // A running transaction locks a row of the chunk.
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto pos_list = std::make_shared<RowIDPosList>(PosList{RowID{ChunkID{0}, 3}});
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", DataType::Int);
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+  table->emplace_chunk(std::move(chunk));
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto delete_operator = std::make_shared<Delete>("table", table_wrapper);
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+
+  auto compactor = ChunkCompactor{0.5};
+  EXPECT_EQ(compactor.run_once(), 0u);
+  context->rollback();
+  EXPECT_EQ(compactor.run_once(), 1u);
+}
+
+TEST_F(StorageChunkCompactorTest, SkipsChunksWithCommitsInProgress) {
+  _delete_rows({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}});
+
+  // Insert's commit sets the begin commit ID and unlocks the row before the commit ID is published.
+  auto& begin_commit_id = _table->get_chunk(ChunkID{0}).mvcc_data()->begin_cids[3];
+  const auto committed_begin_commit_id = begin_commit_id.load();
+  begin_commit_id = TransactionManager::get().last_commit_id() + 1;
+
+  auto compactor = ChunkCompactor{0.5};
+  EXPECT_EQ(compactor.run_once(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).cleanup_commit_id(), MAX_COMMIT_ID);
+
+  begin_commit_id = committed_begin_commit_id;
+  EXPECT_EQ(compactor.run_once(), 1u);
+}
+
+TEST_F(StorageChunkCompactorTest, RunsInBackground) {
+  _delete_rows({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 3}});
+
+  auto compactor = ChunkCompactor{};
+  compactor.start(std::chrono::milliseconds{1});
+  for (auto attempt = 0; attempt < 1'000 && compactor.removed_chunk_count() == 0; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  compactor.stop();
+
+  EXPECT_EQ(compactor.removed_chunk_count(), 1u);
+  EXPECT_EQ(_table->row_count(), 4u);
+}
+
+TEST_F(StorageChunkCompactorTest, KeepsRowsOfConcurrentInserts) {
+  // Rolled back inserts leave invalid rows behind, so the compactor keeps moving rows of chunks that concurrent
+  // inserts just committed to.
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto INSERTS_PER_THREAD = 500;
+  auto committed_count = std::atomic<size_t>{0};
+  auto inserters = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < THREAD_COUNT; ++thread_index) {
+    inserters.emplace_back([&, thread_index]() {
+      auto values = std::make_shared<Table>();
+      values->add_column("a", "int");
+      values->append({thread_index});
+      const auto table_wrapper = std::make_shared<TableWrapper>(values);
+      table_wrapper->execute();
+
+      for (auto insert_index = 0; insert_index < INSERTS_PER_THREAD; ++insert_index) {
+        const auto context = TransactionManager::get().new_transaction_context();
+        const auto insert = std::make_shared<Insert>("table", table_wrapper);
+        insert->set_transaction_context(context);
+        insert->execute();
+        if (insert_index % 2 == 0) {
+          context->commit();
+          ++committed_count;
+        } else {
+          context->rollback();
+        }
+      }
+    });
+  }
+
+  auto inserters_done = std::atomic_bool{false};
+  auto compactor_exception = std::exception_ptr{};
+  auto compactor_thread = std::thread{[&]() {
+    auto compactor = ChunkCompactor{0.25};
+    try {
+      while (!inserters_done) {
+        compactor.run_once();
+      }
+      compactor.run_once();
+      compactor.run_once();
+    } catch (...) {
+      compactor_exception = std::current_exception();
+    }
+  }};
+
+  for (auto& inserter : inserters) {
+    inserter.join();
+  }
+  inserters_done = true;
+  compactor_thread.join();
+
+  ASSERT_FALSE(compactor_exception);
+  EXPECT_EQ(_validate(TransactionManager::get().new_transaction_context())->row_count(), 8 + committed_count);
+}
+
+}  // namespace opossum
@@ -55,6 +55,36 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, Finalize) {
+  auto values = std::vector<int32_t>{1, 2, 3};
+  values.reserve(100);
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  c.add_segment(value_segment);
+  EXPECT_FALSE(c.is_finalized());
+  EXPECT_GE(value_segment->values().capacity(), 100u);
+
+  c.finalize();
+  EXPECT_TRUE(c.is_finalized());
+  EXPECT_EQ(value_segment->values().capacity(), 3u);
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_THROW(c.finalize(), std::exception);
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(c.append({4}), std::exception);
+    EXPECT_THROW(c.add_segment(int_value_segment), std::exception);
+    EXPECT_EQ(c.size(), 3u);
+  }
+}
+
+TEST_F(StorageChunkTest, MoveKeepsFinalization) {
+  c.add_segment(int_value_segment);
+  c.finalize();
+
+  const auto moved_chunk = Chunk{std::move(c)};
+  EXPECT_TRUE(moved_chunk.is_finalized());
+  EXPECT_EQ(moved_chunk.size(), 3u);
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   c.add_segment(int_value_segment);
   c.add_segment(string_value_segment);
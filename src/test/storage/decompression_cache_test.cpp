@@ -0,0 +1,88 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/decompression_cache.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDecompressionCacheTest : public BaseTest {
+ protected:
+  // Returns a function that creates a segment of the given number of ints and counts how often it was called.
+  std::function<std::shared_ptr<const BaseSegment>()> _decompress(const size_t value_count) {
+    return [&, value_count]() {
+      ++_decompress_count;
+      return std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>(value_count));
+    };
+  }
+
+  DecompressionCache& _cache = DecompressionCache::get();
+  size_t _decompress_count = 0;
+};
+
+TEST_F(StorageDecompressionCacheTest, HitsAndMisses) {
+  const auto segment = _cache.get_or_decompress(1, _decompress(10));
+  EXPECT_EQ(segment->size(), 10u);
+  EXPECT_EQ(_cache.get_or_decompress(1, _decompress(10)), segment);
+
+  EXPECT_EQ(_decompress_count, 1u);
+  EXPECT_EQ(_cache.hit_count(), 1u);
+  EXPECT_EQ(_cache.miss_count(), 1u);
+  EXPECT_EQ(_cache.size(), 40u);
+}
+
+TEST_F(StorageDecompressionCacheTest, EvictLeastRecentlyUsed) {
+  _cache.set_capacity(100);
+  _cache.get_or_decompress(1, _decompress(10));
+  _cache.get_or_decompress(2, _decompress(10));
+
+  // Accessing the first segment makes the second one the least recently used.
+  _cache.get_or_decompress(1, _decompress(10));
+  _cache.get_or_decompress(3, _decompress(10));
+  EXPECT_EQ(_cache.eviction_count(), 1u);
+  EXPECT_EQ(_cache.size(), 80u);
+
+  _cache.get_or_decompress(1, _decompress(10));
+  EXPECT_EQ(_decompress_count, 3u);
+  _cache.get_or_decompress(2, _decompress(10));
+  EXPECT_EQ(_decompress_count, 4u);
+
+  // Segments larger than the capacity are not cached at all.
+  const auto large_segment = _cache.get_or_decompress(4, _decompress(100));
+  EXPECT_EQ(large_segment->size(), 100u);
+  EXPECT_EQ(_cache.size(), 80u);
+
+  _cache.set_capacity(40);
+  EXPECT_EQ(_cache.size(), 40u);
+  EXPECT_EQ(_cache.capacity(), 40u);
+}
+
+TEST_F(StorageDecompressionCacheTest, EraseAndReset) {
+  _cache.get_or_decompress(1, _decompress(10));
+  _cache.erase(1);
+  _cache.erase(2);
+  EXPECT_EQ(_cache.size(), 0u);
+
+  _cache.get_or_decompress(1, _decompress(10));
+  EXPECT_EQ(_decompress_count, 2u);
+
+  auto stream = std::stringstream{};
+  _cache.print(stream);
+  EXPECT_NE(stream.str().find("1 segments, 40 of"), std::string::npos);
+
+  _cache.reset();
+  EXPECT_EQ(_cache.size(), 0u);
+  EXPECT_EQ(_cache.miss_count(), 0u);
+  EXPECT_EQ(_cache.capacity(), DecompressionCache::DEFAULT_CAPACITY);
+}
+
+TEST_F(StorageDecompressionCacheTest, KeysAreUnique) {
+  EXPECT_NE(DecompressionCache::next_key(), DecompressionCache::next_key());
+}
+
+}  // namespace opossum
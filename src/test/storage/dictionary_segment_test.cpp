@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/base_attribute_vector.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> int_value_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> string_value_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
+  for (const auto* value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) {
+    string_value_segment->append(value);
+  }
+  auto dictionary_segment = DictionarySegment<std::string>{string_value_segment};
+
+  // Test attribute_vector size
+  EXPECT_EQ(dictionary_segment.size(), 6u);
+  EXPECT_EQ(dictionary_segment.attribute_vector()->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dictionary_segment.unique_values_count(), 4u);
+
+  // Test sorting
+  const auto& dictionary = *dictionary_segment.dictionary();
+  EXPECT_EQ(dictionary, (std::vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+
+  EXPECT_EQ(dictionary_segment.get(1), "Steve");
+  EXPECT_EQ(dictionary_segment[4], AllTypeVariant{std::string{"Hasso"}});
+  EXPECT_EQ(dictionary_segment.value_by_value_id(ValueID{0}), "Alexander");
+  EXPECT_THROW(dictionary_segment.append("Larry"), std::exception);
+}
+
+TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
+  for (auto value = 0; value <= 10; value += 2) {
+    int_value_segment->append(value);
+  }
+  const auto dictionary_segment = DictionarySegment<int32_t>{int_value_segment};
+
+  EXPECT_EQ(dictionary_segment.lower_bound(4), ValueID{2});
+  EXPECT_EQ(dictionary_segment.upper_bound(4), ValueID{3});
+
+  EXPECT_EQ(dictionary_segment.lower_bound(AllTypeVariant{5}), ValueID{3});
+  EXPECT_EQ(dictionary_segment.upper_bound(AllTypeVariant{5}), ValueID{3});
+
+  EXPECT_EQ(dictionary_segment.lower_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dictionary_segment.upper_bound(10), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionarySegmentTest, AttributeVectorWidth) {
+  for (auto value = 0; value < 256; ++value) {
+    int_value_segment->append(value);
+  }
+  EXPECT_EQ(DictionarySegment<int32_t>{int_value_segment}.attribute_vector()->width(), 1u);
+
+  int_value_segment->append(256);
+  EXPECT_EQ(DictionarySegment<int32_t>{int_value_segment}.attribute_vector()->width(), 2u);
+
+  for (auto value = 257; value < 70'000; ++value) {
+    int_value_segment->append(value);
+  }
+  const auto dictionary_segment = DictionarySegment<int32_t>{int_value_segment};
+  EXPECT_EQ(dictionary_segment.attribute_vector()->width(), 4u);
+  EXPECT_EQ(dictionary_segment.get(69'999), 69'999);
+  EXPECT_EQ(dictionary_segment.estimate_memory_usage(), 70'000u * sizeof(int32_t) + 70'000u * 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/predicate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/encoding_advisor.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  // Column a is sorted with runs of 100 equal values, b has ten distinct strings that change with every row, and c
+  // has only distinct values.
+  std::shared_ptr<Table> _create_table(const std::shared_ptr<EncodingAdvisor>& encoding_advisor) {
+    auto table = std::make_shared<Table>(10'000);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::String);
+    table->add_column("c", DataType::Int);
+    table->set_encoding_advisor(encoding_advisor);
+    for (auto row = 0; row < 20'000; ++row) {
+      table->append({row / 100, "value_" + std::to_string(row % 10), row * 7'919 % 20'011});
+    }
+    return table;
+  }
+};
+
+TEST_F(StorageEncodingAdvisorTest, SampleSmallSegment) {
+  auto segment = ValueSegment<std::string>{std::vector<std::string>{"bb", "bb", "a", "cccc", "a", "a"}};
+  const auto statistics = EncodingAdvisor{}.sample_segment(segment, DataType::String);
+
+  // The segment is read completely, so the estimates are exact.
+  EXPECT_EQ(statistics.row_count, 6u);
+  EXPECT_EQ(statistics.sampled_row_count, 6u);
+  EXPECT_DOUBLE_EQ(statistics.distinct_count, 3.0);
+  EXPECT_DOUBLE_EQ(statistics.run_count, 4.0);
+  EXPECT_EQ(statistics.min_value, AllTypeVariant{std::string{"a"}});
+  EXPECT_EQ(statistics.max_value, AllTypeVariant{std::string{"cccc"}});
+  EXPECT_DOUBLE_EQ(statistics.average_string_length, 11.0 / 6.0);
+}
+
+TEST_F(StorageEncodingAdvisorTest, SampleLargeSegment) {
+  auto values = std::vector<int32_t>{};
+  for (auto row = 0; row < 100'000; ++row) {
+    values.emplace_back(row / 10);
+  }
+  const auto segment = ValueSegment<int32_t>{std::move(values)};
+  const auto statistics = EncodingAdvisor{EncodingObjective::MinMemory, 1'024}.sample_segment(segment, DataType::Int);
+
+  EXPECT_EQ(statistics.sampled_row_count, 1'024u);
+  EXPECT_NEAR(statistics.run_count, 10'000.0, 1'000.0);
+  EXPECT_GT(statistics.distinct_count, 100.0);
+  EXPECT_LE(statistics.distinct_count, 100'000.0);
+  EXPECT_EQ(statistics.min_value, AllTypeVariant{0});
+}
+
+TEST_F(StorageEncodingAdvisorTest, EncodeAtFinalization) {
+  const auto encoding_advisor = std::make_shared<EncodingAdvisor>();
+  const auto table = _create_table(encoding_advisor);
+  EXPECT_EQ(table->encoding_advisor(), encoding_advisor);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk.get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(chunk.get_segment(ColumnID{2})));
+  }
+  EXPECT_EQ(encoding_advisor->decisions().size(), 6u);
+  EXPECT_GT(encoding_advisor->compression_ratio(ColumnID{0}), 10.0);
+  EXPECT_GT(encoding_advisor->compression_ratio(ColumnID{1}), 10.0);
+  EXPECT_DOUBLE_EQ(encoding_advisor->compression_ratio(ColumnID{2}), 1.0);
+
+  const auto& chunk = table->get_chunk(ChunkID{1});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[1'234], AllTypeVariant{112});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[1'234], AllTypeVariant{std::string{"value_4"}});
+
+  // Scans read the encoded segments.
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto predicate = Predicate::conjunction({Predicate::between(ColumnID{0}, 50, 149),
+                                                 Predicate::comparison(ColumnID{1}, ScanType::OpEquals, "value_3")});
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 1'000u);
+
+  auto stream = std::stringstream{};
+  encoding_advisor->print(stream, table->column_names());
+  EXPECT_NE(stream.str().find("a: RunLength x2"), std::string::npos);
+  EXPECT_NE(stream.str().find("b: Dictionary x2"), std::string::npos);
+  EXPECT_NE(stream.str().find("c: Unencoded x2"), std::string::npos);
+}
+
+TEST_F(StorageEncodingAdvisorTest, MinScanCost) {
+  const auto encoding_advisor = std::make_shared<EncodingAdvisor>(EncodingObjective::MinScanCost);
+  const auto table = _create_table(encoding_advisor);
+
+  // Run-length segments have to be decoded for scans, so the sorted column is dictionary-encoded instead.
+  const auto& chunk = table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})));
+}
+
+TEST_F(StorageEncodingAdvisorTest, EncodeSegment) {
+  const auto value_segment = std::make_shared<ValueSegment<float>>(std::vector<float>{1.5f, 1.5f, 2.5f});
+  const auto dictionary_segment = encode_segment(value_segment, DataType::Float, EncodingType::Dictionary);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<float>>(dictionary_segment));
+
+  const auto decoded_segment = encode_segment(dictionary_segment, DataType::Float, EncodingType::Unencoded);
+  const auto decoded_value_segment = std::dynamic_pointer_cast<ValueSegment<float>>(decoded_segment);
+  ASSERT_TRUE(decoded_value_segment);
+  EXPECT_EQ(decoded_value_segment->values(), value_segment->values());
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#include <limits>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/fixed_size_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageFixedSizeAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageFixedSizeAttributeVectorTest, GetAndSet) {
+  auto attribute_vector = FixedSizeAttributeVector<uint16_t>{3};
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+
+  attribute_vector.set(1, ValueID{1'000});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{1'000});
+  EXPECT_EQ(attribute_vector.values().at(1), 1'000);
+  EXPECT_THROW(attribute_vector.get(3), std::exception);
+}
+
+TEST_F(StorageFixedSizeAttributeVectorTest, Width) {
+  EXPECT_EQ(FixedSizeAttributeVector<uint8_t>{1}.width(), 1u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint16_t>{1}.width(), 2u);
+  EXPECT_EQ(FixedSizeAttributeVector<uint32_t>{1}.width(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/hyper_log_log.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageHyperLogLogTest : public BaseTest {};
+
+TEST_F(StorageHyperLogLogTest, Estimate) {
+  auto hyper_log_log = HyperLogLog{};
+  EXPECT_EQ(hyper_log_log.estimate(), 0.0);
+
+  // Small counts are estimated by linear counting and almost exact.
+  for (auto value = 0; value < 100; ++value) {
+    hyper_log_log.insert(value_hash(value));
+    hyper_log_log.insert(value_hash(value));
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 100.0, 2.0);
+
+  for (auto value = 100; value < 200'000; ++value) {
+    hyper_log_log.insert(value_hash(value));
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 200'000.0, 200'000.0 * 3 * hyper_log_log.relative_standard_error());
+  EXPECT_NEAR(hyper_log_log.relative_standard_error(), 0.01625, 0.0001);
+  EXPECT_EQ(hyper_log_log.memory_usage(), sizeof(HyperLogLog) + 4'096);
+}
+
+TEST_F(StorageHyperLogLogTest, Merge) {
+  auto first = HyperLogLog{10};
+  auto second = HyperLogLog{10};
+  for (auto value = int64_t{0}; value < 50'000; ++value) {
+    first.insert(value_hash(value));
+    second.insert(value_hash(value + 25'000));
+  }
+  first.merge(second);
+  EXPECT_NEAR(first.estimate(), 75'000.0, 75'000.0 * 3 * first.relative_standard_error());
+
+  EXPECT_THROW(first.merge(HyperLogLog{11}), std::exception);
+  EXPECT_THROW(HyperLogLog{3}, std::exception);
+  EXPECT_THROW(HyperLogLog{19}, std::exception);
+}
+
+TEST_F(StorageHyperLogLogTest, BuiltForFinalizedChunks) {
+  auto table = Table{100};
+  table.add_column("a", DataType::Int);
+  table.add_column("b", DataType::String);
+  table.set_hyper_log_log_enabled(true);
+  EXPECT_TRUE(table.hyper_log_log_enabled());
+  for (auto row = 0; row < 250; ++row) {
+    table.append({row, std::to_string(row % 10)});
+  }
+
+  ASSERT_TRUE(table.get_chunk(ChunkID{1}).hyper_log_log(ColumnID{0}));
+  EXPECT_NEAR(table.get_chunk(ChunkID{1}).hyper_log_log(ColumnID{0})->estimate(), 100.0, 2.0);
+  EXPECT_NEAR(table.get_chunk(ChunkID{1}).hyper_log_log(ColumnID{1})->estimate(), 10.0, 1.0);
+  EXPECT_FALSE(table.get_chunk(ChunkID{1}).bloom_filter(ColumnID{0}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{2}).hyper_log_log(ColumnID{0}));
+}
+
+}  // namespace opossum
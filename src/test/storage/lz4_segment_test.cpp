@@ -0,0 +1,81 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/decompression_cache.hpp"
+#include "../lib/storage/lz4_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageLZ4SegmentTest : public BaseTest {};
+
+TEST_F(StorageLZ4SegmentTest, CompressRepetitiveValues) {
+  auto values = std::vector<int32_t>{};
+  for (auto row = 0; row < 100'000; ++row) {
+    values.emplace_back(row / 16 % 1'000);
+  }
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{values});
+  const auto lz4_segment = LZ4Segment<int32_t>{value_segment};
+
+  EXPECT_EQ(lz4_segment.size(), 100'000u);
+  EXPECT_EQ(lz4_segment.uncompressed_size(), 400'000u);
+  EXPECT_LT(lz4_segment.estimate_memory_usage() * 10, lz4_segment.uncompressed_size());
+  EXPECT_EQ(lz4_segment.decompress()->values(), values);
+  EXPECT_EQ(lz4_segment[ChunkOffset{99'999}], AllTypeVariant{values.back()});
+}
+
+TEST_F(StorageLZ4SegmentTest, CompressRandomValues) {
+  auto random_engine = std::mt19937{42};
+  auto values = std::vector<double>{};
+  for (auto row = 0; row < 50'000; ++row) {
+    values.emplace_back(std::uniform_real_distribution<double>{}(random_engine));
+  }
+  const auto lz4_segment = LZ4Segment<double>{std::make_shared<ValueSegment<double>>(std::vector<double>{values})};
+
+  // Random values are stored as literals, which costs a little more than the values themselves.
+  EXPECT_EQ(lz4_segment.decompress()->values(), values);
+  EXPECT_LT(lz4_segment.estimate_memory_usage(), lz4_segment.uncompressed_size() * 102 / 100);
+}
+
+TEST_F(StorageLZ4SegmentTest, CompressStrings) {
+  const auto values = std::vector<std::string>{"", "Hello", "", "Hello", std::string(100'000, 'x'), "world"};
+  auto lz4_segment = LZ4Segment<std::string>{std::make_shared<ValueSegment<std::string>>(std::vector{values})};
+
+  EXPECT_EQ(lz4_segment.size(), 6u);
+  EXPECT_EQ(lz4_segment.decompress()->values(), values);
+  EXPECT_EQ(lz4_segment[ChunkOffset{5}], AllTypeVariant{std::string{"world"}});
+  EXPECT_LT(lz4_segment.estimate_memory_usage(), 1'000u);
+  EXPECT_THROW(lz4_segment.append("!"), std::exception);
+}
+
+TEST_F(StorageLZ4SegmentTest, EmptySegment) {
+  const auto lz4_segment = LZ4Segment<int32_t>{std::make_shared<ValueSegment<int32_t>>()};
+  EXPECT_EQ(lz4_segment.size(), 0u);
+  EXPECT_TRUE(lz4_segment.decompress()->values().empty());
+}
+
+TEST_F(StorageLZ4SegmentTest, DecompressThroughCache) {
+  auto& decompression_cache = DecompressionCache::get();
+  {
+    const auto lz4_segment =
+        LZ4Segment<int32_t>{std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2, 3})};
+    EXPECT_EQ(decompression_cache.miss_count(), 0u);
+
+    const auto first_decompressed_segment = lz4_segment.decompress();
+    EXPECT_EQ(decompression_cache.miss_count(), 1u);
+    EXPECT_EQ(lz4_segment[ChunkOffset{1}], AllTypeVariant{2});
+    EXPECT_EQ(lz4_segment.decompress(), first_decompressed_segment);
+    EXPECT_EQ(decompression_cache.hit_count(), 2u);
+    EXPECT_EQ(decompression_cache.size(), 3 * sizeof(int32_t));
+  }
+
+  // Destroying the segment removes its decompressed version from the cache.
+  EXPECT_EQ(decompression_cache.size(), 0u);
+}
+
+}  // namespace opossum
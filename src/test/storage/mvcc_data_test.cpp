@@ -0,0 +1,32 @@
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/mvcc_data.hpp"
+
+namespace opossum {
+
+class StorageMvccDataTest : public BaseTest {};
+
+TEST_F(StorageMvccDataTest, AppendRow) {
+  auto mvcc_data = MvccData{3};
+  EXPECT_EQ(mvcc_data.capacity(), 3u);
+  EXPECT_EQ(mvcc_data.size(), 0u);
+
+  mvcc_data.append_row(CommitID{0}, INVALID_TRANSACTION_ID);
+  mvcc_data.append_row(MAX_COMMIT_ID, TransactionID{7});
+  EXPECT_EQ(mvcc_data.size(), 2u);
+
+  EXPECT_EQ(mvcc_data.begin_cids[0], 0u);
+  EXPECT_EQ(mvcc_data.tids[0], INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_data.begin_cids[1], MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.tids[1], 7u);
+  EXPECT_EQ(mvcc_data.end_cids[1], MAX_COMMIT_ID);
+}
+
+TEST_F(StorageMvccDataTest, ThrowsWhenFull) {
+  auto mvcc_data = MvccData{1};
+  mvcc_data.append_row(CommitID{0}, INVALID_TRANSACTION_ID);
+  EXPECT_THROW(mvcc_data.append_row(CommitID{0}, INVALID_TRANSACTION_ID), std::exception);
+}
+
+}  // namespace opossum
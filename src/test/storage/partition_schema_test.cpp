@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/partition_schema.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StoragePartitionSchemaTest : public BaseTest {};
+
+TEST_F(StoragePartitionSchemaTest, HashPartitioning) {
+  const auto schema = HashPartitionSchema{ColumnID{0}, DataType::Int, PartitionID{4}};
+  EXPECT_EQ(schema.partition_count(), 4u);
+  EXPECT_EQ(schema.description(), "Hash (#0, 4 partitions)");
+
+  // Keys are spread over all partitions, and keys of other types are converted to the column type.
+  auto row_counts = std::vector<size_t>(4);
+  for (auto key = 0; key < 4'000; ++key) {
+    ++row_counts[schema.partition_of(key)];
+  }
+  for (const auto row_count : row_counts) {
+    EXPECT_GT(row_count, 800u);
+  }
+  EXPECT_EQ(schema.partition_of(int64_t{17}), schema.partition_of(17));
+
+  // Only equality predicates exclude partitions.
+  const auto partition_id = schema.partition_of(17);
+  for (auto other_partition_id = PartitionID{0}; other_partition_id < 4; ++other_partition_id) {
+    EXPECT_EQ(schema.may_match(other_partition_id, ScanType::OpEquals, 17), other_partition_id == partition_id);
+    EXPECT_TRUE(schema.may_match(other_partition_id, ScanType::OpLessThan, 17));
+  }
+  EXPECT_THROW(HashPartitionSchema(ColumnID{0}, DataType::Int, PartitionID{0}), std::exception);
+}
+
+TEST_F(StoragePartitionSchemaTest, RangePartitioning) {
+  const auto schema = RangePartitionSchema{ColumnID{1}, DataType::String, {"g", "p"}};
+  EXPECT_EQ(schema.partition_count(), 3u);
+  EXPECT_EQ(schema.partition_of("apple"), 0u);
+  EXPECT_EQ(schema.partition_of("g"), 1u);
+  EXPECT_EQ(schema.partition_of("orange"), 1u);
+  EXPECT_EQ(schema.partition_of("zucchini"), 2u);
+  EXPECT_EQ(schema.description(), "Range (#1, boundaries g p)");
+
+  // The middle partition holds the keys in [g, p).
+  const auto middle = PartitionID{1};
+  EXPECT_TRUE(schema.may_match(middle, ScanType::OpEquals, "g"));
+  EXPECT_FALSE(schema.may_match(middle, ScanType::OpEquals, "p"));
+  EXPECT_FALSE(schema.may_match(middle, ScanType::OpLessThan, "g"));
+  EXPECT_TRUE(schema.may_match(middle, ScanType::OpLessThanEquals, "g"));
+  EXPECT_FALSE(schema.may_match(middle, ScanType::OpGreaterThanEquals, "p"));
+  EXPECT_TRUE(schema.may_match(middle, ScanType::OpGreaterThan, "o"));
+  EXPECT_TRUE(schema.may_match(middle, ScanType::OpNotEquals, "h"));
+  EXPECT_TRUE(schema.may_match(PartitionID{0}, ScanType::OpLessThan, "a"));
+  EXPECT_TRUE(schema.may_match(PartitionID{2}, ScanType::OpGreaterThan, "zz"));
+
+  EXPECT_THROW(RangePartitionSchema(ColumnID{0}, DataType::Int, {10, 10}), std::exception);
+}
+
+TEST_F(StoragePartitionSchemaTest, PartitionedTable) {
+  auto table = Table{100};
+  table.add_column("a", DataType::Int);
+  table.add_column("b", DataType::String);
+  table.create_range_partitioning(ColumnID{0}, {500, 1'000});
+  ASSERT_TRUE(table.partition_schema());
+  EXPECT_THROW(table.create_hash_partitioning(ColumnID{0}, PartitionID{2}), std::exception);
+
+  // Rows arrive interleaved, but each chunk only holds the rows of one partition.
+  for (auto row = 0; row < 600; ++row) {
+    table.append({row % 3 == 0 ? row / 3 : 1'000 + row, std::to_string(row)});
+  }
+  EXPECT_EQ(table.row_count(), 600u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    ASSERT_TRUE(chunk.partition_id());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_EQ(table.partition_schema()->partition_of((*chunk.get_segment(ColumnID{0}))[chunk_offset]),
+                *chunk.partition_id());
+    }
+  }
+
+  const auto first_partition_chunk_ids = table.chunk_ids_of_partition(PartitionID{0});
+  ASSERT_EQ(first_partition_chunk_ids.size(), 2u);
+  EXPECT_EQ(table.get_chunk(first_partition_chunk_ids[0]).size(), 100u);
+  EXPECT_TRUE(table.get_chunk(first_partition_chunk_ids[0]).is_finalized());
+  EXPECT_EQ(table.get_chunk(first_partition_chunk_ids[1]).size(), 100u);
+  EXPECT_TRUE(table.chunk_ids_of_partition(PartitionID{1}).empty());
+  EXPECT_EQ(table.chunk_ids_of_partition(PartitionID{2}).size(), 4u);
+  EXPECT_THROW(table.chunk_ids_of_partition(PartitionID{3}), std::exception);
+
+  EXPECT_THROW(table.emplace_chunk(Chunk{}), std::exception);
+  auto filled_table = Table{};
+  filled_table.add_column("a", DataType::Int);
+  filled_table.append({1});
+  EXPECT_THROW(filled_table.create_hash_partitioning(ColumnID{0}, PartitionID{2}), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/pos_lists.hpp"
+
+namespace opossum {
+
+class StoragePosListsTest : public BaseTest {
+ protected:
+  // Reads the positions in all ways a consumer can and checks that they agree with the expected RowIDs
+  void _expect_positions(const BasePosList& pos_list, const PosList& expected) {
+    ASSERT_EQ(pos_list.size(), expected.size());
+
+    auto iterated = PosList{};
+    pos_list.for_each([&](const RowID& row_id) { iterated.emplace_back(row_id); });
+    EXPECT_EQ(iterated, expected);
+
+    for (auto index = size_t{0}; index < expected.size(); ++index) {
+      EXPECT_EQ(pos_list[index], expected[index]);
+    }
+
+    // Batches that do not start at the beginning of a word or run
+    for (auto begin = size_t{0}; begin < expected.size(); begin += 7) {
+      const auto count = std::min(size_t{100}, expected.size() - begin);
+      auto copied = PosList(count);
+      pos_list.copy_positions(begin, count, copied.data());
+      EXPECT_EQ(copied, PosList(expected.cbegin() + begin, expected.cbegin() + begin + count));
+    }
+  }
+
+  static PosList _row_ids(const ChunkID chunk_id, const std::vector<ChunkOffset>& chunk_offsets) {
+    auto row_ids = PosList{};
+    for (const auto chunk_offset : chunk_offsets) {
+      row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    return row_ids;
+  }
+};
+
+TEST_F(StoragePosListsTest, RowIDPosList) {
+  const auto positions = PosList{RowID{ChunkID{1}, 4}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}};
+  const auto pos_list = RowIDPosList{positions};
+  _expect_positions(pos_list, positions);
+  EXPECT_EQ(pos_list.positions(), positions);
+  EXPECT_EQ(pos_list.ordered_chunk_id(), std::nullopt);
+  EXPECT_EQ(pos_list.contiguous_begin(0, 1), std::nullopt);
+  EXPECT_EQ(pos_list.estimate_memory_usage(), 3 * sizeof(RowID));
+
+  const auto ordered_pos_list = RowIDPosList{_row_ids(ChunkID{2}, {3, 4, 5, 7})};
+  EXPECT_EQ(ordered_pos_list.ordered_chunk_id(), ChunkID{2});
+  EXPECT_EQ(ordered_pos_list.contiguous_begin(0, 3), (RowID{ChunkID{2}, 3}));
+  EXPECT_EQ(ordered_pos_list.contiguous_begin(1, 3), std::nullopt);
+}
+
+TEST_F(StoragePosListsTest, EntireChunkPosList) {
+  const auto pos_list = EntireChunkPosList{ChunkID{3}, 1'000};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+  _expect_positions(pos_list, _row_ids(ChunkID{3}, chunk_offsets));
+  EXPECT_EQ(pos_list.ordered_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.contiguous_begin(500, 500), (RowID{ChunkID{3}, 500}));
+  EXPECT_LT(pos_list.estimate_memory_usage(), 32u);
+}
+
+TEST_F(StoragePosListsTest, RangePosList) {
+  // [10, 15), [20, 21), and [100, 300)
+  const auto runs = std::vector<RangePosList::Run>{{10, 0}, {20, 5}, {100, 6}};
+  const auto pos_list = RangePosList{ChunkID{1}, runs, 206};
+  auto chunk_offsets = std::vector<ChunkOffset>{10, 11, 12, 13, 14, 20};
+  for (auto chunk_offset = ChunkOffset{100}; chunk_offset < 300; ++chunk_offset) {
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+  _expect_positions(pos_list, _row_ids(ChunkID{1}, chunk_offsets));
+  EXPECT_EQ(pos_list.ordered_chunk_id(), ChunkID{1});
+  EXPECT_EQ(pos_list.contiguous_begin(1, 4), (RowID{ChunkID{1}, 11}));
+  EXPECT_EQ(pos_list.contiguous_begin(1, 5), std::nullopt);
+  EXPECT_EQ(pos_list.contiguous_begin(6, 200), (RowID{ChunkID{1}, 100}));
+  EXPECT_EQ(pos_list.estimate_memory_usage(), 3 * sizeof(RangePosList::Run));
+}
+
+TEST_F(StoragePosListsTest, BitmapPosList) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; ++chunk_offset) {
+    if (chunk_offset % 3 != 0 || (chunk_offset >= 5'000 && chunk_offset < 5'200)) {
+      chunk_offsets.emplace_back(chunk_offset);
+    }
+  }
+  const auto pos_list = BitmapPosList{ChunkID{2}, chunk_offsets};
+  _expect_positions(pos_list, _row_ids(ChunkID{2}, chunk_offsets));
+  EXPECT_EQ(pos_list.ordered_chunk_id(), ChunkID{2});
+  EXPECT_EQ(pos_list.contiguous_begin(0, 2), (RowID{ChunkID{2}, 1}));
+  EXPECT_EQ(pos_list.contiguous_begin(0, 3), std::nullopt);
+  EXPECT_EQ(pos_list.contiguous_begin(3'333, 200), (RowID{ChunkID{2}, 5'000}));
+  EXPECT_EQ(pos_list.estimate_memory_usage(), 157 * (sizeof(uint64_t) + sizeof(uint32_t)));
+}
+
+TEST_F(StoragePosListsTest, MakePosListPicksDensestRepresentation) {
+  const auto make = [](const std::vector<ChunkOffset>& chunk_offsets) {
+    return make_pos_list(ChunkID{4}, chunk_offsets);
+  };
+
+  auto all_rows = std::vector<ChunkOffset>{};
+  auto large_ranges = std::vector<ChunkOffset>{};
+  auto most_rows = std::vector<ChunkOffset>{};
+  auto few_rows = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; ++chunk_offset) {
+    all_rows.emplace_back(chunk_offset);
+    if (chunk_offset % 1'000 >= 500) large_ranges.emplace_back(chunk_offset);
+    if (chunk_offset % 5 != 0) most_rows.emplace_back(chunk_offset);
+    if (chunk_offset % 500 == 7) few_rows.emplace_back(chunk_offset);
+  }
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(make(all_rows)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RangePosList>(make(large_ranges)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(make(most_rows)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(make(few_rows)));
+  EXPECT_EQ(make({})->size(), 0u);
+
+  for (const auto& chunk_offsets : {all_rows, large_ranges, most_rows, few_rows}) {
+    const auto pos_list = make(chunk_offsets);
+    _expect_positions(*pos_list, _row_ids(ChunkID{4}, chunk_offsets));
+    EXPECT_LE(pos_list->estimate_memory_usage(), chunk_offsets.size() * sizeof(RowID));
+  }
+
+  // Positions that span several chunks or are not ordered are kept as RowIDs.
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(make_pos_list(_row_ids(ChunkID{1}, {0, 1, 2}))));
+  const auto unordered = PosList{RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 0}};
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(make_pos_list(unordered)));
+  const auto several_chunks = PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 1}};
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(make_pos_list(several_chunks)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/pos_lists.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class StorageReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override { _table = load_table("src/test/tables/int_float.tbl", 2); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageReferenceSegmentTest, ResolvesPositions) {
+  const auto pos_list = std::make_shared<RowIDPosList>(PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 0}});
+  const auto segment = ReferenceSegment{_table, ColumnID{1}, pos_list};
+
+  EXPECT_EQ(segment.size(), 2u);
+  EXPECT_EQ(segment[0], AllTypeVariant{457.7f});
+  EXPECT_EQ(segment[1], AllTypeVariant{458.7f});
+  EXPECT_EQ(segment.pos_list(), pos_list);
+  EXPECT_EQ(segment.referenced_table(), _table);
+  EXPECT_EQ(segment.referenced_column_id(), ColumnID{1});
+}
+
+TEST_F(StorageReferenceSegmentTest, IsImmutable) {
+  auto segment = ReferenceSegment{_table, ColumnID{0}, std::make_shared<RowIDPosList>(PosList{})};
+  EXPECT_THROW(segment.append(1), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegment) {
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (const auto* value : {"a", "a", "a", "b", "a", "a", "c"}) {
+    value_segment->append(value);
+  }
+  auto run_length_segment = RunLengthSegment<std::string>{value_segment};
+
+  EXPECT_EQ(run_length_segment.size(), 7u);
+  EXPECT_EQ(run_length_segment.values(), (std::vector<std::string>{"a", "b", "a", "c"}));
+  EXPECT_EQ(run_length_segment.end_positions(), (std::vector<ChunkOffset>{2, 3, 5, 6}));
+
+  EXPECT_EQ(run_length_segment.get(0), "a");
+  EXPECT_EQ(run_length_segment.get(3), "b");
+  EXPECT_EQ(run_length_segment[4], AllTypeVariant{std::string{"a"}});
+  EXPECT_EQ(run_length_segment[6], AllTypeVariant{std::string{"c"}});
+  EXPECT_THROW(run_length_segment.get(7), std::exception);
+  EXPECT_THROW(run_length_segment.append("d"), std::exception);
+
+  EXPECT_EQ(run_length_segment.estimate_memory_usage(), 4 * (sizeof(std::string) + 1) + 4 * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto run_length_segment = RunLengthSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>()};
+  EXPECT_EQ(run_length_segment.size(), 0u);
+  EXPECT_EQ(run_length_segment.estimate_memory_usage(), 0u);
+}
+
+}  // namespace opossum
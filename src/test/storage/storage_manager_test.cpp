@@ -78,4 +78,22 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, CloneTable) {
+  auto& sm = StorageManager::get();
+  t2->add_column("a", DataType::Int);
+  for (auto row = 0; row < 6; ++row) {
+    t2->append({row});
+  }
+  sm.clone_table("second_table", "cloned_table");
+  const auto clone = sm.get_table("cloned_table");
+  EXPECT_NE(clone, t2);
+  EXPECT_EQ(clone->row_count(), 6u);
+  EXPECT_EQ(&clone->get_chunk(ChunkID{0}), &t2->get_chunk(ChunkID{0}));
+
+  clone->append({6});
+  EXPECT_EQ(t2->row_count(), 6u);
+  EXPECT_THROW(sm.clone_table("second_table", "cloned_table"), std::exception);
+  EXPECT_THROW(sm.clone_table("third_table", "other_table"), std::exception);
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -8,6 +9,10 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/lz4_segment.hpp"
+#include "../lib/storage/partition_schema.hpp"
+#include "../lib/storage/value_segment.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
@@ -30,6 +35,15 @@ TEST_F(StorageTableTest, ChunkCount) {
   EXPECT_EQ(t.chunk_count(), 2u);
 }
 
+TEST_F(StorageTableTest, FinalizeFullChunks) {
+  t.append({4, "Hello,"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{0}).is_finalized());
+  t.append({6, "world"});
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).is_finalized());
+  t.append({3, "!"});
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).is_finalized());
+}
+
 TEST_F(StorageTableTest, GetChunk) {
   t.get_chunk(ChunkID{0});
   EXPECT_THROW(t.get_chunk(ChunkID{1000}), std::exception);
@@ -41,6 +55,43 @@ TEST_F(StorageTableTest, GetChunk) {
   std::as_const(t.get_chunk(ChunkID{0}));
 }
 
+TEST_F(StorageTableTest, EmplaceChunk) {
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{4, 6, 3}));
+  chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"Hello,", "world", "!"}));
+
+  // The empty first chunk is replaced, so it must not be read meanwhile.
+  {
+    const auto first_chunk = t.get_chunk_ptr(ChunkID{0});
+    auto blocked_chunk = Chunk{};
+    blocked_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1}));
+    blocked_chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"?"}));
+    EXPECT_THROW(t.emplace_chunk(std::move(blocked_chunk)), std::logic_error);
+  }
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).is_finalized());
+
+  auto second_chunk = Chunk{};
+  second_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1}));
+  second_chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"?"}));
+  t.emplace_chunk(std::move(second_chunk));
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.row_count(), 4u);
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).is_finalized());
+
+  // Rows appended afterwards fill the emplaced chunk, which is still open, before a new chunk is started.
+  t.append({7, "!!"});
+  EXPECT_EQ(t.chunk_count(), 2u);
+  t.append({8, "!!!"});
+  EXPECT_EQ(t.chunk_count(), 3u);
+
+  auto invalid_chunk = Chunk{};
+  invalid_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1}));
+  EXPECT_THROW(t.emplace_chunk(std::move(invalid_chunk)), std::exception);
+}
+
 TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
 
 TEST_F(StorageTableTest, RowCount) {
@@ -60,8 +111,8 @@ TEST_F(StorageTableTest, GetColumnName) {
 }
 
 TEST_F(StorageTableTest, GetColumnType) {
-  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  EXPECT_EQ(t.column_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(t.column_type(ColumnID{1}), DataType::String);
   EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
 }
 
@@ -72,4 +123,265 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.target_chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, ApproxValidRowCount) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.get_chunk(ChunkID{0}).increase_invalid_row_count(1);
+
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ(t.approx_valid_row_count(), 2u);
+}
+
+TEST_F(StorageTableTest, RemoveChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_THROW(t.remove_chunk(ChunkID{0}), std::exception);
+
+  t.get_chunk(ChunkID{0}).increase_invalid_row_count(2);
+  t.get_chunk(ChunkID{0}).set_cleanup_commit_id(CommitID{5});
+  const auto removed_chunk = t.get_chunk_ptr(ChunkID{0});
+  t.remove_chunk(ChunkID{0});
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 0u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).column_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).cleanup_commit_id(), CommitID{5});
+  EXPECT_EQ(t.row_count(), 1u);
+
+  // Readers that still hold the removed chunk can keep reading it.
+  EXPECT_EQ(removed_chunk->size(), 2u);
+  EXPECT_EQ(type_cast<int32_t>((*removed_chunk->get_segment(ColumnID{0}))[1]), 6);
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}), std::exception);
+
+  const auto previous_segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{1});
+  t.compress_chunk(ChunkID{0});
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})));
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{std::string{"world"}});
+
+  // Readers that still hold the previous segment can keep using it.
+  EXPECT_EQ((*previous_segment)[1], AllTypeVariant{std::string{"world"}});
+
+  // Compressing twice does not change anything.
+  const auto dictionary_segment = chunk.get_segment(ColumnID{0});
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.get_segment(ColumnID{0}), dictionary_segment);
+}
+
+TEST_F(StorageTableTest, CompressColdChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_THROW(t.compress_cold_chunk(ChunkID{1}), std::exception);
+
+  t.compress_chunk(ChunkID{0});
+  t.compress_cold_chunk(ChunkID{0});
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<LZ4Segment<int32_t>>(chunk.get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<LZ4Segment<std::string>>(chunk.get_segment(ColumnID{1})));
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{std::string{"Hello,"}});
+}
+
+TEST_F(StorageTableTest, Repartition) {
+  auto table = Table{};
+  table.add_column("a", DataType::Int);
+  table.add_column("b", DataType::String);
+  for (auto row = 0; row < 1'000; ++row) {
+    table.append({row, std::to_string(row)});
+  }
+  EXPECT_EQ(table.chunk_count(), 1u);
+
+  table.repartition(300);
+  EXPECT_EQ(table.target_chunk_size(), 300u);
+  ASSERT_EQ(table.chunk_count(), 4u);
+  EXPECT_EQ(table.row_count(), 1'000u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{2}).is_finalized());
+  EXPECT_FALSE(table.get_chunk(ChunkID{3}).is_finalized());
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 100u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[5], AllTypeVariant{305});
+  EXPECT_EQ((*table.get_chunk(ChunkID{3}).get_segment(ColumnID{1}))[99], AllTypeVariant{std::string{"999"}});
+
+  // Appends continue in the open last chunk.
+  table.append({1'000, "1000"});
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 101u);
+
+  // Encoded chunks are decoded when they are split, and chunks that fit the new layout are kept.
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  const auto kept_segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  table.repartition(150);
+  ASSERT_EQ(table.chunk_count(), 7u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 150u);
+  EXPECT_EQ(table.get_chunk(ChunkID{6}).size(), 101u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{3}).get_segment(ColumnID{0}))[0], AllTypeVariant{450});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(table.get_chunk(ChunkID{2}).get_segment(ColumnID{0})));
+
+  table.repartition(300);
+  ASSERT_EQ(table.chunk_count(), 4u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{3}).get_segment(ColumnID{0}))[100], AllTypeVariant{1'000});
+  EXPECT_NE(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), kept_segment);
+
+  auto mvcc_table = Table{2, UseMvcc::Yes};
+  EXPECT_THROW(mvcc_table.repartition(4), std::exception);
+}
+
+TEST_F(StorageTableTest, RepartitionKeepsMatchingChunks) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0});
+  const auto kept_segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+
+  t.repartition(4);
+  ASSERT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[2], AllTypeVariant{std::string{"!"}});
+
+  t.append({5, "again"});
+  t.repartition(2);
+  ASSERT_EQ(t.chunk_count(), 2u);
+  EXPECT_NE(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), kept_segment);
+  t.compress_chunk(ChunkID{1});
+  const auto second_segment = t.get_chunk(ChunkID{1}).get_segment(ColumnID{0});
+  t.repartition(2);
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).get_segment(ColumnID{0}), second_segment);
+}
+
+TEST_F(StorageTableTest, RepartitionWithTrailingEmptyChunk) {
+  auto table = Table{5};
+  table.add_column("a", DataType::Int);
+  for (auto row = 0; row < 5; ++row) {
+    table.append({row});
+  }
+  const auto kept_segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  auto empty_chunk = Chunk{};
+  empty_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>());
+  table.emplace_chunk(std::move(empty_chunk));
+  ASSERT_EQ(table.chunk_count(), 2u);
+
+  // The empty chunk starts at the row count, i.e., after the last new chunk, and must not be kept.
+  table.repartition(5);
+  ASSERT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 5u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}), kept_segment);
+}
+
+TEST_F(StorageTableTest, MergeUndersizedChunks) {
+  auto table = Table{100};
+  table.add_column("a", DataType::Int);
+  table.set_chunk_merging_enabled(true);
+  EXPECT_TRUE(table.chunk_merging_enabled());
+
+  const auto make_chunk = [](const int first_value, const int row_count) {
+    auto values = std::vector<int32_t>(row_count);
+    std::iota(values.begin(), values.end(), first_value);
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::move(values)));
+    return chunk;
+  };
+
+  for (auto batch = 0; batch < 7; ++batch) {
+    table.emplace_chunk(make_chunk(batch * 30, 30));
+  }
+  ASSERT_EQ(table.chunk_count(), 3u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{1}).is_finalized());
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 100u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 10u);
+  EXPECT_EQ((*table.get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[0], AllTypeVariant{100});
+  EXPECT_EQ((*table.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[9], AllTypeVariant{209});
+
+  // Finalized chunks are sealed and encoded chunks are left as they are.
+  auto sealed_chunk = make_chunk(210, 5);
+  sealed_chunk.finalize();
+  table.emplace_chunk(std::move(sealed_chunk));
+  table.emplace_chunk(make_chunk(215, 5));
+  ASSERT_EQ(table.chunk_count(), 5u);
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 5u);
+
+  auto encoded_chunk = Chunk{};
+  encoded_chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(make_chunk(220, 5).get_segment(ColumnID{0})));
+  table.emplace_chunk(std::move(encoded_chunk));
+  EXPECT_EQ(table.chunk_count(), 6u);
+  EXPECT_EQ(table.row_count(), 225u);
+}
+
+TEST_F(StorageTableTest, Snapshot) {
+  for (auto row = 0; row < 5; ++row) {
+    t.append({row, "row " + std::to_string(row)});
+  }
+  const auto snapshot = t.snapshot();
+  EXPECT_EQ(snapshot->column_names(), t.column_names());
+  EXPECT_EQ(snapshot->target_chunk_size(), 2u);
+  ASSERT_EQ(snapshot->chunk_count(), 3u);
+  EXPECT_TABLE_EQ(*snapshot, t, true);
+
+  // Finalized chunks are shared, the open last chunk is copied.
+  EXPECT_EQ(&snapshot->get_chunk(ChunkID{0}), &t.get_chunk(ChunkID{0}));
+  EXPECT_EQ(&snapshot->get_chunk(ChunkID{1}), &t.get_chunk(ChunkID{1}));
+  EXPECT_NE(&snapshot->get_chunk(ChunkID{2}), &t.get_chunk(ChunkID{2}));
+
+  t.append({5, "row 5"});
+  t.append({6, "row 6"});
+  snapshot->append({50, "snapshot row"});
+  EXPECT_EQ(t.row_count(), 7u);
+  EXPECT_EQ(snapshot->row_count(), 6u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[1], AllTypeVariant{5});
+  EXPECT_EQ((*snapshot->get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[1], AllTypeVariant{50});
+
+  // Encoding a shared chunk does not change its values for either table.
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ((*snapshot->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"row 1"});
+
+  auto mvcc_table = Table{2, UseMvcc::Yes};
+  EXPECT_THROW(mvcc_table.snapshot(), std::logic_error);
+}
+
+TEST_F(StorageTableTest, ChunkSnapshot) {
+  for (auto row = 0; row < 3; ++row) {
+    t.append({row, "row " + std::to_string(row)});
+  }
+
+  // Finalized chunks are shared, the open last chunk is copied and does not see later appends.
+  EXPECT_EQ(t.get_chunk_snapshot(ChunkID{0}), t.get_chunk_ptr(ChunkID{0}));
+  const auto chunk = t.get_chunk_snapshot(ChunkID{1});
+  EXPECT_NE(chunk, t.get_chunk_ptr(ChunkID{1}));
+  t.append({3, "row 3"});
+  EXPECT_EQ(chunk->size(), 1u);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[0], AllTypeVariant{"row 2"});
+}
+
+TEST_F(StorageTableTest, SnapshotOfPartitionedTable) {
+  t.create_hash_partitioning(ColumnID{0}, PartitionID{2});
+  for (auto row = 0; row < 6; ++row) {
+    t.append({row, "row"});
+  }
+  const auto snapshot = t.snapshot();
+  ASSERT_TRUE(snapshot->partition_schema());
+  EXPECT_EQ(snapshot->chunk_ids_of_partition(PartitionID{0}), t.chunk_ids_of_partition(PartitionID{0}));
+
+  // Each table keeps appending to its own copy of the open chunk of a partition.
+  for (auto row = 6; row < 12; ++row) {
+    snapshot->append({row, "snapshot row"});
+  }
+  EXPECT_EQ(t.row_count(), 6u);
+  EXPECT_EQ(snapshot->row_count(), 12u);
+  for (auto partition_id = PartitionID{0}; partition_id < 2; ++partition_id) {
+    for (const auto chunk_id : snapshot->chunk_ids_of_partition(partition_id)) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < snapshot->get_chunk(chunk_id).size(); ++chunk_offset) {
+        const auto value = (*snapshot->get_chunk(chunk_id).get_segment(ColumnID{0}))[chunk_offset];
+        EXPECT_EQ(snapshot->partition_schema()->partition_of(value), partition_id);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -47,6 +47,12 @@ TEST_F(StorageValueSegmentTest, GetValues) {
   EXPECT_EQ(type_cast<double>(double_value_segment[ChunkOffset{0}]), 3.14);
 }
 
+TEST_F(StorageValueSegmentTest, ConstructFromValues) {
+  const auto value_segment = ValueSegment<int32_t>{std::vector<int32_t>{1, 2, 3}};
+  EXPECT_EQ(value_segment.size(), 3u);
+  EXPECT_EQ(value_segment.values().at(2), 3);
+}
+
 TEST_F(StorageValueSegmentTest, GetValuesException) {
   int_value_segment.append(3);
   EXPECT_THROW(int_value_segment[ChunkOffset{2}], std::exception);
@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/tpch/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  EXPECT_EQ(tables.at(TpchTable::Region)->row_count(), 5u);
+  EXPECT_EQ(tables.at(TpchTable::Nation)->row_count(), 25u);
+  EXPECT_EQ(tables.at(TpchTable::Supplier)->row_count(), 100u);
+  EXPECT_EQ(tables.at(TpchTable::Customer)->row_count(), 1'500u);
+  EXPECT_EQ(tables.at(TpchTable::Part)->row_count(), 2'000u);
+  EXPECT_EQ(tables.at(TpchTable::PartSupp)->row_count(), 8'000u);
+  EXPECT_EQ(tables.at(TpchTable::Orders)->row_count(), 15'000u);
+
+  // Each order has between one and seven line items.
+  const auto lineitem_row_count = tables.at(TpchTable::LineItem)->row_count();
+  EXPECT_GE(lineitem_row_count, 15'000u);
+  EXPECT_LE(lineitem_row_count, 7 * 15'000u);
+}
+
+TEST_F(TpchTableGeneratorTest, Schema) {
+  const auto tables = TpchTableGenerator{0.001f}.generate();
+
+  const auto& lineitem = tables.at(TpchTable::LineItem);
+  EXPECT_EQ(lineitem->column_count(), 16u);
+  EXPECT_EQ(lineitem->column_name(ColumnID{0}), "l_orderkey");
+  EXPECT_EQ(lineitem->column_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(lineitem->column_type(lineitem->column_id_by_name("l_quantity")), DataType::Float);
+  EXPECT_EQ(lineitem->column_type(lineitem->column_id_by_name("l_shipdate")), DataType::String);
+
+  const auto& nation = tables.at(TpchTable::Nation);
+  EXPECT_EQ((*nation->get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[0], AllTypeVariant{std::string{"ALGERIA"}});
+  EXPECT_EQ((*nation->get_chunk(ChunkID{0}).get_segment(ColumnID{2}))[24], AllTypeVariant{1});
+}
+
+TEST_F(TpchTableGeneratorTest, ChunkSize) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  const auto& customer = tables.at(TpchTable::Customer);
+  EXPECT_EQ(customer->target_chunk_size(), 1'000u);
+  EXPECT_EQ(customer->chunk_count(), 2u);
+  EXPECT_EQ(customer->get_chunk(ChunkID{0}).size(), 1'000u);
+  EXPECT_EQ(customer->get_chunk(ChunkID{1}).size(), 500u);
+  EXPECT_TRUE(customer->get_chunk(ChunkID{0}).is_finalized());
+  EXPECT_FALSE(customer->get_chunk(ChunkID{1}).is_finalized());
+}
+
+TEST_F(TpchTableGeneratorTest, Deterministic) {
+  const auto first_tables = TpchTableGenerator{0.001f, 100}.generate();
+  const auto second_tables = TpchTableGenerator{0.001f, 100}.generate();
+  const auto tables_with_other_seed = TpchTableGenerator{0.001f, 100, 1337}.generate();
+
+  EXPECT_TABLE_EQ(first_tables.at(TpchTable::Supplier), second_tables.at(TpchTable::Supplier), true);
+  EXPECT_TABLE_EQ(first_tables.at(TpchTable::Orders), second_tables.at(TpchTable::Orders), true);
+
+  const auto first_comment = (*first_tables.at(TpchTable::Orders)->get_chunk(ChunkID{0}).get_segment(ColumnID{8}))[0];
+  const auto other_comment =
+      (*tables_with_other_seed.at(TpchTable::Orders)->get_chunk(ChunkID{0}).get_segment(ColumnID{8}))[0];
+  EXPECT_NE(first_comment, other_comment);
+}
+
+TEST_F(TpchTableGeneratorTest, GenerateAndStore) {
+  TpchTableGenerator{0.001f}.generate_and_store();
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& [tpch_table, table_name] : tpch_table_names) {
+    EXPECT_TRUE(storage_manager.has_table(table_name));
+  }
+  EXPECT_EQ(storage_manager.get_table("region")->row_count(), 5u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <latch>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/tracer.hpp"
+
+namespace opossum {
+
+class UtilsTracerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", DataType::Int);
+    for (auto row = 0; row < 30; ++row) {
+      table->append({row});
+    }
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void _scan() {
+    const auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 15);
+    table_scan->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(UtilsTracerTest, DisabledByDefault) {
+  EXPECT_FALSE(Tracer::enabled());
+  _scan();
+  EXPECT_TRUE(Tracer::get().events().empty());
+}
+
+TEST_F(UtilsTracerTest, RecordsOperatorsAndChunks) {
+  Tracer::enable(true);
+  _scan();
+  Tracer::enable(false);
+  // Not recorded
+
+  _scan();
+
+  const auto events = Tracer::get().events();
+  auto spans = std::vector<std::string>{};
+  for (const auto& event : events) {
+    EXPECT_EQ(event.worker_id, events.front().worker_id);
+    auto span = std::string{event.phase == TracePhase::Begin ? "B " : "E "} + event.name;
+    if (event.chunk_id) span += " " + std::to_string(*event.chunk_id);
+    spans.emplace_back(span);
+  }
+  EXPECT_EQ(spans, (std::vector<std::string>{"B TableScan", "B TableScan 0", "E TableScan 0", "B TableScan 1",
+                                             "E TableScan 1", "B TableScan 2", "E TableScan 2", "E TableScan"}));
+  EXPECT_TRUE(std::is_sorted(events.cbegin(), events.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.timestamp < rhs.timestamp; }));
+
+  auto trace = std::stringstream{};
+  Tracer::get().write_chrome_trace(trace);
+  EXPECT_NE(trace.str().find(R"({"name":"TableScan","cat":"chunk","ph":"E","pid":1,"tid":)"), std::string::npos);
+  EXPECT_NE(trace.str().find(R"("args":{"chunk_id":1}})"), std::string::npos);
+  EXPECT_NE(trace.str().find(R"("ph":"M")"), std::string::npos);
+
+  Tracer::get().reset();
+  EXPECT_TRUE(Tracer::get().events().empty());
+}
+
+TEST_F(UtilsTracerTest, ThreadsRecordIntoSeparateWorkers) {
+  constexpr auto THREAD_COUNT = 4;
+  auto all_recorded = std::latch{THREAD_COUNT};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < THREAD_COUNT; ++thread_index) {
+    threads.emplace_back([&]() {
+      Tracer::get().record("Task", TraceCategory::Task, TracePhase::Begin);
+      all_recorded.arrive_and_wait();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto worker_ids = std::set<size_t>{};
+  for (const auto& event : Tracer::get().events()) {
+    worker_ids.emplace(event.worker_id);
+  }
+  EXPECT_EQ(worker_ids.size(), THREAD_COUNT);
+
+  // The workers of exited threads are reused.
+  Tracer::get().reset();
+  std::thread{[]() { Tracer::get().record("Task", TraceCategory::Task, TracePhase::Begin); }}.join();
+  const auto events = Tracer::get().events();
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_TRUE(worker_ids.contains(events.front().worker_id));
+}
+
+TEST_F(UtilsTracerTest, RingBufferKeepsLatestEvents) {
+  constexpr auto EVENT_COUNT = Tracer::EVENTS_PER_WORKER + 10;
+  std::thread{[]() {
+    Tracer::get().record("First", TraceCategory::Chunk, TracePhase::Begin, ChunkID{0});
+    for (auto chunk_id = ChunkID{1}; chunk_id < EVENT_COUNT; ++chunk_id) {
+      Tracer::get().record("Chunk", TraceCategory::Chunk, TracePhase::Begin, chunk_id);
+    }
+  }}.join();
+
+  // The slot that the next event is written to is not read, as it might be being overwritten.
+  const auto events = Tracer::get().events();
+  ASSERT_EQ(events.size(), Tracer::EVENTS_PER_WORKER - 1);
+  EXPECT_EQ(events.front().chunk_id, ChunkID{11});
+  EXPECT_EQ(events.back().chunk_id, ChunkID{EVENT_COUNT - 1});
+}
+
+TEST_F(UtilsTracerTest, ReadsWhileRecording) {
+  auto recorder = std::thread{[]() {
+    Tracer::get().record("First", TraceCategory::Chunk, TracePhase::Begin, ChunkID{0});
+    for (auto chunk_id = ChunkID{1}; chunk_id < 4 * Tracer::EVENTS_PER_WORKER; ++chunk_id) {
+      Tracer::get().record("Chunk", TraceCategory::Chunk, TracePhase::Begin, chunk_id);
+    }
+  }};
+
+  // Events that were overwritten while they were read must have been dropped, so the retained ones are consecutive.
+  for (auto read = 0; read < 20; ++read) {
+    const auto events = Tracer::get().events();
+    for (auto index = size_t{1}; index < events.size(); ++index) {
+      ASSERT_EQ(events[index].chunk_id, ChunkID{*events[index - 1].chunk_id + 1});
+    }
+  }
+  recorder.join();
+}
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#include "lz4.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define MIN_MATCH 4
+#define LAST_LITERALS 5 /* the last five bytes of a block are always literals */
+#define MF_LIMIT 12     /* the last match starts at least twelve bytes before the end of the block */
+#define MAX_OFFSET 65535
+#define HASH_LOG 12
+#define RUN_MASK 15
+#define ML_MASK 15
+
+static uint32_t read32(const uint8_t* pointer) {
+  uint32_t value;
+  memcpy(&value, pointer, sizeof(value));
+  return value;
+}
+
+static uint32_t hash_sequence(const uint32_t sequence) { return (sequence * 2654435761U) >> (32 - HASH_LOG); }
+
+static uint8_t* write_length(uint8_t* op, size_t length) {
+  while (length >= 255) {
+    *op++ = 255;
+    length -= 255;
+  }
+  *op++ = (uint8_t)length;
+  return op;
+}
+
+static uint8_t* write_sequence(uint8_t* op, const uint8_t* literals, const size_t literal_length,
+                               const size_t match_length, const int has_match, const uint32_t offset) {
+  uint8_t* const token = op++;
+  *token = (uint8_t)((literal_length >= RUN_MASK ? RUN_MASK : literal_length) << 4);
+  if (literal_length >= RUN_MASK) op = write_length(op, literal_length - RUN_MASK);
+  memcpy(op, literals, literal_length);
+  op += literal_length;
+  if (!has_match) return op;
+
+  *op++ = (uint8_t)(offset & 0xFF);
+  *op++ = (uint8_t)(offset >> 8);
+  *token |= (uint8_t)(match_length >= ML_MASK ? ML_MASK : match_length);
+  if (match_length >= ML_MASK) op = write_length(op, match_length - ML_MASK);
+  return op;
+}
+
+int LZ4_compressBound(const int inputSize) {
+  if (inputSize < 0 || inputSize > LZ4_MAX_INPUT_SIZE) return 0;
+  return inputSize + inputSize / 255 + 16;
+}
+
+int LZ4_compress_default(const char* source, char* dest, const int sourceSize, const int maxDestSize) {
+  const uint8_t* const begin = (const uint8_t*)source;
+  const uint8_t* const end = begin + sourceSize;
+  const uint8_t* ip = begin;
+  const uint8_t* anchor = begin;
+  uint8_t* op = (uint8_t*)dest;
+  uint32_t table[1 << HASH_LOG];
+
+  /* Writing stays within the bound, so a destination of at least the bound never overflows. */
+  if (sourceSize < 0 || sourceSize > LZ4_MAX_INPUT_SIZE || maxDestSize < LZ4_compressBound(sourceSize)) return 0;
+  memset(table, 0, sizeof(table));
+
+  if (sourceSize > MF_LIMIT) {
+    const uint8_t* const match_start_limit = end - MF_LIMIT;
+    const uint8_t* const match_end_limit = end - LAST_LITERALS;
+
+    while (ip < match_start_limit) {
+      const uint32_t sequence = read32(ip);
+      const uint32_t hash = hash_sequence(sequence);
+      const uint8_t* match = begin + table[hash];
+      table[hash] = (uint32_t)(ip - begin);
+
+      if (match >= ip || ip - match > MAX_OFFSET || read32(match) != sequence) {
+        ++ip;
+        continue;
+      }
+
+      /* Extend the match backwards into the pending literals and forwards as far as allowed. */
+      while (ip > anchor && match > begin && ip[-1] == match[-1]) {
+        --ip;
+        --match;
+      }
+      {
+        const uint8_t* match_end = ip + MIN_MATCH;
+        const uint8_t* reference = match + MIN_MATCH;
+        while (match_end < match_end_limit && *match_end == *reference) {
+          ++match_end;
+          ++reference;
+        }
+
+        op = write_sequence(op, anchor, (size_t)(ip - anchor), (size_t)(match_end - ip - MIN_MATCH), 1,
+                            (uint32_t)(ip - match));
+        ip = match_end;
+        anchor = ip;
+      }
+
+      if (ip < match_start_limit) table[hash_sequence(read32(ip - 2))] = (uint32_t)(ip - 2 - begin);
+    }
+  }
+
+  op = write_sequence(op, anchor, (size_t)(end - anchor), 0, 0, 0);
+  return (int)(op - (uint8_t*)dest);
+}
+
+int LZ4_decompress_safe(const char* source, char* dest, const int compressedSize, const int maxDecompressedSize) {
+  const uint8_t* ip = (const uint8_t*)source;
+  const uint8_t* const input_end = ip + compressedSize;
+  uint8_t* const output_begin = (uint8_t*)dest;
+  uint8_t* op = output_begin;
+  uint8_t* const output_end = op + maxDecompressedSize;
+
+  if (compressedSize <= 0 || maxDecompressedSize < 0) return -1;
+
+  for (;;) {
+    const uint8_t token = *ip++;
+    size_t literal_length = token >> 4;
+    if (literal_length == RUN_MASK) {
+      uint8_t byte;
+      do {
+        if (ip >= input_end) return -1;
+        byte = *ip++;
+        literal_length += byte;
+      } while (byte == 255);
+    }
+    if ((size_t)(input_end - ip) < literal_length || (size_t)(output_end - op) < literal_length) return -1;
+    memcpy(op, ip, literal_length);
+    op += literal_length;
+    ip += literal_length;
+
+    /* The last sequence consists of literals only. */
+    if (ip == input_end) break;
+
+    {
+      size_t offset;
+      size_t match_length = token & ML_MASK;
+      const uint8_t* match;
+      size_t index;
+
+      if (input_end - ip < 2) return -1;
+      offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+      ip += 2;
+      if (offset == 0 || offset > (size_t)(op - output_begin)) return -1;
+
+      if (match_length == ML_MASK) {
+        uint8_t byte;
+        do {
+          if (ip >= input_end) return -1;
+          byte = *ip++;
+          match_length += byte;
+        } while (byte == 255);
+      }
+      match_length += MIN_MATCH;
+      if ((size_t)(output_end - op) < match_length) return -1;
+
+      /* Matches may overlap with the bytes they produce, so they are copied byte by byte. */
+      match = op - offset;
+      for (index = 0; index < match_length; ++index) {
+        op[index] = match[index];
+      }
+      op += match_length;
+    }
+
+    if (ip >= input_end) return -1;
+  }
+
+  return (int)(op - output_begin);
+}
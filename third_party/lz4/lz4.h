@@ -0,0 +1,42 @@
+/*
+ * Minimal implementation of the LZ4 block format
+ * (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md).
+ *
+ * Only the block API is provided, with the signatures of the reference implementation, so that lz4.c/lz4.h of the
+ * reference implementation can replace these files without changes to the callers. Blocks produced by
+ * LZ4_compress_default can be decoded by any LZ4 block decoder and vice versa.
+ *
+ * The compressor is a single-pass greedy matcher with a 4096-entry hash table, i.e., it trades some compression ratio
+ * for speed like the "fast" mode of the reference implementation.
+ */
+
+#ifndef LZ4_H_MINIMAL
+#define LZ4_H_MINIMAL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LZ4_MAX_INPUT_SIZE 0x7E000000
+
+/* Maximum size of the compressed data for an input of the given size, 0 if the input is too large. */
+int LZ4_compressBound(int inputSize);
+
+/*
+ * Compresses sourceSize bytes from source into dest, whose capacity is maxDestSize bytes. Returns the number of
+ * bytes written, or 0 if the compressed data does not fit into dest.
+ */
+int LZ4_compress_default(const char* source, char* dest, int sourceSize, int maxDestSize);
+
+/*
+ * Decompresses a block of compressedSize bytes from source into dest, whose capacity is maxDecompressedSize bytes.
+ * Returns the number of bytes written, or a negative value if the block is malformed or does not fit into dest.
+ * Never reads or writes outside of the given buffers.
+ */
+int LZ4_decompress_safe(const char* source, char* dest, int compressedSize, int maxDecompressedSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LZ4_H_MINIMAL */